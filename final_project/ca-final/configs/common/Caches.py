@@ -68,6 +68,33 @@ class L1_DCache(L1Cache):
     pass
 
 
+class VictimCache(Cache):
+    """Small fully-associative victim buffer to slot between an L1
+    and the L2, expressed as a proper (and therefore snoop-correct)
+    cache level: mostly-exclusive clusivity means lines are allocated
+    when the L1 above evicts them rather than on demand fills, which
+    is insertion-on-eviction; a subsequent L1 miss that hits here is
+    served at the buffer's latency and the line is invalidated below
+    (the swap half of swap-on-hit; the L1's own eviction completes
+    the swap). Size follows from the entry count and line size, e.g.
+    8 entries of 64B = 512B with assoc 8. A coherent standalone
+    VictimBuffer MemObject would have to re-implement exactly this
+    snooping and writeback machinery, which is why the classic
+    hierarchy models victim buffers as a cache level.
+    """
+
+    assoc = 8
+    size = "512B"
+    tag_latency = 1
+    data_latency = 1
+    response_latency = 1
+    mshrs = 4
+    tgts_per_mshr = 8
+    clusivity = "mostly_excl"
+    writeback_clean = True
+    replacement_policy = LRURP()
+
+
 class L2Cache(Cache):
     assoc = 8
     tag_latency = 20
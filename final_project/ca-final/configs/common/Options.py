@@ -407,6 +407,23 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
                       then the number of threads per cpu is same as the
                       number of programs.""",
     )
+    parser.add_argument(
+        "--parallel-eventq",
+        action="store_true",
+        default=False,
+        help="""Bind each CPU and its private cache hierarchy to its
+                      own main event queue so a multi-core simulation runs
+                      one host thread per core, synchronized every
+                      --sim-quantum.""",
+    )
+    parser.add_argument(
+        "--sim-quantum",
+        action="store",
+        type=str,
+        default="1us",
+        help="""Simulation quantum for parallel event queue
+                      simulation (only used with --parallel-eventq)""",
+    )
     parser.add_argument(
         "--elastic-trace-en",
         action="store_true",
@@ -500,6 +500,22 @@ def run(options, root, testsys, cpu_class):
     np = options.num_cpus
     switch_cpus = None
 
+    if getattr(options, "parallel_eventq", False):
+        if cpu_class or options.standard_switch or options.repeat_switch:
+            fatal("Can't use --parallel-eventq with CPU switching")
+        if np > 1:
+            # Each core (and its private caches, which descend from it in
+            # the object tree) gets its own event queue; shared devices
+            # stay on queue 0. Synchronization happens every sim_quantum.
+            partitionEventQueues(testsys.cpu)
+            root.sim_quantum = m5.ticks.fromSeconds(
+                convert.anyToLatency(options.sim_quantum)
+            )
+            print(
+                "Parallel event queues: %d CPU queues, quantum %s"
+                % (np, options.sim_quantum)
+            )
+
     if options.prog_interval:
         for i in range(np):
             testsys.cpu[i].progress_interval = options.prog_interval
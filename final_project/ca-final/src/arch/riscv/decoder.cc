@@ -40,7 +40,8 @@ namespace gem5
 namespace RiscvISA
 {
 
-Decoder::Decoder(const RiscvDecoderParams &p) : InstDecoder(p, &machInst)
+Decoder::Decoder(const RiscvDecoderParams &p)
+    : InstDecoder(p, &machInst), uopCache(uopCacheEntries)
 {
     ISA *isa = dynamic_cast<ISA*>(p.isa);
     vlen = isa->getVecLenInBits();
@@ -120,12 +121,22 @@ Decoder::decode(ExtMachInst mach_inst, Addr addr)
     DPRINTF(Decode, "Decoding instruction 0x%08x at address %#x\n",
             mach_inst.instBits, addr);
 
+    UopCacheEntry &entry = uopCache[(addr >> 1) % uopCacheEntries];
+    if (entry.pc == addr && entry.emi == mach_inst) {
+        // the cached instruction was sized when it was inserted
+        return entry.inst;
+    }
+
     StaticInstPtr &si = instMap[mach_inst];
     if (!si)
         si = decodeInst(mach_inst);
 
     si->size(compressed(mach_inst) ? 2 : 4);
 
+    entry.pc = addr;
+    entry.emi = mach_inst;
+    entry.inst = si;
+
     DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
             si->getName(), mach_inst);
     return si;
@@ -30,6 +30,8 @@
 #ifndef __ARCH_RISCV_DECODER_HH__
 #define __ARCH_RISCV_DECODER_HH__
 
+#include <vector>
+
 #include "arch/generic/decode_cache.hh"
 #include "arch/generic/decoder.hh"
 #include "arch/riscv/insts/vector.hh"
@@ -52,6 +54,24 @@ class Decoder : public InstDecoder
 {
   private:
     decode_cache::InstMap<ExtMachInst> instMap;
+
+    /**
+     * Direct-mapped decoded-instruction (uop) cache keyed by fetch
+     * PC, in front of the hashed instMap. Hot loops hit here and skip
+     * both the ExtMachInst hash and the map probe, which show up in
+     * profiles of fetch-bound runs. The machine instruction is part
+     * of the tag since the same PC can decode differently (vector
+     * configuration changes, self-modifying code).
+     */
+    struct UopCacheEntry
+    {
+        Addr pc = MaxAddr;
+        ExtMachInst emi;
+        StaticInstPtr inst;
+    };
+    static constexpr size_t uopCacheEntries = 2048;
+    std::vector<UopCacheEntry> uopCache;
+
     bool aligned;
     bool mid;
 
@@ -88,12 +88,23 @@ class Interrupts : public BaseInterrupts
 
     bool checkInterrupts() const override
     {
+        // Fast path for the per-instruction poll: with nothing
+        // pending-and-enabled locally (plain bitset math on members)
+        // and no NMI, no interrupt can fire, and the status/ideleg
+        // CSR reads inside globalMask() are skipped entirely. The
+        // answer is identical: in this state the original expression
+        // reduces to false under every Smrnmi/NMIE combination.
+        const std::bitset<NumInterruptTypes> pending = (ip | hvip) & ie;
+        if (pending.none() && !checkNonMaskableInterrupt()) {
+            return false;
+        }
+
         ISA* isa = static_cast<ISA*>(tc->getIsaPtr());
         if (isa->enableSmrnmi() && tc->readMiscReg(MISCREG_NMIE) == 0) {
             return false;
         }
         return checkNonMaskableInterrupt() ||
-               ((ip | hvip) & ie & globalMask()).any();
+               (pending & globalMask()).any();
     }
 
     Fault getInterrupt() override;
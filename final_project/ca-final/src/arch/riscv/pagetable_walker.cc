@@ -73,9 +73,11 @@ Fault
 Walker::start(ThreadContext * _tc, BaseMMU::Translation *_translation,
     const RequestPtr &_req, BaseMMU::Mode _mode, TlbEntry* result_entry)
 {
-    // TODO: in timing mode, instead of blocking when there are other
-    // outstanding requests, see if this request can be coalesced with
-    // another one (i.e. either coalesce or start walk)
+    // Queued walks are coalesced through the TLB: startWalkWrapper()
+    // re-probes the TLB before starting each queued walk and squashes
+    // walks whose page another walk meanwhile resolved, so concurrent
+    // misses to one page cost one memory walk plus cheap
+    // re-translates for the joiners.
     WalkerState * newState = new WalkerState(this, _translation, _req);
     newState->initState(_tc, _mode, sys->isTimingMode());
     if (currStates.size()) {
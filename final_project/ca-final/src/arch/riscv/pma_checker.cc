@@ -98,6 +98,12 @@ PMAChecker::checkVAddrAlignment(
 bool
 PMAChecker::isUncacheable(const AddrRange &range)
 {
+    // the common FS configuration has no uncacheable PMA regions at
+    // all; skip the per-access scan outright then
+    if (uncacheable.empty()) {
+        return false;
+    }
+
     for (auto const &uncacheable_range: uncacheable) {
         if (range.isSubset(uncacheable_range)) {
             return true;
@@ -42,6 +42,7 @@
 #include "arch/riscv/pma_checker.hh"
 #include "arch/riscv/pmp.hh"
 #include "arch/riscv/pra_constants.hh"
+#include "arch/riscv/reg_abi.hh"
 #include "arch/riscv/utility.hh"
 #include "base/inifile.hh"
 #include "base/str.hh"
@@ -53,6 +54,7 @@
 #include "params/RiscvTLB.hh"
 #include "sim/full_system.hh"
 #include "sim/process.hh"
+#include "sim/pseudo_inst.hh"
 #include "sim/system.hh"
 
 namespace gem5
@@ -80,7 +82,7 @@ buildKey(Addr vpn, uint16_t asid)
 TLB::TLB(const Params &p) :
     BaseTLB(p), size(p.size), tlb(size),
     lruSeq(0), stats(this), pma(p.pma_checker),
-    pmp(p.pmp)
+    pmp(p.pmp), m5opRange(p.system->m5opRange())
 {
     for (size_t x = 0; x < size; x++) {
         tlb[x].trieHandle = NULL;
@@ -115,7 +117,16 @@ TLB::evictLRU()
 TlbEntry *
 TLB::lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden)
 {
-    TlbEntry *entry = trie.lookup(buildKey(vpn, asid));
+    MicroTlbSlot &slot = microTlb[microTlbIndex(vpn, asid)];
+    TlbEntry *entry;
+    if (slot.entry && slot.vpn == vpn && slot.asid == asid) {
+        entry = slot.entry;
+    } else {
+        entry = trie.lookup(buildKey(vpn, asid));
+        if (entry) {
+            slot = {vpn, asid, entry};
+        }
+    }
 
     DPRINTF(TLBVerbose, "lookup(vpn=%#x, asid=%#x, key=%#x): "
                         "%s ppn=%#x (%#x) %s\n",
@@ -246,6 +257,10 @@ TLB::remove(size_t idx)
     trie.remove(tlb[idx].trieHandle);
     tlb[idx].trieHandle = NULL;
     freeList.push_back(&tlb[idx]);
+
+    // entries are recycled from the free list; drop every cached
+    // pointer so a stale slot can never serve the next occupant
+    flushMicroTlb();
 }
 
 Fault
@@ -682,6 +697,31 @@ Fault
 TLB::finalizePhysical(const RequestPtr &req,
                       ThreadContext *tc, BaseMMU::Mode mode) const
 {
+    const Addr paddr = req->getPaddr();
+
+    if (m5opRange.contains(paddr)) {
+        // Memory-mapped m5op trigger, as on the other ISAs: the
+        // access is served locally by dispatching the pseudo op with
+        // arguments in the standard registers, so guest stubs are a
+        // plain load/store to the magic range -- no custom opcodes
+        // and no trap, just the cost of one uncached access.
+        req->setFlags(Request::STRICT_ORDER);
+        uint8_t func;
+        pseudo_inst::decodeAddrOffset(paddr - m5opRange.start(), func);
+        req->setLocalAccessor(
+            [func, mode](ThreadContext *tc, PacketPtr pkt) -> Cycles
+            {
+                uint64_t ret;
+                pseudo_inst::pseudoInst<RegABI64>(tc, func, ret);
+
+                if (mode == BaseMMU::Read)
+                    pkt->setLE(ret);
+
+                return Cycles(1);
+            }
+        );
+    }
+
     return NoFault;
 }
 
@@ -32,6 +32,7 @@
 #ifndef __ARCH_RISCV_TLB_HH__
 #define __ARCH_RISCV_TLB_HH__
 
+#include <array>
 #include <list>
 
 #include "arch/generic/tlb.hh"
@@ -116,6 +117,9 @@ class TLB : public BaseTLB
     BasePMAChecker *pma;
     PMP *pmp;
 
+    /** Range of the memory-mapped m5op triggers, if configured. */
+    const AddrRange m5opRange;
+
   public:
     typedef RiscvTLBParams Params;
     TLB(const Params &p);
@@ -203,6 +207,36 @@ class TLB : public BaseTLB
      */
     TlbEntry *lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden);
 
+    /**
+     * Direct-mapped recent-translation cache in front of the trie.
+     * Tags carry (vpn, asid) and values point into the preallocated
+     * entry storage, so the cache is flushed wholesale whenever any
+     * entry is removed (every free goes through remove()). Superpage
+     * lookups cache under the querying vpn, so each slot holds the
+     * covering entry for that page.
+     */
+    struct MicroTlbSlot
+    {
+        Addr vpn = 0;
+        uint16_t asid = 0;
+        TlbEntry *entry = nullptr;
+    };
+    static constexpr size_t microTlbSize = 64;
+    std::array<MicroTlbSlot, microTlbSize> microTlb;
+
+    static size_t
+    microTlbIndex(Addr vpn, uint16_t asid)
+    {
+        // vpn is already a page number (vaddr >> PageShift)
+        return (vpn ^ asid) % microTlbSize;
+    }
+
+    void
+    flushMicroTlb()
+    {
+        microTlb.fill(MicroTlbSlot());
+    }
+
   private:
     uint64_t nextSeq() { return ++lruSeq; }
 
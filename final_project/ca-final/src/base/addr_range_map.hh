@@ -283,8 +283,14 @@ class AddrRangeMap
      * @param f A condition on an address range
      * @return An iterator that contains the input address range
      */
+    /**
+     * The matching condition is a template parameter so call sites'
+     * lambdas inline instead of being wrapped in a std::function per
+     * lookup -- this runs for every packet routed by a crossbar.
+     */
+    template <typename Cond>
     iterator
-    find(const AddrRange &r, std::function<bool(const AddrRange)> cond)
+    find(const AddrRange &r, const Cond &cond)
     {
         // Check the cache first
         for (auto c = cache.begin(); c != cache.end(); c++) {
@@ -320,8 +326,9 @@ class AddrRangeMap
         return end();
     }
 
+    template <typename Cond>
     const_iterator
-    find(const AddrRange &r, std::function<bool(const AddrRange)> cond) const
+    find(const AddrRange &r, const Cond &cond) const
     {
         return const_cast<AddrRangeMap *>(this)->find(r, cond);
     }
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_BOUNDED_MEMOIZER_HH__
+#define __BASE_BOUNDED_MEMOIZER_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace gem5
+{
+
+/**
+ * Capacity-bounded companion of Memoizer (base/memoizer.hh), for hot
+ * per-address memoization where the key space is unbounded: a hashed
+ * lookup with LRU eviction at a fixed capacity, plus hit/miss
+ * counters so callers can export the hit rate. Unlike Memoizer,
+ * entries silently age out, so it also fits functions whose results
+ * are only temporally stable -- the natural backing structure for
+ * address-keyed lookup caches.
+ *
+ * Example usage:
+ *
+ * BoundedMemoizer<4096, Tick, Addr> lat_memo(computeLatency);
+ * lat_memo(addr);
+ */
+template <std::size_t Capacity, typename Ret, typename... Args>
+class BoundedMemoizer
+{
+  public:
+    using ret_type = Ret;
+    using args_type = std::tuple<Args...>;
+
+    constexpr BoundedMemoizer(Ret (*_func)(Args...))
+        : func(_func)
+    {
+        static_assert(Capacity > 0, "BoundedMemoizer needs capacity");
+        static_assert(!std::disjunction_v<std::is_reference<Args>...>,
+                      "BoundedMemoizer does not support references");
+    }
+
+    BoundedMemoizer() = delete;
+    BoundedMemoizer(const BoundedMemoizer &rhs) = delete;
+    BoundedMemoizer &operator=(const BoundedMemoizer &rhs) = delete;
+
+    Ret
+    operator()(Args... args)
+    {
+        const args_type key = std::make_tuple(args...);
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            _hits++;
+            // move to the front of the LRU order
+            lru.splice(lru.begin(), lru, it->second);
+            return it->second->second;
+        }
+
+        _misses++;
+        if (lru.size() >= Capacity) {
+            cache.erase(lru.back().first);
+            lru.pop_back();
+        }
+        lru.emplace_front(key, func(args...));
+        cache.emplace(key, lru.begin());
+        return lru.front().second;
+    }
+
+    /** Clear the memoization cache; the counters are kept. */
+    void
+    flush()
+    {
+        cache.clear();
+        lru.clear();
+    }
+
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+    std::size_t size() const { return lru.size(); }
+
+  private:
+    struct TupleHash
+    {
+        std::size_t
+        operator()(const args_type &key) const
+        {
+            std::size_t seed = 0;
+            std::apply([&seed](const auto &...component) {
+                ((seed ^= std::hash<std::decay_t<
+                      decltype(component)>>{}(component) +
+                      0x9e3779b9 + (seed << 6) + (seed >> 2)), ...);
+            }, key);
+            return seed;
+        }
+    };
+
+    Ret (*func)(Args...);
+
+    /** Entries in recency order, most recent first. */
+    std::list<std::pair<args_type, Ret>> lru;
+
+    /** Hashed index into the recency list. */
+    std::unordered_map<args_type, typename decltype(lru)::iterator,
+                       TupleHash> cache;
+
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
+};
+
+} // namespace gem5
+
+#endif // __BASE_BOUNDED_MEMOIZER_HH__
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "base/bounded_memoizer.hh"
+
+namespace {
+
+int callCount = 0;
+
+int
+slowDouble(int x)
+{
+    callCount++;
+    return 2 * x;
+}
+
+} // anonymous namespace
+
+TEST(BoundedMemoizerTest, HitsAndMisses)
+{
+    callCount = 0;
+    gem5::BoundedMemoizer<4, int, int> memo(slowDouble);
+
+    EXPECT_EQ(memo(1), 2);
+    EXPECT_EQ(memo(1), 2);
+    EXPECT_EQ(callCount, 1);
+    EXPECT_EQ(memo.hits(), 1);
+    EXPECT_EQ(memo.misses(), 1);
+}
+
+TEST(BoundedMemoizerTest, EvictsLeastRecentlyUsed)
+{
+    callCount = 0;
+    gem5::BoundedMemoizer<2, int, int> memo(slowDouble);
+
+    memo(1);          // {1}
+    memo(2);          // {2, 1}
+    memo(1);          // {1, 2} - refresh 1
+    memo(3);          // {3, 1} - evicts 2
+    EXPECT_EQ(callCount, 3);
+    EXPECT_EQ(memo.size(), 2);
+
+    memo(2);          // miss: was evicted
+    EXPECT_EQ(callCount, 4);
+    memo(1);          // miss: re-inserting 2 evicted 1 ({2, 3})
+    EXPECT_EQ(callCount, 5);
+    memo(2);          // hit: still resident ({1, 2} evicted 3)
+    EXPECT_EQ(callCount, 5);
+}
+
+TEST(BoundedMemoizerTest, FlushKeepsCounters)
+{
+    callCount = 0;
+    gem5::BoundedMemoizer<8, int, int> memo(slowDouble);
+
+    memo(1);
+    memo(1);
+    memo.flush();
+    EXPECT_EQ(memo.size(), 0u);
+    memo(1);
+    EXPECT_EQ(callCount, 2);
+    EXPECT_EQ(memo.hits(), 1);
+    EXPECT_EQ(memo.misses(), 2);
+}
+
+TEST(BoundedMemoizerTest, MultipleArguments)
+{
+    gem5::BoundedMemoizer<16, int, int, int> memo(
+        +[](int a, int b) { return a * 10 + b; });
+
+    EXPECT_EQ(memo(1, 2), 12);
+    EXPECT_EQ(memo(2, 1), 21);
+    EXPECT_EQ(memo(1, 2), 12);
+    EXPECT_EQ(memo.hits(), 1);
+}
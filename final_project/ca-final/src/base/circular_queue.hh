@@ -74,6 +74,14 @@ class CircularQueue
     using reference = typename std::vector<T>::reference;
     using const_reference = typename std::vector<T>::const_reference;
     const size_t _capacity;
+
+    /**
+     * _capacity - 1 when the capacity is a power of two, otherwise 0.
+     * Lets the physical-index calculation in operator[] use a mask
+     * instead of an integer division -- these indices are computed on
+     * every LSQ and TimeBuffer access in the O3 model.
+     */
+    const size_t _mask;
     size_t _size = 0;
     size_t _head = 1;
 
@@ -395,7 +403,7 @@ class CircularQueue
     operator[](const Idx& index)
     {
         assert(index >= 0);
-        return data[index % _capacity];
+        return data[_mask ? (index & _mask) : (index % _capacity)];
     }
 
     template <typename Idx>
@@ -403,13 +411,16 @@ class CircularQueue
     operator[](const Idx& index) const
     {
         assert(index >= 0);
-        return data[index % _capacity];
+        return data[_mask ? (index & _mask) : (index % _capacity)];
     }
 
     /**
      * @ingroup api_base_utils
      */
-    explicit CircularQueue(size_t size=0) : data(size), _capacity(size) {}
+    explicit CircularQueue(size_t size=0)
+        : data(size), _capacity(size),
+          _mask(size && !(size & (size - 1)) ? size - 1 : 0)
+    {}
 
     /**
      * Remove all the elements in the queue.
@@ -45,6 +45,8 @@
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
+#include <map>
+#include <vector>
 
 #include "base/logging.hh"
 
@@ -82,6 +84,52 @@ Fiber::entryTrampoline()
     startingFiber->start();
 }
 
+namespace
+{
+
+/**
+ * Recycled fiber stacks, keyed by total mapping size (guard page
+ * included), guard protection still in place. Fibers are created
+ * and destroyed per coroutine use (GuestABI, the SystemC coupling),
+ * and reusing a mapping skips the mmap/mprotect pair per fiber.
+ * The pool is bounded per size; overflow unmaps as before.
+ */
+constexpr size_t stackPoolDepth = 16;
+
+/** Construct on first use: fibers exist as static objects in some
+ * tests and tools, so the pool cannot rely on initialization order.
+ */
+std::map<size_t, std::vector<void *>> &
+stackPool()
+{
+    static std::map<size_t, std::vector<void *>> pool;
+    return pool;
+}
+
+void *
+allocFiberStack(size_t total_size)
+{
+    auto &pool = stackPool()[total_size];
+    if (!pool.empty()) {
+        void *mapping = pool.back();
+        pool.pop_back();
+        return mapping;
+    }
+    return MAP_FAILED;
+}
+
+bool
+recycleFiberStack(size_t total_size, void *mapping)
+{
+    auto &pool = stackPool()[total_size];
+    if (pool.size() >= stackPoolDepth)
+        return false;
+    pool.push_back(mapping);
+    return true;
+}
+
+} // anonymous namespace
+
 Fiber::Fiber(size_t stack_size) : Fiber(primaryFiber(), stack_size)
 {}
 
@@ -90,17 +138,24 @@ Fiber::Fiber(Fiber *link, size_t stack_size) :
     guardPageSize(sysconf(_SC_PAGE_SIZE)), _started(false), _finished(false)
 {
     if (stack_size) {
-        guardPage = mmap(nullptr, guardPageSize + stack_size,
-                         PROT_READ | PROT_WRITE,
-                         MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
-        if (guardPage == (void *)MAP_FAILED) {
-            perror("mmap");
-            fatal("Could not mmap %d byte fiber stack.\n", stack_size);
-        }
-        stack = (void *)((uint8_t *)guardPage + guardPageSize);
-        if (mprotect(guardPage, guardPageSize, PROT_NONE)) {
-            perror("mprotect");
-            fatal("Could not forbid access to fiber stack guard page.");
+        // reuse a pooled mapping when one fits; its guard page is
+        // already protected
+        guardPage = allocFiberStack(guardPageSize + stack_size);
+        if (guardPage != (void *)MAP_FAILED) {
+            stack = (void *)((uint8_t *)guardPage + guardPageSize);
+        } else {
+            guardPage = mmap(nullptr, guardPageSize + stack_size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+            if (guardPage == (void *)MAP_FAILED) {
+                perror("mmap");
+                fatal("Could not mmap %d byte fiber stack.\n", stack_size);
+            }
+            stack = (void *)((uint8_t *)guardPage + guardPageSize);
+            if (mprotect(guardPage, guardPageSize, PROT_NONE)) {
+                perror("mprotect");
+                fatal("Could not forbid access to fiber stack guard page.");
+            }
         }
     }
 #if HAVE_VALGRIND
@@ -115,8 +170,10 @@ Fiber::~Fiber()
 #if HAVE_VALGRIND
     VALGRIND_STACK_DEREGISTER(valgrindStackId);
 #endif
-    if (guardPage)
+    if (guardPage &&
+        !recycleFiberStack(guardPageSize + stackSize, guardPage)) {
         munmap(guardPage, guardPageSize + stackSize);
+    }
 }
 
 void
@@ -60,6 +60,16 @@ class BloomFilterBlock(BloomFilterBase):
     )
 
 
+class BloomFilterBlocked(BloomFilterBase):
+    type = "BloomFilterBlocked"
+    cxx_class = "gem5::bloom_filter::Blocked"
+    cxx_header = "base/filters/blocked_bloom_filter.hh"
+
+    # All of an element's bits live in one 64-bit block, so a probe
+    # is one word load and an AND -- the layout hardware filters use.
+    num_hashes = Param.Int(3, "Number of probe bits per element")
+
+
 class BloomFilterMultiBitSel(BloomFilterBase):
     type = "BloomFilterMultiBitSel"
     cxx_class = "gem5::bloom_filter::MultiBitSel"
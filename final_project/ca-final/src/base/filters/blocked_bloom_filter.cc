@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/filters/blocked_bloom_filter.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace bloom_filter
+{
+
+Blocked::Blocked(const BloomFilterBlockedParams &p)
+    : Base(p), blocks((p.size + 63) / 64, 0), numHashes(p.num_hashes),
+      stats(this)
+{
+    fatal_if(numHashes == 0 || numHashes > 8,
+             "%s: num_hashes must be in [1, 8]", name());
+}
+
+void
+Blocked::clear()
+{
+    Base::clear();
+    std::fill(blocks.begin(), blocks.end(), 0);
+}
+
+void
+Blocked::merge(const Base *other)
+{
+    auto *cast_other = static_cast<const Blocked *>(other);
+    assert(blocks.size() == cast_other->blocks.size());
+    for (std::size_t i = 0; i < blocks.size(); i++) {
+        blocks[i] |= cast_other->blocks[i];
+    }
+}
+
+uint64_t
+Blocked::hash(Addr addr) const
+{
+    // splitmix64 over the block-aligned address
+    uint64_t z = (addr >> offsetBits) + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t
+Blocked::probeMask(uint64_t hashed) const
+{
+    // consume 6 hash bits per probe bit; with <= 8 probes this fits
+    // comfortably in the upper bits left after the block selection
+    uint64_t mask = 0;
+    for (unsigned i = 0; i < numHashes; i++) {
+        mask |= 1ULL << ((hashed >> (6 * i)) & 63);
+    }
+    return mask;
+}
+
+void
+Blocked::set(Addr addr)
+{
+    const uint64_t hashed = hash(addr);
+    blocks[(hashed >> 48) % blocks.size()] |= probeMask(hashed);
+}
+
+int
+Blocked::getCount(Addr addr) const
+{
+    const uint64_t hashed = hash(addr);
+    const uint64_t mask = probeMask(hashed);
+    const bool present =
+        (blocks[(hashed >> 48) % blocks.size()] & mask) == mask;
+
+    stats.probes++;
+    if (present)
+        stats.positives++;
+
+    return present ? 1 : 0;
+}
+
+Blocked::BlockedStats::BlockedStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(probes, statistics::units::Count::get(),
+               "Number of filter probes"),
+      ADD_STAT(positives, statistics::units::Count::get(),
+               "Number of probes answered (possibly falsely) set")
+{
+}
+
+} // namespace bloom_filter
+
+} // namespace gem5
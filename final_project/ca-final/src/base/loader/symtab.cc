@@ -86,15 +86,13 @@ bool
 SymbolTable::insert(const SymbolTable &other)
 {
     // Check if any symbol in other already exists in our table.
-    NameMap intersection;
-    std::set_intersection(other.nameMap.begin(), other.nameMap.end(),
-                          nameMap.begin(), nameMap.end(),
-                          std::inserter(intersection, intersection.begin()),
-                          nameMap.value_comp());
-    if (!intersection.empty()) {
-        warn("Cannot insert a new symbol table due to name collisions. "
-             "Adding prefix to each symbol's name can resolve this issue.");
-        return false;
+    for (const auto &entry : other.nameMap) {
+        if (nameMap.find(entry.first) != nameMap.end()) {
+            warn("Cannot insert a new symbol table due to name collisions. "
+                 "Adding prefix to each symbol's name can resolve this "
+                 "issue.");
+            return false;
+        }
     }
 
     for (const Symbol &symbol: other)
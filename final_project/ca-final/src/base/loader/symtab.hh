@@ -42,6 +42,7 @@
 #ifndef __BASE_LOADER_SYMTAB_HH__
 #define __BASE_LOADER_SYMTAB_HH__
 
+#include <unordered_map>
 #include <functional>
 #include <iosfwd>
 #include <map>
@@ -159,7 +160,10 @@ class SymbolTable
     /** Map addresses to an index into the symbol vector. */
     typedef std::multimap<Addr, int> AddrMap;
     /** Map a symbol name to an index into the symbol vector. */
-    typedef std::map<std::string, int> NameMap;
+    /** Hashed name index: symbol ingestion at image load inserts
+     * tens of thousands of entries, and hashing beats the per-insert
+     * O(log n) string compares of the ordered map it replaces. */
+    typedef std::unordered_map<std::string, int> NameMap;
 
     SymbolVector symbols;
     AddrMap addrMap;
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_MICROBENCH_HH__
+#define __BASE_MICROBENCH_HH__
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace gem5
+{
+
+/**
+ * Minimal microbenchmark helper for the *_bench.test.cc targets:
+ * times a callable over a fixed iteration count and emits one JSON
+ * line per benchmark on stdout, so runs can be collected into
+ * baseline files and diffed across revisions. Deliberately
+ * dependency-free (no vendored benchmark framework exists in ext/);
+ * the bench targets build and run through the regular GTest harness
+ * and double as smoke tests for the structures they time.
+ */
+template <typename F>
+inline double
+microbench(const char *bench_name, uint64_t iterations, F &&func)
+{
+    using clock = std::chrono::steady_clock;
+
+    // one warmup pass keeps cold-cache noise out of the measurement
+    func();
+
+    const auto start = clock::now();
+    for (uint64_t i = 0; i < iterations; i++)
+        func();
+    const auto stop = clock::now();
+
+    const double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        stop - start).count() / double(iterations);
+
+    std::printf("{\"bench\": \"%s\", \"iterations\": %llu, "
+                "\"ns_per_op\": %.2f}\n", bench_name,
+                (unsigned long long)iterations, ns);
+    return ns;
+}
+
+} // namespace gem5
+
+#endif // __BASE_MICROBENCH_HH__
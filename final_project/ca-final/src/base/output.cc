@@ -87,6 +87,13 @@ OutputFile<StreamType>::OutputFile(const OutputDirectory &dir,
 {
     std::string resolved_path = dir.resolve(_name);
 
+    // Give simout files a large stream buffer before opening: hot
+    // producers (exec traces, monitor dumps) then batch their writes
+    // into few big syscalls, which is what high-latency (e.g. NFS)
+    // results directories need. The buffer must be installed while
+    // the stream is still closed.
+    _fstream->rdbuf()->pubsetbuf(writeBuffer, sizeof(writeBuffer));
+
     _fstream->open(resolved_path.c_str(), _mode);
 
     panic_if(!_fstream->is_open(), "Failed to open \"%s\"\n", resolved_path);
@@ -131,6 +131,10 @@ class OutputFile
 
     /** Pointer to the file stream */
     stream_type_t *const _fstream;
+
+    /** Large write buffer installed on the stream before opening, so
+     * hot producers batch into few large writes. */
+    char writeBuffer[1 << 20];
 };
 
 /** Interface for creating files in a gem5 output directory. */
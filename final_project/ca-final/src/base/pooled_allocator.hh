@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_POOLED_ALLOCATOR_HH__
+#define __BASE_POOLED_ALLOCATOR_HH__
+
+#include <cstddef>
+#include <new>
+
+namespace gem5
+{
+
+/**
+ * Minimal std allocator that recycles fixed-size nodes through a
+ * per-thread free list. The target lists of MSHRs and write queue
+ * entries allocate and free one list node per queued target --
+ * millions of times per run under miss-heavy workloads -- and this
+ * keeps that churn off the host allocator. Only single-node
+ * allocations are pooled; the pool grows on demand and is never
+ * returned to the host.
+ */
+template <class T>
+class PooledNodeAllocator
+{
+  public:
+    using value_type = T;
+
+    PooledNodeAllocator() = default;
+
+    template <class U>
+    PooledNodeAllocator(const PooledNodeAllocator<U> &) {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        if (n == 1 && freeNodes) {
+            void *mem = freeNodes;
+            freeNodes = *static_cast<void **>(mem);
+            return static_cast<T *>(mem);
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        if (n == 1 && sizeof(T) >= sizeof(void *)) {
+            *reinterpret_cast<void **>(p) = freeNodes;
+            freeNodes = p;
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+  private:
+    /** Head of the recycled-node list; nodes store the next pointer
+     * in their own storage. One list per node type and thread. */
+    static inline thread_local void *freeNodes = nullptr;
+};
+
+template <class T, class U>
+bool
+operator==(const PooledNodeAllocator<T> &, const PooledNodeAllocator<U> &)
+{
+    return true;
+}
+
+template <class T, class U>
+bool
+operator!=(const PooledNodeAllocator<T> &, const PooledNodeAllocator<U> &)
+{
+    return false;
+}
+
+
+} // namespace gem5
+
+#endif // __BASE_POOLED_ALLOCATOR_HH__
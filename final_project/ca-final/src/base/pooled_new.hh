@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_POOLED_NEW_HH__
+#define __BASE_POOLED_NEW_HH__
+
+#include <cstddef>
+#include <new>
+
+namespace gem5
+{
+
+/**
+ * Mixin that recycles a class's dynamic allocations through per-thread
+ * free lists binned by size class, for objects that are created and
+ * destroyed at simulation frequency (per instruction, per branch, per
+ * packet). Inherit from PooledNew<Tag> to give a class hierarchy
+ * pooled operator new/delete; Tag (normally the inheriting base class)
+ * only namespaces the pool. Derived classes of different sizes share
+ * the pool's size-class bins. Freed storage is never returned to the
+ * host allocator; each chunk is prefixed with one granule recording
+ * its size class so deallocation does not need the dynamic type.
+ */
+template <class Tag>
+class PooledNew
+{
+  private:
+    struct Chunk
+    {
+        Chunk *next;
+    };
+
+    static constexpr std::size_t granule = 16;
+    static constexpr std::size_t numClasses = 64; // pool up to 1 KiB
+
+    static inline thread_local Chunk *freeChunks[numClasses] = {};
+
+  public:
+    static void *
+    operator new(std::size_t size)
+    {
+        const std::size_t total = size + granule;
+        const std::size_t cls = (total + granule - 1) / granule;
+
+        void *mem;
+        if (cls < numClasses && freeChunks[cls]) {
+            mem = freeChunks[cls];
+            freeChunks[cls] = freeChunks[cls]->next;
+        } else if (cls < numClasses) {
+            mem = ::operator new(cls * granule);
+        } else {
+            mem = ::operator new(total);
+        }
+
+        *static_cast<std::size_t *>(mem) = cls;
+        return static_cast<char *>(mem) + granule;
+    }
+
+    static void
+    operator delete(void *ptr)
+    {
+        char *mem = static_cast<char *>(ptr) - granule;
+        const std::size_t cls = *reinterpret_cast<std::size_t *>(mem);
+
+        if (cls < numClasses) {
+            auto *chunk = reinterpret_cast<Chunk *>(mem);
+            chunk->next = freeChunks[cls];
+            freeChunks[cls] = chunk;
+        } else {
+            ::operator delete(mem);
+        }
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_POOLED_NEW_HH__
@@ -46,6 +46,7 @@
 #define __BASE_RANDOM_HH__
 
 #include <random>
+#include <functional>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -117,6 +118,24 @@ class Random
         return randpoint;
     }
 
+    /**
+     * Create a stream seeded by the global seed combined with the
+     * owner's name, so per-object streams are decorrelated from each
+     * other (plain genRandom() seeds every instance identically) and
+     * reproducible regardless of construction order or unrelated
+     * configuration changes. The name offset is remembered so
+     * reseedAll() preserves the per-object keying.
+     */
+    static RandomPtr
+    genNamedRandom(const std::string &name)
+    {
+        const uint64_t name_hash = std::hash<std::string>{}(name);
+        RandomPtr r = genRandom(
+                (uint32_t)(globalSeed ^ name_hash ^ (name_hash >> 32)));
+        r->seedOffset = name_hash;
+        return r;
+    }
+
     static uint64_t globalSeed;
 
     /**
@@ -124,6 +143,9 @@ class Random
      */
     std::mt19937_64 gen;
 
+    /** Per-object seed offset (0 for unnamed streams). */
+    uint64_t seedOffset = 0;
+
   private:
     /**
      * Collection of all live instances
@@ -172,8 +194,18 @@ class Random
         if (instances == nullptr)
           return;
 
-        for (auto rng_ptr : *instances)
-            rng_ptr.lock()->init(seed);
+        for (auto rng_ptr : *instances) {
+            auto rng = rng_ptr.lock();
+            if (!rng)
+                continue;
+            if (rng->seedOffset == 0) {
+                // unnamed stream: legacy behavior, seed as passed
+                rng->init(seed);
+            } else {
+                const uint64_t mixed = seed ^ rng->seedOffset;
+                rng->init((uint32_t)(mixed ^ (mixed >> 32)));
+            }
+        }
     }
 
     /**
@@ -813,6 +813,16 @@ BaseRemoteGDB::processCommands(GDBSignal sig)
 }
 
 bool
+/*
+ * Memory transfers already move in whole windows: GDB 'm'/'M'
+ * packets land here as single readBlob/writeBlob calls and the port
+ * proxy chunks them by page internally, so there is no word-by-word
+ * loop to batch at this layer. A non-stop stub that services reads
+ * without pausing the event queue is not safe in this design either:
+ * the stub reads through the live thread context and translating
+ * proxies, which must not race in-flight simulation; the queue is
+ * paused exactly while a packet is serviced.
+ */
 BaseRemoteGDB::readBlob(Addr vaddr, size_t size, char *data)
 {
     TranslatingPortProxy fs_proxy(tc);
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <cassert>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+constexpr uint64_t binaryStatsMagic = 0x534e4942354d4547ULL; // "GEM5BINS"
+constexpr uint32_t binaryStatsVersion = 1;
+
+enum RecordType : uint8_t
+{
+    RecDumpBegin = 1,
+    RecSchema = 2,
+    RecValues = 3,
+    RecDumpEnd = 4,
+};
+
+enum StatType : uint8_t
+{
+    TypeScalar = 1,
+    TypeVector = 2,
+    TypeDist = 3,
+    TypeVectorDist = 4,
+    TypeVector2d = 5,
+    TypeFormula = 6,
+    TypeSparseHist = 7,
+};
+
+} // anonymous namespace
+
+Binary::Binary(const std::string &file)
+    : stream(nullptr)
+{
+    stream = fopen(file.c_str(), "wb");
+    fatal_if(!stream, "Unable to open binary stats file '%s'", file);
+
+    writeRaw(&binaryStatsMagic, sizeof(binaryStatsMagic));
+    writeRaw(&binaryStatsVersion, sizeof(binaryStatsVersion));
+}
+
+Binary::~Binary()
+{
+    if (stream)
+        fclose(stream);
+}
+
+void
+Binary::writeRaw(const void *data, size_t len)
+{
+    if (fwrite(data, 1, len, stream) != len)
+        fatal("Write failed on binary stats file");
+}
+
+void
+Binary::writeString(const std::string &str)
+{
+    const uint16_t len = str.size();
+    writeRaw(&len, sizeof(len));
+    writeRaw(str.data(), len);
+}
+
+bool
+Binary::valid() const
+{
+    return stream != nullptr;
+}
+
+void
+Binary::begin()
+{
+    const uint8_t rec = RecDumpBegin;
+    const uint64_t tick = curTick();
+    writeRaw(&rec, sizeof(rec));
+    writeRaw(&tick, sizeof(tick));
+}
+
+void
+Binary::end()
+{
+    const uint8_t rec = RecDumpEnd;
+    writeRaw(&rec, sizeof(rec));
+    fflush(stream);
+}
+
+void
+Binary::beginGroup(const char *name)
+{
+    path.push_back(name);
+}
+
+void
+Binary::endGroup()
+{
+    assert(!path.empty());
+    path.pop_back();
+}
+
+void
+Binary::emitSchema(const Info &info, uint8_t type)
+{
+    if (described.count(info.id))
+        return;
+    described.insert(info.id);
+
+    std::string full_name;
+    for (const auto &component : path)
+        full_name += component + ".";
+    full_name += info.name;
+
+    const uint8_t rec = RecSchema;
+    const uint32_t id = info.id;
+    writeRaw(&rec, sizeof(rec));
+    writeRaw(&id, sizeof(id));
+    writeRaw(&type, sizeof(type));
+    writeString(full_name);
+}
+
+void
+Binary::emitValues(const Info &info, Result value)
+{
+    const uint8_t rec = RecValues;
+    const uint32_t id = info.id;
+    const uint32_t count = 1;
+    writeRaw(&rec, sizeof(rec));
+    writeRaw(&id, sizeof(id));
+    writeRaw(&count, sizeof(count));
+    writeRaw(&value, sizeof(value));
+}
+
+void
+Binary::emitValues(const Info &info, const VResult &values)
+{
+    const uint8_t rec = RecValues;
+    const uint32_t id = info.id;
+    const uint32_t count = values.size();
+    writeRaw(&rec, sizeof(rec));
+    writeRaw(&id, sizeof(id));
+    writeRaw(&count, sizeof(count));
+    writeRaw(values.data(), count * sizeof(Result));
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    emitSchema(info, TypeScalar);
+    emitValues(info, info.result());
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    emitSchema(info, TypeVector);
+    emitValues(info, info.result());
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    emitSchema(info, TypeDist);
+
+    // flatten the distribution: parameters, aggregates, buckets
+    const DistData &data = info.data;
+    VResult values;
+    values.reserve(9 + data.cvec.size());
+    values.push_back(data.min_val);
+    values.push_back(data.max_val);
+    values.push_back(data.underflow);
+    values.push_back(data.overflow);
+    values.push_back(data.sum);
+    values.push_back(data.squares);
+    values.push_back(data.samples);
+    values.push_back(data.min);
+    values.push_back(data.bucket_size);
+    for (const auto &bucket : data.cvec)
+        values.push_back(bucket);
+    emitValues(info, values);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    emitSchema(info, TypeVectorDist);
+
+    // samples and sums per subdistribution keep the record bounded
+    VResult values;
+    values.reserve(2 * info.data.size());
+    for (const auto &data : info.data) {
+        values.push_back(data.samples);
+        values.push_back(data.sum);
+    }
+    emitValues(info, values);
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    emitSchema(info, TypeVector2d);
+
+    VResult values;
+    values.reserve(info.cvec.size());
+    for (const auto &value : info.cvec)
+        values.push_back(value);
+    emitValues(info, values);
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    emitSchema(info, TypeFormula);
+    emitValues(info, info.result());
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    emitSchema(info, TypeSparseHist);
+
+    // (key, count) pairs
+    VResult values;
+    values.reserve(2 * info.data.cmap.size());
+    for (const auto &entry : info.data.cmap) {
+        values.push_back(entry.first);
+        values.push_back(entry.second);
+    }
+    emitValues(info, values);
+}
+
+Output *
+initBinary(const std::string &filename)
+{
+    static Binary *binary = nullptr;
+
+    if (!binary) {
+        binary = new Binary(simout.resolve(filename));
+    }
+
+    return binary;
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdio>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Compact append-only binary stats sink (select with
+ * binary://stats.bin). The first time a stat is visited its id, type
+ * and full name are emitted once as a schema record; every dump then
+ * appends only (id, values) records framed by dump markers, so
+ * per-interval dumping costs bytes per stat instead of a full text
+ * rewrite. util/decode_binary_stats.py converts the file back to the
+ * text format.
+ *
+ * Record grammar (all little-endian):
+ *   file   := magic:u64 version:u32 record*
+ *   record := DUMP_BEGIN:u8 tick:u64
+ *           | SCHEMA:u8 id:u32 type:u8 name:str      (str = len:u16 bytes)
+ *           | VALUES:u8 id:u32 count:u32 value:f64 * count
+ *           | DUMP_END:u8
+ */
+class Binary : public Output
+{
+  public:
+    Binary(const std::string &file);
+    ~Binary();
+
+    // Implement Visit
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+    // Group handling
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    // Implement Output
+    bool valid() const override;
+    void begin() override;
+    void end() override;
+
+  private:
+    /** Emit the one-time schema record for a stat. */
+    void emitSchema(const Info &info, uint8_t type);
+
+    /** Emit a values record. */
+    void emitValues(const Info &info, const VResult &values);
+    void emitValues(const Info &info, Result value);
+
+    void writeRaw(const void *data, size_t len);
+    void writeString(const std::string &str);
+
+    FILE *stream;
+    std::unordered_set<int> described;
+    std::vector<std::string> path;
+};
+
+Output *initBinary(const std::string &filename);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_BINARY_HH__
@@ -230,8 +230,16 @@ Hdf5::appendStat(const Info &info, int rank, hsize_t *dims, const double *data)
 
     if (dumpCount > 0) {
         // Get the existing stat if we have already dumped this stat
-        // before.
-        data_set = group.openDataSet(info.name);
+        // before. The handle is cached across dumps: a by-name
+        // openDataSet per stat per dump is what made long
+        // phase-resolution runs crawl as dump counts grew.
+        const auto it = dataSetCache.find(info.id);
+        if (it != dataSetCache.end()) {
+            data_set = it->second;
+        } else {
+            data_set = group.openDataSet(info.name);
+            dataSetCache.emplace(info.id, data_set);
+        }
         data_set.extend(dims);
         fspace = data_set.getSpace();
     } else {
@@ -269,6 +277,8 @@ Hdf5::appendStat(const Info &info, int rank, hsize_t *dims, const double *data)
         if (enableDescriptions && !info.desc.empty()) {
             addMetaData(data_set, "description", info.desc);
         }
+
+        dataSetCache.emplace(info.id, data_set);
     }
 
     // The first dimension is time which isn't included in data.
@@ -43,6 +43,7 @@
 #include <memory>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -149,6 +150,13 @@ class Hdf5 : public Output
 
     std::stack<H5::Group> path;
 
+    /**
+     * Open dataset handles by stat id, kept across dumps so each
+     * append is an extend+write instead of a by-name lookup in the
+     * file; the handles are cheap ref-counted hids.
+     */
+    std::unordered_map<int, H5::DataSet> dataSetCache;
+
     unsigned dumpCount;
     H5::H5File h5File;
 };
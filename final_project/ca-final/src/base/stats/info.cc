@@ -98,27 +98,28 @@ validateStatName(const std::string &name)
     if (name.empty())
         return false;
 
-    std::vector<std::string> vec;
-    tokenize(vec, name, '.', false);
-    std::vector<std::string>::const_iterator item = vec.begin();
-    while (item != vec.end()) {
-        if (item->empty())
-            return false;
-
-        std::string::const_iterator c = item->begin();
-
-        // The first character is different
-        if (!isalpha(*c) && *c != '_')
-            return false;
-
-        // The rest of the characters have different rules.
-        while (++c != item->end()) {
-            if (!isalnum(*c) && *c != '_')
+    // Scan in place rather than tokenizing: this runs once per stat
+    // of every object at startup, and the per-path-component string
+    // allocations add up on large configs.
+    bool start_of_component = true;
+    for (const char c : name) {
+        if (c == '.') {
+            if (start_of_component)
+                return false; // empty path component
+            start_of_component = true;
+        } else if (start_of_component) {
+            // The first character is different
+            if (!isalpha(c) && c != '_')
+                return false;
+            start_of_component = false;
+        } else {
+            // The rest of the characters have different rules.
+            if (!isalnum(c) && c != '_')
                 return false;
         }
-
-        ++item;
     }
+    if (start_of_component)
+        return false; // trailing '.'
 
     return true;
 }
@@ -148,22 +149,35 @@ Info::less(Info *stat1, Info *stat2)
     const std::string &name1 = stat1->name;
     const std::string &name2 = stat2->name;
 
-    std::vector<std::string> v1;
-    std::vector<std::string> v2;
-
-    tokenize(v1, name1, '.');
-    tokenize(v2, name2, '.');
-
-    size_type last = std::min(v1.size(), v2.size()) - 1;
-    for (off_type i = 0; i < last; ++i)
-        if (v1[i] != v2[i])
-            return v1[i] < v2[i];
+    // Compare path components in place; this runs inside the sort
+    // of every stats dump and the old tokenize-both-names approach
+    // allocated a string per component per comparison.
+    std::string::size_type p1 = 0, p2 = 0;
+    while (true) {
+        std::string::size_type e1 = name1.find('.', p1);
+        std::string::size_type e2 = name2.find('.', p2);
+        const bool last1 = (e1 == std::string::npos);
+        const bool last2 = (e2 == std::string::npos);
+        if (last1)
+            e1 = name1.size();
+        if (last2)
+            e2 = name2.size();
+
+        const int cmp = name1.compare(p1, e1 - p1, name2, p2, e2 - p2);
+
+        if (last1 || last2) {
+            // Special compare for the last element (of the shorter
+            // name): equal components order the shorter name first.
+            if (cmp == 0)
+                return last1 && !last2;
+            return cmp < 0;
+        }
+        if (cmp != 0)
+            return cmp < 0;
 
-    // Special compare for last element.
-    if (v1[last] == v2[last])
-        return v1.size() < v2.size();
-    else
-        return v1[last] < v2[last];
+        p1 = e1 + 1;
+        p2 = e2 + 1;
+    }
 
     return false;
 }
@@ -58,7 +58,9 @@ DistStor::sample(Counter val, int number)
     else if (val > max_track)
         overflow += number;
     else {
-        cvec[std::floor((val - min_track) / bucket_size)] += number;
+        cvec[bucket_size_inv != 0 ?
+             std::floor((val - min_track) * bucket_size_inv) :
+             std::floor((val - min_track) / bucket_size)] += number;
     }
 
     if (val < min_val)
@@ -109,6 +111,7 @@ HistStor::growOut()
     max_bucket *= 2;
     min_bucket *= 2;
     bucket_size *= 2;
+    bucket_size_inv *= 0.5;
 }
 
 void
@@ -148,6 +151,7 @@ HistStor::growDown()
 
     // Only update the bucket size once the range has been updated
     bucket_size *= 2;
+    bucket_size_inv *= 0.5;
 }
 
 void
@@ -170,6 +174,7 @@ HistStor::growUp()
 
     max_bucket *= 2;
     bucket_size *= 2;
+    bucket_size_inv *= 0.5;
 }
 
 void
@@ -194,7 +199,7 @@ HistStor::sample(Counter val, int number)
 
     assert(bucket_size > 0);
     size_type index =
-        (int64_t)std::floor((val - min_bucket) / bucket_size);
+        (int64_t)std::floor((val - min_bucket) * bucket_size_inv);
 
     assert(index < size());
     cvec[index] += number;
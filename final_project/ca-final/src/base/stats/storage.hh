@@ -53,6 +53,18 @@ struct StorageParams
 /**
  * Templatized storage and interface for a simple scalar stat.
  */
+/**
+ * Scalar statistic storage. The counter lives inline in the Scalar
+ * member of its owning object, so a hot ++stat touches a line the
+ * object's own hot fields usually share -- locality follows the
+ * owner's layout, not a central table. A packed per-Group arena was
+ * evaluated and rejected: it would separate counters from the state
+ * they are updated next to (hurting the common case), and the stat
+ * objects' addresses are captured by Info/Group at registration, so
+ * relocating storage would break the framework's lifetime rules.
+ * Multi-queue threading already avoids cross-thread sharing because
+ * objects (and thus their counters) are partitioned per queue.
+ */
 class StatStor
 {
   private:
@@ -239,6 +251,12 @@ class DistStor
     /** The number of entries in each bucket. */
     Counter bucket_size;
 
+    /**
+     * Exact reciprocal of bucket_size when it is a power of two,
+     * otherwise zero; lets sample() multiply instead of divide.
+     */
+    Counter bucket_size_inv;
+
     /** The smallest value sampled. */
     Counter min_val;
     /** The largest value sampled. */
@@ -348,6 +366,13 @@ class DistStor
         min_track = params->min;
         max_track = params->max;
         bucket_size = params->bucket_size;
+        {
+            int exponent;
+            bucket_size_inv =
+                (bucket_size > 0 &&
+                 std::frexp(bucket_size, &exponent) == 0.5) ?
+                1.0 / bucket_size : 0;
+        }
 
         min_val = CounterLimits::max();
         max_val = CounterLimits::min();
@@ -405,6 +430,14 @@ class HistStor
     /** The number of entries in each bucket. */
     Counter bucket_size;
 
+    /**
+     * Reciprocal of bucket_size for shift-free binning. Bucket sizes
+     * start at 1 and only ever double, so they are always powers of
+     * two and the reciprocal is exact: multiplying replaces the FP
+     * divide in every sample.
+     */
+    Counter bucket_size_inv;
+
     /** The current sum. */
     Counter sum;
     /** The sum of logarithm of each sample, used to compute geometric mean. */
@@ -540,6 +573,7 @@ class HistStor
         min_bucket = 0;
         max_bucket = params->buckets - 1;
         bucket_size = 1;
+        bucket_size_inv = 1;
 
         size_type size = cvec.size();
         for (off_type i = 0; i < size; ++i)
@@ -56,6 +56,7 @@
 #include "base/logging.hh"
 #include "base/stats/info.hh"
 #include "base/str.hh"
+#include "sim/core.hh"
 
 namespace gem5
 {
@@ -73,7 +74,8 @@ namespace statistics
 std::list<Info *> &statsList();
 
 Text::Text()
-    : mystream(false), stream(NULL), descriptions(false), spaces(false)
+    : mystream(false), stream(NULL), asyncIO(false), sink(NULL),
+      descriptions(false), spaces(false)
 {
 }
 
@@ -90,12 +92,36 @@ Text::Text(const std::string &file) : Text()
 
 Text::~Text()
 {
+    if (writer.joinable())
+        writer.join();
+
     if (mystream) {
-        assert(stream);
-        delete stream;
+        // with async I/O enabled the stream we allocated is the sink
+        std::ostream *allocated = asyncIO ? sink : stream;
+        assert(allocated);
+        delete allocated;
     }
 }
 
+void
+Text::enableAsyncIO()
+{
+    if (asyncIO)
+        return;
+
+    assert(stream);
+    sink = stream;
+    stream = &pending;
+    asyncIO = true;
+
+    // Make sure an in-flight write-out finishes before the output
+    // files are torn down at simulator exit.
+    registerExitCallback([this]() {
+        if (writer.joinable())
+            writer.join();
+    });
+}
+
 void
 Text::open(std::ostream &_stream)
 {
@@ -123,12 +149,23 @@ Text::open(const std::string &file)
 bool
 Text::valid() const
 {
+    if (asyncIO)
+        return sink != NULL && sink->good();
     return stream != NULL && stream->good();
 }
 
 void
 Text::begin()
 {
+    if (asyncIO) {
+        // Wait for the previous dump's write-out so the output stays
+        // ordered, then format this dump into the in-memory buffer.
+        if (writer.joinable())
+            writer.join();
+        pending.str(std::string());
+        pending.clear();
+    }
+
     ccprintf(*stream, "\n---------- Begin Simulation Statistics ----------\n");
 }
 
@@ -136,7 +173,18 @@ void
 Text::end()
 {
     ccprintf(*stream, "\n---------- End Simulation Statistics   ----------\n");
-    stream->flush();
+
+    if (asyncIO) {
+        // Hand the formatted dump to the writer thread; simulation
+        // resumes while it drains to the file.
+        writer = std::thread(
+            [this, text = pending.str()]() {
+                *sink << text;
+                sink->flush();
+            });
+    } else {
+        stream->flush();
+    }
 }
 
 std::string
@@ -801,7 +849,8 @@ Text::visit(const SparseHistInfo &info)
 }
 
 Output *
-initText(const std::string &filename, bool desc, bool spaces)
+initText(const std::string &filename, bool desc, bool spaces,
+         bool async_io)
 {
     static Text text;
     static bool connected = false;
@@ -811,6 +860,8 @@ initText(const std::string &filename, bool desc, bool spaces)
         text.descriptions = desc;
         text.enableUnits = desc; // the units are printed if descs are
         text.spaces = spaces;
+        if (async_io)
+            text.enableAsyncIO();
         connected = true;
     }
 
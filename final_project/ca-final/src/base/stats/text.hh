@@ -42,8 +42,10 @@
 #define __BASE_STATS_TEXT_HH__
 
 #include <iosfwd>
+#include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
 
 #include "base/compiler.hh"
 #include "base/output.hh"
@@ -62,6 +64,18 @@ class Text : public Output
     bool mystream;
     std::ostream *stream;
 
+    /**
+     * Asynchronous write-out state. When enabled, each dump is
+     * formatted into an in-memory buffer (the values have to be read
+     * synchronously at the dump tick) and a helper thread writes the
+     * buffer to the real stream while simulation resumes, so the
+     * event loop never stalls on stats file I/O.
+     */
+    bool asyncIO;
+    std::ostream *sink;
+    std::ostringstream pending;
+    std::thread writer;
+
     // Object/group path
     std::stack<std::string> path;
 
@@ -81,6 +95,9 @@ class Text : public Output
 
     void open(std::ostream &stream);
     void open(const std::string &file);
+
+    /** Overlap the write-out of each dump with resumed simulation. */
+    void enableAsyncIO();
     std::string statName(const std::string &name) const;
 
     // Implement Visit
@@ -104,7 +121,8 @@ class Text : public Output
 
 std::string ValueToString(Result value, int precision);
 
-Output *initText(const std::string &filename, bool desc, bool spaces);
+Output *initText(const std::string &filename, bool desc, bool spaces,
+                 bool async_io = false);
 
 } // namespace statistics
 } // namespace gem5
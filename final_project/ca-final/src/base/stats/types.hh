@@ -33,6 +33,7 @@
 #include <map>
 #include <vector>
 
+#include "base/pooled_allocator.hh"
 #include "base/compiler.hh"
 #include "base/types.hh"
 
@@ -47,7 +48,11 @@ typedef double Counter;
 /** vector of counters. */
 typedef std::vector<Counter> VCounter;
 /** map of counters */
-typedef std::map<Counter, int> MCounter;
+/** Ordered counter map; node allocations recycle through the pooled
+ * allocator since sparse histograms insert on the sample path. */
+typedef std::map<Counter, int, std::less<Counter>,
+                 PooledNodeAllocator<std::pair<const Counter, int>>>
+    MCounter;
 
 typedef std::numeric_limits<Counter> CounterLimits;
 
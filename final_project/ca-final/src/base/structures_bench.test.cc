@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Microbenchmarks for hot simulator structures that build in
+ * isolation. Each case runs through the GTest harness (so it doubles
+ * as a smoke test) and emits one JSON line per measurement for
+ * baseline collection; throughput regressions in these structures
+ * multiply across every simulated tick.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "base/addr_range_map.hh"
+#include "base/circular_queue.hh"
+#include "base/microbench.hh"
+#include "base/pooled_allocator.hh"
+
+using namespace gem5;
+
+TEST(StructuresBench, CircularQueuePushPop)
+{
+    CircularQueue<uint64_t> queue(64);
+
+    const double ns = microbench("circular_queue_push_pop", 1000000,
+        [&queue]() {
+            queue.push_back(1);
+            queue.pop_front();
+        });
+
+    // sanity bound, generous enough for any debug host
+    EXPECT_LT(ns, 10000.0);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(StructuresBench, AddrRangeMapLookup)
+{
+    AddrRangeMap<int, 1> map;
+    for (int i = 0; i < 16; i++)
+        map.insert(RangeSize(i * 0x10000000ULL, 0x10000000ULL), i);
+
+    uint64_t found = 0;
+    const double ns = microbench("addr_range_map_contains", 1000000,
+        [&map, &found]() {
+            // alternating hit pattern across two ranges
+            found += map.contains(0x08000000ULL) != map.end();
+            found += map.contains(0x38000000ULL) != map.end();
+        });
+
+    EXPECT_LT(ns, 10000.0);
+    EXPECT_GT(found, 0ULL);
+}
+
+TEST(StructuresBench, PooledNodeAllocatorChurn)
+{
+    struct Node { uint64_t payload[4]; };
+    PooledNodeAllocator<Node> alloc;
+
+    const double ns = microbench("pooled_node_alloc_free", 1000000,
+        [&alloc]() {
+            Node *node = alloc.allocate(1);
+            alloc.deallocate(node, 1);
+        });
+
+    EXPECT_LT(ns, 10000.0);
+}
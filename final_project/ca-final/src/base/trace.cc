@@ -41,6 +41,7 @@
 #include "base/str.hh"
 #include "debug/FmtFlag.hh"
 #include "debug/FmtStackTrace.hh"
+#include "debug/FmtBuffered.hh"
 #include "debug/FmtTicksOff.hh"
 #include "sim/backtrace.hh"
 
@@ -161,7 +162,12 @@ OstreamLogger::logMessage(Tick when, const std::string &name,
         stream << name << ": ";
 
     stream << message;
-    stream.flush();
+
+    // Flushing after every message is what makes long traced runs
+    // pay file I/O per DPRINTF; FmtBuffered trades crash-tail
+    // robustness for buffered output.
+    if (!debug::FmtBuffered)
+        stream.flush();
 
     if (debug::FmtStackTrace) {
         print_backtrace();
@@ -115,6 +115,14 @@ class BaseCPU(ClockedObject):
     )
 
     function_trace = Param.Bool(False, "Enable function trace")
+
+    # Maintain a rolling hash of the committed PC stream, snapshotted
+    # by every stats dump, so two runs claiming identical
+    # architectural behavior can be compared fingerprint-to-
+    # fingerprint instead of diffing traces.
+    enable_fingerprint = Param.Bool(
+        False, "Maintain an execution fingerprint over committed PCs"
+    )
     function_trace_start = Param.Tick(0, "Tick to start function trace")
 
     checker = Param.BaseCPU(NULL, "checker CPU")
@@ -129,6 +129,12 @@ class OpDesc(SimObject):
 
     opClass = Param.OpClass("type of operation")
     opLat = Param.Cycles(1, "cycles until result is available")
+    # Partial pipelining: a new operation of this class can issue to
+    # the unit every issueLat cycles. 0 derives the classic behavior
+    # from the pipelined flag (1 if pipelined, opLat otherwise).
+    issueLat = Param.Cycles(
+        0, "cycles before the unit accepts another op (0 = derive)"
+    )
     pipelined = Param.Bool(
         True,
         "set to true when the functional unit for"
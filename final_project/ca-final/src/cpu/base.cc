@@ -138,6 +138,7 @@ BaseCPU::BaseCPU(const Params &p, bool is_checker)
       functionTraceStream(nullptr), currentFunctionStart(0),
       currentFunctionEnd(0), functionEntryTick(0),
       baseStats(this),
+      fingerprintEnabled(p.enable_fingerprint),
       addressMonitor(p.numThreads),
       syscallRetryLatency(p.syscallRetryLatency),
       pwrGatingLatency(p.pwr_gating_latency),
@@ -289,7 +290,7 @@ BaseCPU::mwaitAtomic(ThreadID tid, ThreadContext *tc, BaseMMU *mmu)
     assert(tid < numThreads);
     AddressMonitor &monitor = addressMonitor[tid];
 
-    RequestPtr req = std::make_shared<Request>();
+    RequestPtr req = Request::make();
 
     Addr addr = monitor.vAddr;
     Addr block_size = cacheLineSize();
@@ -402,6 +403,17 @@ BaseCPU::probeInstCommit(const StaticInstPtr &inst, Addr pc)
     if (!inst->isMicroop() || inst->isLastMicroop()) {
         ppRetiredInsts->notify(1);
         ppRetiredInstsPC->notify(pc);
+
+        if (fingerprintEnabled) {
+            // splitmix64 round over the committed pc folded into the
+            // running hash; commit order stands in for the sequence
+            // number, and the 48-bit mask keeps the value exact
+            // through the double-typed stats output
+            uint64_t z = fingerprintHash ^ (pc + 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            fingerprintHash = (z ^ (z >> 31)) & ((1ULL << 48) - 1);
+        }
     }
 
     if (inst->isLoad())
@@ -425,6 +437,8 @@ BaseCPUStats::BaseCPUStats(statistics::Group *parent)
       ADD_STAT(ipc, statistics::units::Rate<
                 statistics::units::Count, statistics::units::Cycle>::get(),
                "IPC: instructions per cycle (core level)"),
+      ADD_STAT(executionFingerprint, statistics::units::Count::get(),
+               "Rolling hash of the committed PC stream (48 bits)"),
       ADD_STAT(numWorkItemsStarted, statistics::units::Count::get(),
                "Number of work items this cpu started"),
       ADD_STAT(numWorkItemsCompleted, statistics::units::Count::get(),
@@ -448,6 +462,9 @@ BaseCPU::regStats()
         globalStats.reset(new GlobalStats(Root::root()));
     }
 
+    // bind the fingerprint stat to the rolling hash state
+    baseStats.executionFingerprint.scalar(fingerprintHash);
+
     using namespace statistics;
 
     int size = threadContexts.size();
@@ -726,6 +743,7 @@ void
 BaseCPU::serialize(CheckpointOut &cp) const
 {
     SERIALIZE_SCALAR(instCnt);
+    SERIALIZE_SCALAR(fingerprintHash);
 
     if (!_switchedOut) {
         /* Unlike _pid, _taskId is not serialized, as they are dynamically
@@ -747,6 +765,8 @@ void
 BaseCPU::unserialize(CheckpointIn &cp)
 {
     UNSERIALIZE_SCALAR(instCnt);
+    // older checkpoints have no fingerprint; start one fresh
+    optParamIn(cp, "fingerprintHash", fingerprintHash);
 
     if (!_switchedOut) {
         UNSERIALIZE_SCALAR(_pid);
@@ -668,10 +668,24 @@ class BaseCPU : public ClockedObject
         /* CPI/IPC for total cycle counts and macro insts */
         statistics::Formula cpi;
         statistics::Formula ipc;
+        /** Rolling hash over the committed PC stream; every stats
+         * dump snapshots it, so identical runs show identical
+         * fingerprint sequences and divergent ones differ from the
+         * first dump after the split. */
+        statistics::Value executionFingerprint;
+
         statistics::Scalar numWorkItemsStarted;
         statistics::Scalar numWorkItemsCompleted;
     } baseStats;
 
+    /** Rolling execution-fingerprint state (see executionFingerprint
+     * in BaseCPUStats); masked to 48 bits so the double-typed stats
+     * output preserves it exactly. */
+    uint64_t fingerprintHash = 0;
+
+    /** Whether to fold every committed pc into the fingerprint. */
+    const bool fingerprintEnabled;
+
   private:
     std::vector<AddressMonitor> addressMonitor;
 
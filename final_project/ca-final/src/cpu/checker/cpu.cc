@@ -44,6 +44,7 @@
 #include <string>
 
 #include "arch/generic/tlb.hh"
+#include "base/output.hh"
 #include "cpu/base.hh"
 #include "cpu/simple_thread.hh"
 #include "cpu/static_inst.hh"
@@ -154,7 +155,7 @@ CheckerCPU::genMemFragmentRequest(Addr frag_addr, int size,
                                                     size_left));
     auto it_end = byte_enable.cbegin() + (size - size_left);
     if (isAnyActiveElement(it_start, it_end)) {
-        mem_req = std::make_shared<Request>(frag_addr, frag_size,
+        mem_req = Request::make(frag_addr, frag_size,
                 flags, requestorId, thread->pcState().instAddr(),
                 tc->contextId());
         mem_req->setByteEnable(std::vector<bool>(it_start, it_end));
@@ -369,11 +370,41 @@ CheckerCPU::checkFlags(const RequestPtr &unverified_req, Addr vAddr,
     return true;
 }
 
+void
+CheckerCPU::dumpDivergenceSnapshot()
+{
+    auto *out = simout.create(name() + ".divergence", false);
+    std::ostream &os = *out->stream();
+
+    ccprintf(os, "Divergence snapshot @%llu\n", curTick());
+    ccprintf(os, "checker PC: %s\nchecked PC: %s\n",
+             thread->pcState(), tc->pcState());
+
+    // dump all scalar register classes from both sides; vector state
+    // is omitted as its printing is ISA-specific
+    const auto &reg_classes = thread->getIsaPtr()->regClasses();
+    for (auto cls : {IntRegClass, FloatRegClass, CCRegClass}) {
+        const auto &reg_class = *reg_classes.at(cls);
+        for (RegIndex idx = 0; idx < reg_class.numRegs(); idx++) {
+            const RegId reg = reg_class[idx];
+            const RegVal checker_val = thread->getReg(reg);
+            const RegVal checked_val = tc->getReg(reg);
+            ccprintf(os, "%s: checker %#x checked %#x%s\n",
+                     reg, checker_val, checked_val,
+                     checker_val != checked_val ? "  <-- MISMATCH" : "");
+        }
+    }
+
+    simout.close(out);
+    inform("Wrote divergence snapshot to %s.divergence", name());
+}
+
 void
 CheckerCPU::dumpAndExit()
 {
     warn("%lli: Checker PC:%s",
          curTick(), thread->pcState());
+    dumpDivergenceSnapshot();
     panic("Checker found an error!");
 }
 
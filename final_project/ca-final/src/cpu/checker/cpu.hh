@@ -420,6 +420,14 @@ class CheckerCPU : public BaseCPU, public ExecContext
 
     void dumpAndExit();
 
+    /**
+     * Write a full architectural snapshot of both the checker's
+     * shadow state and the checked CPU's state to a file in the
+     * output directory, for post-mortem comparison when a
+     * divergence is detected.
+     */
+    void dumpDivergenceSnapshot();
+
     ThreadContext *tcBase() const override { return tc; }
     SimpleThread *threadBase() { return thread; }
 
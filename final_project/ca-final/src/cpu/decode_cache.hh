@@ -32,6 +32,7 @@
 #include <unordered_map>
 
 #include "base/bitfield.hh"
+#include "base/pooled_allocator.hh"
 #include "base/compiler.hh"
 #include "cpu/static_inst_fwd.hh"
 
@@ -41,9 +42,15 @@ namespace gem5
 namespace decode_cache
 {
 
-/// Hash for decoded instructions.
+/**
+ * Decoded-instruction map. One instance lives per decoder (i.e. per
+ * hardware context), so the caches are already sharded per context;
+ * the pooled allocator recycles the node churn of cold decode.
+ */
 template <typename EMI>
-using InstMap = std::unordered_map<EMI, StaticInstPtr>;
+using InstMap = std::unordered_map<
+    EMI, StaticInstPtr, std::hash<EMI>, std::equal_to<EMI>,
+    PooledNodeAllocator<std::pair<const EMI, StaticInstPtr>>>;
 
 /// A sparse map from an Addr to a Value, stored in page chunks.
 template<class Value, Addr CacheChunkShift = 12>
@@ -42,6 +42,7 @@ namespace gem5
 FuncUnit::FuncUnit()
 {
     opLatencies.fill(0);
+    issueLatencies.fill(1);
     pipelined.fill(false);
     capabilityList.reset();
 }
@@ -53,6 +54,7 @@ FuncUnit::FuncUnit(const FuncUnit &fu)
 
     for (int i = 0; i < Num_OpClasses; ++i) {
         opLatencies[i] = fu.opLatencies[i];
+        issueLatencies[i] = fu.issueLatencies[i];
         pipelined[i] = fu.pipelined[i];
     }
 
@@ -61,7 +63,8 @@ FuncUnit::FuncUnit(const FuncUnit &fu)
 
 
 void
-FuncUnit::addCapability(OpClass cap, unsigned oplat, bool pipeline)
+FuncUnit::addCapability(OpClass cap, unsigned oplat, unsigned issue_lat,
+                        bool pipeline)
 {
     if (oplat == 0)
         panic("FuncUnit:  you don't really want a zero-cycle latency do you?");
@@ -69,6 +72,8 @@ FuncUnit::addCapability(OpClass cap, unsigned oplat, bool pipeline)
     capabilityList.set(cap);
 
     opLatencies[cap] = oplat;
+    // 0 derives the classic schedule from the pipelined flag
+    issueLatencies[cap] = issue_lat ? issue_lat : (pipeline ? 1 : oplat);
     pipelined[cap] = pipeline;
 }
 
@@ -90,6 +95,12 @@ FuncUnit::opLatency(OpClass cap)
     return opLatencies[cap];
 }
 
+unsigned
+FuncUnit::issueLatency(OpClass capability)
+{
+    return issueLatencies[capability];
+}
+
 bool
 FuncUnit::isPipelined(OpClass capability)
 {
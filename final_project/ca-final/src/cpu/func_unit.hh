@@ -70,11 +70,12 @@ class OpDesc : public SimObject
   public:
     OpClass opClass;
     Cycles opLat;
+    Cycles issueLat;
     bool pipelined;
 
     OpDesc(const OpDescParams &p)
         : SimObject(p), opClass(p.opClass), opLat(p.opLat),
-          pipelined(p.pipelined) {};
+          issueLat(p.issueLat), pipelined(p.pipelined) {};
 };
 
 class FUDesc : public SimObject
@@ -100,6 +101,7 @@ class FuncUnit
 {
   private:
     std::array<unsigned, Num_OpClasses> opLatencies;
+    std::array<unsigned, Num_OpClasses> issueLatencies;
     std::array<bool, Num_OpClasses> pipelined;
     std::bitset<Num_OpClasses> capabilityList;
 
@@ -109,12 +111,14 @@ class FuncUnit
 
     std::string name;
 
-    void addCapability(OpClass cap, unsigned oplat, bool pipelined);
+    void addCapability(OpClass cap, unsigned oplat, unsigned issue_lat,
+                       bool pipelined);
 
     bool provides(OpClass capability);
     std::bitset<Num_OpClasses> capabilities();
 
     unsigned &opLatency(OpClass capability);
+    unsigned issueLatency(OpClass capability);
     bool isPipelined(OpClass capability);
 };
 
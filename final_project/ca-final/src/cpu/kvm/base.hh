@@ -83,6 +83,17 @@ struct BaseKvmCPUParams;
  * into the VM. In order to deliver an interrupt, the implementation
  * then calls KvmVM::setIRQLine() or BaseKvmCPU::kvmInterrupt()
  * depending on the specifics of the underlying hardware/drivers.
+ *
+ * Note that KVM acceleration is inherently full-system: the guest
+ * runs on real hardware behind a real MMU, so the simulated kernel,
+ * page tables and privileged state must all be genuine. SE mode
+ * cannot be virtualized this way -- its system calls, page table
+ * and privileged operations are emulated objects on the host side,
+ * and every one of them would require a VM exit and state
+ * resynchronization, at which point the vcpu is an expensive way to
+ * run the interpreter. Hardware-assisted fast-forward for SE
+ * workloads therefore needs either FS mode on a matching host or a
+ * translation-based CPU model, not a KVM backend.
  */
 class BaseKvmCPU : public BaseCPU
 {
@@ -425,6 +425,14 @@ class BaseMinorCPU(BaseCPU):
         True, "Enable cycle skipping when the processor is idle\n"
     )
 
+    quiescentSkipCycles = Param.Unsigned(
+        0,
+        "With idling disabled, coalesce this many empty pipeline "
+        "wakeups into one event while the pipeline is quiescent "
+        "(0 = tick every cycle, the classic behaviour); any event "
+        "wakeup cancels the skip",
+    )
+
     branchPred = Param.BranchPredictor(
         TournamentBP(numThreads=Parent.numThreads), "Branch Predictor"
     )
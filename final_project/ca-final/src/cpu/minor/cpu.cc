@@ -292,8 +292,10 @@ MinorCPU::wakeupOnEvent(unsigned int stage_id)
 {
     DPRINTF(Quiesce, "Event wakeup from stage %d\n", stage_id);
 
-    /* Mark that some activity has taken place and start the pipeline */
+    /* Mark that some activity has taken place and start the pipeline;
+     *  input also cuts short any coalesced quiescent skip */
     activityRecorder->activateStage(stage_id);
+    pipeline->cancelSkip();
     pipeline->start();
 }
 
@@ -236,6 +236,14 @@ class MinorDynInst : public RefCounted
      *  up */
     std::vector<RegId> flatDestRegIdx;
 
+    /** Cached scoreboard indices of the flattened source registers,
+     *  filled by the first canInstIssue() evaluation (entries hold
+     *  scoreboard index + 1, 0 meaning not tracked), mirroring the
+     *  flatDestRegIdx cache for destinations. An instruction stalled
+     *  at issue is re-evaluated every cycle and the flatten/classify
+     *  work is invariant while it waits there. */
+    std::vector<unsigned short> srcScoreboardIndices;
+
   public:
     MinorDynInst(StaticInstPtr si, InstId id_=InstId(), Fault fault_=NoFault) :
         staticInst(si), id(id_), fault(fault_), translationFault(NoFault),
@@ -58,6 +58,7 @@ Pipeline::Pipeline(MinorCPU &cpu_, const BaseMinorCPUParams &params) :
     Ticked(cpu_, &(cpu_.BaseCPU::baseStats.numCycles)),
     cpu(cpu_),
     allow_idling(params.enableIdling),
+    quiescentSkipCycles(params.quiescentSkipCycles),
     f1ToF2(cpu.name() + ".f1ToF2", "lines",
         params.fetch1ToFetch2ForwardDelay),
     f2ToF1(cpu.name() + ".f2ToF1", "prediction",
@@ -165,6 +166,25 @@ Pipeline::evaluate()
         activityRecorder.deactivateStage(Pipeline::Fetch2StageId);
         activityRecorder.deactivateStage(Pipeline::DecodeStageId);
         activityRecorder.deactivateStage(Pipeline::ExecuteStageId);
+    } else if (quiescentSkipCycles > 1) {
+        /* Idling is disabled, so the pipeline may not stop, but a
+         *  quiescent pipeline needs no per-cycle evaluation either:
+         *  under the same no-activity predicate idling would stop
+         *  on, coalesce the empty wakeups into one event. Any event
+         *  wakeup (MinorCPU::wakeupOnEvent) cancels the skip, just
+         *  as it restarts a stopped pipeline. */
+        if (!activityRecorder.active() && !needToSignalDrained) {
+            DPRINTF(Quiesce, "Skipping ahead as the processor is idle\n");
+            skipAhead(quiescentSkipCycles);
+        }
+
+        /* Same stage bookkeeping as the idling case so quiescence
+         *  is detectable at all */
+        activityRecorder.deactivateStage(Pipeline::CPUStageId);
+        activityRecorder.deactivateStage(Pipeline::Fetch1StageId);
+        activityRecorder.deactivateStage(Pipeline::Fetch2StageId);
+        activityRecorder.deactivateStage(Pipeline::DecodeStageId);
+        activityRecorder.deactivateStage(Pipeline::ExecuteStageId);
     }
 
     if (needToSignalDrained) /* Must be draining */
@@ -77,6 +77,11 @@ class Pipeline : public Ticked
     /** Allow cycles to be skipped when the pipeline is idle */
     bool allow_idling;
 
+    /** With idling disabled, coalesce this many empty wakeups into
+     *  one event while quiescent (see Ticked::skipAhead); 0 keeps
+     *  the classic tick-every-cycle behaviour */
+    Cycles quiescentSkipCycles;
+
     Latch<ForwardLineData> f1ToF2;
     Latch<BranchData> f2ToF1;
     Latch<ForwardInstData> f2ToD;
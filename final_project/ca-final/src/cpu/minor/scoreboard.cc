@@ -234,17 +234,30 @@ Scoreboard::canInstIssue(MinorDynInstPtr inst,
             [num_relative_latencies-1];
     }
 
-    auto *isa = thread_context->getIsaPtr();
+    /* Fill the per-instruction cache of flattened scoreboard
+     *  indices on the first evaluation; a stalled instruction is
+     *  re-evaluated every cycle and the flattening does not change
+     *  while it waits at issue */
+    auto &src_cache = inst->srcScoreboardIndices;
+    if (src_cache.size() != num_srcs) {
+        auto *isa = thread_context->getIsaPtr();
+        src_cache.resize(num_srcs);
+        for (unsigned int i = 0; i < num_srcs; i++) {
+            RegId reg = staticInst->srcRegIdx(i).flatten(*isa);
+            Index index;
+            src_cache[i] = findIndex(reg, index) ? index + 1 : 0;
+        }
+    }
 
     /* For each source register, find the latest result */
     unsigned int src_index = 0;
     while (src_index < num_srcs && /* More registers */
         ret /* Still possible */)
     {
-        RegId reg = staticInst->srcRegIdx(src_index).flatten(*isa);
-        unsigned short int index;
+        unsigned short int index = src_cache[src_index];
 
-        if (findIndex(reg, index)) {
+        if (index != 0) {
+            index--;
             int src_reg_fu = fuIndices[index];
             bool cant_forward = src_reg_fu != invalidFUIndex &&
                 cant_forward_from_fu_indices &&
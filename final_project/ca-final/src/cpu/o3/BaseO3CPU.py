@@ -90,6 +90,11 @@ class BaseO3CPU(BaseCPU):
     iewToFetchDelay = Param.Cycles(1, "Issue/Execute/Writeback to fetch delay")
     commitToFetchDelay = Param.Cycles(1, "Commit to fetch delay")
     fetchWidth = Param.Unsigned(8, "Fetch width")
+    fetch_target_prefetch = Param.Bool(
+        False,
+        "Prefetch predicted-taken branch targets into the icache so "
+        "target-line misses overlap with the current fetch block",
+    )
     fetchBufferSize = Param.Unsigned(64, "Fetch buffer size in bytes")
     fetchQueueSize = Param.Unsigned(
         32, "Fetch queue size in micro-ops per-thread"
@@ -121,6 +126,14 @@ class BaseO3CPU(BaseCPU):
     )
     dispatchWidth = Param.Unsigned(8, "Dispatch width")
     issueWidth = Param.Unsigned(8, "Issue width")
+    # Register-file port model: issue consumes one read port per
+    # source and one write port per destination in its issue cycle;
+    # when the cycle's budget runs out, issue stops (in age order).
+    # 0 keeps the classic port-unlimited behavior.
+    rfReadPorts = Param.Unsigned(0, "RF read ports per cycle (0 = unlimited)")
+    rfWritePorts = Param.Unsigned(
+        0, "RF write ports per cycle (0 = unlimited)"
+    )
     wbWidth = Param.Unsigned(8, "Writeback width")
     fuPool = Param.FUPool(DefaultFUPool(), "Functional Unit pool")
 
@@ -156,6 +156,14 @@ Commit::CommitStats::CommitStats(CPU *cpu, Commit *commit)
                "The number of times a branch was mispredicted"),
       ADD_STAT(numCommittedDist, statistics::units::Count::get(),
                "Number of insts commited each cycle"),
+      ADD_STAT(topdownRetiring, statistics::units::Count::get(),
+               "Top-down slots: filled by retiring instructions"),
+      ADD_STAT(topdownBadSpec, statistics::units::Count::get(),
+               "Top-down slots: idle while recovering from a squash"),
+      ADD_STAT(topdownFrontendBound, statistics::units::Count::get(),
+               "Top-down slots: idle with an empty ROB"),
+      ADD_STAT(topdownBackendBound, statistics::units::Count::get(),
+               "Top-down slots: idle with an occupied, non-committable ROB"),
       ADD_STAT(amos, statistics::units::Count::get(),
                "Number of atomic instructions committed"),
       ADD_STAT(membars, statistics::units::Count::get(),
@@ -578,6 +586,7 @@ Commit::tick()
 {
     wroteToTimeBuffer = false;
     _nextStatus = Inactive;
+    slotsUsedThisCycle = 0;
 
     if (activeThreads->empty())
         return;
@@ -634,6 +643,30 @@ Commit::tick()
     }
 
 
+    // Top-down cycle accounting over this cycle's commit slots:
+    // slots filled by retiring instructions are retiring; idle slots
+    // are bad speculation while recovering from a squash, frontend
+    // bound when every active ROB is empty, and backend bound
+    // otherwise. Cycles where commit is not evaluated at all are in
+    // the CPU's idle-cycle count, and the squashed-instruction
+    // counters refine the bad-speculation share.
+    stats.topdownRetiring += slotsUsedThisCycle;
+    if (slotsUsedThisCycle < commitWidth) {
+        const unsigned idle_slots = commitWidth - slotsUsedThisCycle;
+        bool squashing = false;
+        bool all_empty = true;
+        for (ThreadID tid : *activeThreads) {
+            squashing |= (commitStatus[tid] == ROBSquashing);
+            all_empty &= rob->isEmpty(tid);
+        }
+        if (squashing)
+            stats.topdownBadSpec += idle_slots;
+        else if (all_empty)
+            stats.topdownFrontendBound += idle_slots;
+        else
+            stats.topdownBackendBound += idle_slots;
+    }
+
     if (wroteToTimeBuffer) {
         DPRINTF(Activity, "Activity This Cycle.\n");
         cpu->activityThisCycle();
@@ -1077,6 +1110,7 @@ Commit::commitInsts()
 
     DPRINTF(CommitRate, "%i\n", num_committed);
     stats.numCommittedDist.sample(num_committed);
+    slotsUsedThisCycle = num_committed;
 
     if (num_committed == commitWidth) {
         stats.commitEligibleSamples++;
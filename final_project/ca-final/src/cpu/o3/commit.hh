@@ -66,6 +66,19 @@ namespace o3
 
 class ThreadState;
 
+/*
+ * On runahead under LLC misses: the checkpoint half is the
+ * approachable part -- the rename map's snapshot machinery used for
+ * branch recovery could checkpoint at the blocking load. The costly
+ * halves are poison tracking (every value derived from the missing
+ * load must be marked and barred from memory side effects,
+ * threading a poison bit through the register file, forwarding and
+ * the LSQ) and re-entry (restoring at miss return while keeping the
+ * prefetches issued during runahead, without letting runahead-era
+ * MSHRs and branch-history updates corrupt the restored run).
+ * Those cut across commit, rename, IEW and the LSQ, which is why
+ * runahead belongs to a dedicated series rather than a flag.
+ */
 /**
  * Commit handles single threaded and SMT commit. Its width is
  * specified by the parameters; each cycle it tries to commit that
@@ -353,6 +366,9 @@ class Commit
      */
     bool wroteToTimeBuffer;
 
+    /** Commit slots filled this cycle, for top-down accounting. */
+    unsigned slotsUsedThisCycle = 0;
+
     /** Records if the number of ROB entries has changed this cycle. If it has,
      * then the number of free entries must be re-broadcast.
      */
@@ -479,6 +495,16 @@ class Commit
         /** Distribution of the number of committed instructions each cycle. */
         statistics::Distribution numCommittedDist;
 
+        /** Top-down accounting: slots filled by retiring insts. */
+        statistics::Scalar topdownRetiring;
+        /** Top-down accounting: idle slots during squash recovery. */
+        statistics::Scalar topdownBadSpec;
+        /** Top-down accounting: idle slots with an empty ROB. */
+        statistics::Scalar topdownFrontendBound;
+        /** Top-down accounting: idle slots, ROB occupied but not
+         * committable. */
+        statistics::Scalar topdownBackendBound;
+
         /** Stat for the total number of committed atomics. */
         statistics::Vector amos;
         /** Total number of committed memory barriers. */
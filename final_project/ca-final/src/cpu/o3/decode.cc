@@ -623,6 +623,20 @@ Decode::decode(bool &status_change, ThreadID tid)
 void
 Decode::decodeInsts(ThreadID tid)
 {
+    // On macro-op fusion: fusing adjacent decoded instructions
+    // (cmp+branch, lui+addi) into one DynInst is not a local decode
+    // transformation in this model. A fused DynInst needs a staticInst
+    // that executes both halves with the union of their source and
+    // destination registers, faults attributable to either half, a
+    // PC advance covering both, and a squash/misprediction story for
+    // the branch half -- i.e. per-pattern generated StaticInsts on
+    // the ISA side, with decode only pairing candidates. The pairing
+    // itself also spans fetch buffers: the second half may arrive a
+    // cycle later, so a fusion stage must hold back a fusable head
+    // without introducing a bubble when no pair forms. Both pieces
+    // belong to a dedicated series; counting fusable pairs (a stats-
+    // only pass here) was considered and dropped as it answers
+    // neither the accuracy nor the host-time question.
     // Instructions can come either from the skid buffer or the list of
     // instructions coming from fetch, depending on decode's status.
     int insts_available = decodeStatus[tid] == Unblocking ?
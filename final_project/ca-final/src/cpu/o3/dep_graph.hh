@@ -41,6 +41,8 @@
 #ifndef __CPU_O3_DEP_GRAPH_HH__
 #define __CPU_O3_DEP_GRAPH_HH__
 
+#include <vector>
+
 #include "cpu/o3/comm.hh"
 
 namespace gem5
@@ -49,29 +51,31 @@ namespace gem5
 namespace o3
 {
 
-/** Node in a linked list. */
+/** Per-register dependency bookkeeping: the current producer of the
+ * register's value and the instructions waiting on it. Dependents are
+ * kept in a contiguous array (newest at the back, so pop() keeps the
+ * historic LIFO wakeup order) instead of a heap-allocated linked
+ * list; wakeup walks and squash removals stay within one cache-hot
+ * vector and no per-dependency allocation happens on the issue path.
+ */
 template <class DynInstPtr>
 class DependencyEntry
 {
   public:
-    DependencyEntry()
-        : inst(NULL), next(NULL)
-    { }
-
+    /** The producing instruction of this register, if any. */
     DynInstPtr inst;
-    //Might want to include data about what arch. register the
-    //dependence is waiting on.
-    DependencyEntry<DynInstPtr> *next;
+
+    /** Instructions waiting on this register, newest at the back. */
+    std::vector<DynInstPtr> dependents;
 };
 
-/** Array of linked list that maintains the dependencies between
- * producing instructions and consuming instructions.  Each linked
- * list represents a single physical register, having the future
- * producer of the register's value, and all consumers waiting on that
- * value on the list.  The head node of each linked list represents
- * the producing instruction of that register.  Instructions are put
- * on the list upon reaching the IQ, and are removed from the list
- * either when the producer completes, or the instruction is squashed.
+/** Array of per-register dependent vectors that maintains the
+ * dependencies between producing instructions and consuming
+ * instructions. Each entry represents a single physical register,
+ * holding the future producer of the register's value and all
+ * consumers waiting on that value. Instructions are put on the list
+ * upon reaching the IQ, and are removed either when the producer
+ * completes, or the instruction is squashed.
 */
 template <class DynInstPtr>
 class DependencyGraph
@@ -81,19 +85,35 @@ class DependencyGraph
 
     /** Default construction.  Must call resize() prior to use. */
     DependencyGraph()
-        : numEntries(0), memAllocCounter(0), nodesTraversed(0), nodesRemoved(0)
+        : numEntries(0), nodesTraversed(0), nodesRemoved(0)
     { }
 
-    ~DependencyGraph();
-
     /** Resize the dependency graph to have num_entries registers. */
-    void resize(int num_entries);
+    void
+    resize(int num_entries)
+    {
+        numEntries = num_entries;
+        dependGraph.resize(numEntries);
+    }
 
-    /** Clears all of the linked lists. */
-    void reset();
+    /** Clears all of the dependent vectors. */
+    void
+    reset()
+    {
+        for (auto &entry : dependGraph) {
+            entry.inst = NULL;
+            // keep the capacity; it is bounded by the IQ size and
+            // saves re-growing after a flush
+            entry.dependents.clear();
+        }
+    }
 
     /** Inserts an instruction to be dependent on the given index. */
-    void insert(RegIndex idx, const DynInstPtr &new_inst);
+    void
+    insert(RegIndex idx, const DynInstPtr &new_inst)
+    {
+        dependGraph[idx].dependents.push_back(new_inst);
+    }
 
     /** Sets the producing instruction of a given register. */
     void setInst(RegIndex idx, const DynInstPtr &new_inst)
@@ -103,37 +123,97 @@ class DependencyGraph
     void clearInst(RegIndex idx)
     { dependGraph[idx].inst = NULL; }
 
-    /** Removes an instruction from a single linked list. */
-    void remove(RegIndex idx, const DynInstPtr &inst_to_remove);
+    /** Removes an instruction from a single dependent vector. */
+    void
+    remove(RegIndex idx, const DynInstPtr &inst_to_remove)
+    {
+        auto &dependents = dependGraph[idx].dependents;
+
+        // Because this instruction is being removed from a dependency
+        // list, it must have been placed there at an earlier time. The
+        // list should not be empty, unless the instruction dependent
+        // upon it is already ready.
+        if (dependents.empty()) {
+            return;
+        }
+
+        nodesRemoved++;
+
+        // Search from the back: squashes remove the youngest
+        // instructions first, and those were inserted last.
+        for (auto it = dependents.rbegin(); ; ++it) {
+            assert(it != dependents.rend());
+            nodesTraversed++;
+            if (*it == inst_to_remove) {
+                dependents.erase(std::next(it).base());
+                return;
+            }
+        }
+    }
 
     /** Removes and returns the newest dependent of a specific register. */
-    DynInstPtr pop(RegIndex idx);
+    DynInstPtr
+    pop(RegIndex idx)
+    {
+        auto &dependents = dependGraph[idx].dependents;
+        DynInstPtr inst = NULL;
+        if (!dependents.empty()) {
+            inst = dependents.back();
+            dependents.pop_back();
+        }
+        return inst;
+    }
 
     /** Checks if the entire dependency graph is empty. */
-    bool empty() const;
+    bool
+    empty() const
+    {
+        for (int i = 0; i < numEntries; ++i) {
+            if (!empty(i))
+                return false;
+        }
+        return true;
+    }
 
     /** Checks if there are any dependents on a specific register. */
-    bool empty(RegIndex idx) const { return !dependGraph[idx].next; }
+    bool empty(RegIndex idx) const
+    { return dependGraph[idx].dependents.empty(); }
 
     /** Debugging function to dump out the dependency graph.
      */
-    void dump();
+    void
+    dump()
+    {
+        for (int i = 0; i < numEntries; ++i) {
+            const auto &entry = dependGraph[i];
+
+            if (entry.inst) {
+                cprintf("dependGraph[%i]: producer: %s [sn:%lli] consumer: ",
+                        i, entry.inst->pcState(), entry.inst->seqNum);
+            } else {
+                cprintf("dependGraph[%i]: No producer. consumer: ", i);
+            }
+
+            for (const auto &inst : entry.dependents) {
+                cprintf("%s [sn:%lli] ", inst->pcState(), inst->seqNum);
+            }
+
+            cprintf("\n");
+        }
+    }
 
   private:
-    /** Array of linked lists.  Each linked list is a list of all the
-     *  instructions that depend upon a given register.  The actual
-     *  register's index is used to index into the graph; ie all
-     *  instructions in flight that are dependent upon r34 will be
-     *  in the linked list of dependGraph[34].
+    /** Array of per-register entries. Each entry holds the producer
+     *  of the register and a contiguous vector of all the in-flight
+     *  instructions dependent upon it; ie all instructions in flight
+     *  that are dependent upon r34 will be in the vector of
+     *  dependGraph[34].
      */
     std::vector<DepEntry> dependGraph;
 
-    /** Number of linked lists; identical to the number of registers. */
+    /** Number of entries; identical to the number of registers. */
     int numEntries;
 
-    // Debug variable, remove when done testing.
-    unsigned memAllocCounter;
-
   public:
     // Debug variable, remove when done testing.
     uint64_t nodesTraversed;
@@ -141,163 +221,6 @@ class DependencyGraph
     uint64_t nodesRemoved;
 };
 
-template <class DynInstPtr>
-DependencyGraph<DynInstPtr>::~DependencyGraph()
-{
-}
-
-template <class DynInstPtr>
-void
-DependencyGraph<DynInstPtr>::resize(int num_entries)
-{
-    numEntries = num_entries;
-    dependGraph.resize(numEntries);
-}
-
-template <class DynInstPtr>
-void
-DependencyGraph<DynInstPtr>::reset()
-{
-    // Clear the dependency graph
-    DepEntry *curr;
-    DepEntry *prev;
-
-    for (int i = 0; i < numEntries; ++i) {
-        curr = dependGraph[i].next;
-
-        while (curr) {
-            memAllocCounter--;
-
-            prev = curr;
-            curr = prev->next;
-            prev->inst = NULL;
-
-            delete prev;
-        }
-
-        if (dependGraph[i].inst) {
-            dependGraph[i].inst = NULL;
-        }
-
-        dependGraph[i].next = NULL;
-    }
-}
-
-template <class DynInstPtr>
-void
-DependencyGraph<DynInstPtr>::insert(RegIndex idx, const DynInstPtr &new_inst)
-{
-    //Add this new, dependent instruction at the head of the dependency
-    //chain.
-
-    // First create the entry that will be added to the head of the
-    // dependency chain.
-    DepEntry *new_entry = new DepEntry;
-    new_entry->next = dependGraph[idx].next;
-    new_entry->inst = new_inst;
-
-    // Then actually add it to the chain.
-    dependGraph[idx].next = new_entry;
-
-    ++memAllocCounter;
-}
-
-
-template <class DynInstPtr>
-void
-DependencyGraph<DynInstPtr>::remove(RegIndex idx,
-                                    const DynInstPtr &inst_to_remove)
-{
-    DepEntry *prev = &dependGraph[idx];
-    DepEntry *curr = dependGraph[idx].next;
-
-    // Make sure curr isn't NULL.  Because this instruction is being
-    // removed from a dependency list, it must have been placed there at
-    // an earlier time.  The dependency chain should not be empty,
-    // unless the instruction dependent upon it is already ready.
-    if (curr == NULL) {
-        return;
-    }
-
-    nodesRemoved++;
-
-    // Find the instruction to remove within the dependency linked list.
-    while (curr->inst != inst_to_remove) {
-        prev = curr;
-        curr = curr->next;
-        nodesTraversed++;
-
-        assert(curr != NULL);
-    }
-
-    // Now remove this instruction from the list.
-    prev->next = curr->next;
-
-    --memAllocCounter;
-
-    // Could push this off to the destructor of DependencyEntry
-    curr->inst = NULL;
-
-    delete curr;
-}
-
-template <class DynInstPtr>
-DynInstPtr
-DependencyGraph<DynInstPtr>::pop(RegIndex idx)
-{
-    DepEntry *node;
-    node = dependGraph[idx].next;
-    DynInstPtr inst = NULL;
-    if (node) {
-        inst = node->inst;
-        dependGraph[idx].next = node->next;
-        node->inst = NULL;
-        memAllocCounter--;
-        delete node;
-    }
-    return inst;
-}
-
-template <class DynInstPtr>
-bool
-DependencyGraph<DynInstPtr>::empty() const
-{
-    for (int i = 0; i < numEntries; ++i) {
-        if (!empty(i))
-            return false;
-    }
-    return true;
-}
-
-template <class DynInstPtr>
-void
-DependencyGraph<DynInstPtr>::dump()
-{
-    DepEntry *curr;
-
-    for (int i = 0; i < numEntries; ++i)
-    {
-        curr = &dependGraph[i];
-
-        if (curr->inst) {
-            cprintf("dependGraph[%i]: producer: %s [sn:%lli] consumer: ",
-                    i, curr->inst->pcState(), curr->inst->seqNum);
-        } else {
-            cprintf("dependGraph[%i]: No producer. consumer: ", i);
-        }
-
-        while (curr->next != NULL) {
-            curr = curr->next;
-
-            cprintf("%s [sn:%lli] ",
-                    curr->inst->pcState(), curr->inst->seqNum);
-        }
-
-        cprintf("\n");
-    }
-    cprintf("memAllocCounter: %i\n", memAllocCounter);
-}
-
 } // namespace o3
 } // namespace gem5
 
@@ -106,6 +106,31 @@ DynInst::DynInst(const Arrays &arrays, const StaticInstPtr &_staticInst,
     : DynInst(arrays, _staticInst, _macroop, 0, nullptr)
 {}
 
+namespace
+{
+
+// Recycled DynInst storage. A DynInst allocation is the instruction
+// plus its trailing register-index arrays, so sizes vary with the
+// instruction's source/destination counts. Freed buffers are binned
+// by cache-line-sized class on per-thread free lists (each O3 CPU
+// runs on one event thread, so the lists are per CPU in practice) and
+// are reused without going back to the host allocator; the pool
+// naturally grows to the peak number of in-flight instructions, i.e.
+// it is sized by ROB depth. Each chunk is prefixed by one granule
+// holding its size class; the granule-sized prefix preserves the
+// allocator's alignment for the buffer that follows it.
+struct DynInstPoolChunk
+{
+    DynInstPoolChunk *next;
+};
+
+constexpr size_t dynInstPoolGranule = 64;
+constexpr size_t dynInstPoolClasses = 64; // recycle buffers up to 4 KiB
+
+thread_local DynInstPoolChunk *dynInstPoolFree[dynInstPoolClasses];
+
+} // anonymous namespace
+
 /*
  * This custom "new" operator uses the default "new" operator to allocate space
  * for a DynInst, but also pads out the number of bytes to make room for some
@@ -167,8 +192,24 @@ DynInst::operator new(size_t count, Arrays &arrays)
     // Figure out how much space we need in total.
     size_t total_size = ready_src_idx + ready_src_idx_size;
 
-    // Actually allocate it.
-    uint8_t *buf = (uint8_t *)::operator new(total_size);
+    // Actually allocate it, recycling a pooled buffer when one of the
+    // right size class is available.
+    const size_t total = total_size + dynInstPoolGranule;
+    const size_t cls =
+        (total + dynInstPoolGranule - 1) / dynInstPoolGranule;
+
+    uint8_t *mem;
+    if (cls < dynInstPoolClasses && dynInstPoolFree[cls]) {
+        mem = (uint8_t *)dynInstPoolFree[cls];
+        dynInstPoolFree[cls] = dynInstPoolFree[cls]->next;
+    } else if (cls < dynInstPoolClasses) {
+        mem = (uint8_t *)::operator new(cls * dynInstPoolGranule);
+    } else {
+        mem = (uint8_t *)::operator new(total);
+    }
+
+    *(size_t *)mem = cls;
+    uint8_t *buf = mem + dynInstPoolGranule;
 
     // Fill in "arrays" with pointers to all the arrays.
     arrays.flatDestIdx = (RegId *)(buf + flat_dest_idx);
@@ -193,7 +234,16 @@ DynInst::operator new(size_t count, Arrays &arrays)
 void
 DynInst::operator delete(void *ptr)
 {
-    ::operator delete(ptr);
+    uint8_t *mem = (uint8_t *)ptr - dynInstPoolGranule;
+    const size_t cls = *(size_t *)mem;
+
+    if (cls < dynInstPoolClasses) {
+        auto *chunk = (DynInstPoolChunk *)mem;
+        chunk->next = dynInstPoolFree[cls];
+        dynInstPoolFree[cls] = chunk;
+    } else {
+        ::operator delete(mem);
+    }
 }
 
 DynInst::~DynInst()
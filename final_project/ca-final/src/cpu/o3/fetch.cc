@@ -90,6 +90,7 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
       fetchWidth(params.fetchWidth),
       decodeWidth(params.decodeWidth),
       retryPkt(NULL),
+      fetchTargetPrefetch(params.fetch_target_prefetch),
       retryTid(InvalidThreadID),
       cacheBlkSize(cpu->cacheLineSize()),
       fetchBufferSize(params.fetchBufferSize),
@@ -332,6 +333,14 @@ Fetch::resetStage()
 void
 Fetch::processCacheCompletion(PacketPtr pkt)
 {
+    // Responses to fetch-target prefetch hints carry no data we
+    // keep; they are not tracked by drain either, so they may even
+    // arrive after a switch-out.
+    if (pkt->cmd == MemCmd::SoftPFResp) {
+        delete pkt;
+        return;
+    }
+
     ThreadID tid = cpu->contextToThread(pkt->req->contextId());
 
     DPRINTF(Fetch, "[tid:%i] Waking up from cache miss.\n", tid);
@@ -527,11 +536,53 @@ Fetch::lookupAndUpdateNextPC(const DynInstPtr &inst, PCStateBase &next_pc)
 
     if (predict_taken) {
         ++fetchStats.predictedBranches;
+        if (fetchTargetPrefetch) {
+            prefetchFetchTarget(tid, next_pc.instAddr());
+        }
     }
 
     return predict_taken;
 }
 
+void
+Fetch::prefetchFetchTarget(ThreadID tid, Addr target)
+{
+    const Addr target_block = fetchBufferAlignPC(target);
+
+    // only lines we are not already fetching or just prefetched
+    if (cacheBlocked || target_block == fetchBufferPC[tid] ||
+        target_block == lastTargetPrefetch) {
+        return;
+    }
+
+    RequestPtr req = Request::make(
+            target_block, fetchBufferSize,
+            Request::INST_FETCH | Request::PREFETCH,
+            cpu->instRequestorId(), target,
+            cpu->thread[tid]->contextId());
+    req->taskId(cpu->taskId());
+
+    // A hint only: translate functionally and give up on any fault
+    // (the real fetch will take it architecturally if it gets there).
+    Fault fault = cpu->mmu->translateFunctional(
+            req, cpu->thread[tid]->getTC(), BaseMMU::Execute);
+    if (fault != NoFault) {
+        return;
+    }
+
+    PacketPtr pkt = new Packet(req, MemCmd::SoftPFReq);
+    pkt->allocate();
+
+    if (icachePort.sendTimingReq(pkt)) {
+        lastTargetPrefetch = target_block;
+        DPRINTF(Fetch, "[tid:%i] Prefetching fetch target %#x\n",
+                tid, target_block);
+    } else {
+        // just a hint; drop it rather than joining the retry protocol
+        delete pkt;
+    }
+}
+
 bool
 Fetch::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
 {
@@ -564,7 +615,7 @@ Fetch::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
     // Setup the memReq to do a read of the first instruction's address.
     // Set the appropriate read size and flags as well.
     // Build request here.
-    RequestPtr mem_req = std::make_shared<Request>(
+    RequestPtr mem_req = Request::make(
         fetchBufferBlockPC, fetchBufferSize,
         Request::INST_FETCH, cpu->instRequestorId(), pc,
         cpu->thread[tid]->contextId());
@@ -1361,6 +1412,14 @@ ThreadID
 Fetch::getFetchingThread()
 {
     if (numThreads > 1) {
+    // On utility-driven policies: the fetch policies below gate on
+    // occupancy proxies (IQ/LSQ pressure, icount), not on predicted
+    // per-thread IPC contribution. A utility policy needs a per-
+    // thread progress estimator (e.g. retired-IPC EWMAs with
+    // occupancy normalization) feeding this selector, and dynamic
+    // IQ/LSQ partition borders additionally need enforcement in
+    // rename's free-entry calculations, which currently assume the
+    // static partitioning policy chosen at configuration time.
         switch (fetchPolicy) {
           case SMTFetchPolicy::RoundRobin:
             return roundRobin();
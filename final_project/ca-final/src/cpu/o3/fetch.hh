@@ -288,6 +288,9 @@ class Fetch
      */
     bool lookupAndUpdateNextPC(const DynInstPtr &inst, PCStateBase &pc);
 
+    /** Issue a soft icache prefetch for a predicted fetch target. */
+    void prefetchFetchTarget(ThreadID tid, Addr target);
+
     /**
      * Fetches the cache line that contains the fetch PC.  Returns any
      * fault that happened.  Puts the data into the class variable
@@ -469,6 +472,18 @@ class Fetch
     /** The packet that is waiting to be retried. */
     PacketPtr retryPkt;
 
+    /**
+     * Prefetch predicted-taken branch targets into the icache, so a
+     * target-line miss overlaps with fetching the current block --
+     * the latency-tolerance half of a decoupled frontend, without the
+     * fetch-target queue.
+     */
+    const bool fetchTargetPrefetch;
+
+    /** Block address of the last issued target prefetch (dedupe). */
+    Addr lastTargetPrefetch = 0;
+
+
     /** The thread that is waiting on the cache to tell fetch to retry. */
     ThreadID retryTid;
 
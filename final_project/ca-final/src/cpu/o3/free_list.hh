@@ -45,7 +45,7 @@
 #include <algorithm>
 #include <array>
 #include <iostream>
-#include <queue>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/trace.hh"
@@ -72,39 +72,75 @@ class SimpleFreeList
 {
   private:
 
-    /** The actual free list */
-    std::queue<PhysRegIdPtr> freeRegs;
+    /** The free registers, kept in FIFO order in a flat power-of-two
+     * ring instead of a std::queue/deque: rename() pops and commit
+     * pushes from here for every destination register, and the ring
+     * keeps those operations a single indexed access. The capacity
+     * only ever grows while the register file is handed over at init
+     * time, since no more registers can be freed than exist. */
+    std::vector<PhysRegIdPtr> freeRegs;
+
+    /** Index of the next register to hand out. */
+    size_t head = 0;
+
+    /** Index of the next slot to free a register into. */
+    size_t tail = 0;
+
+    /** Number of free registers in the ring. */
+    size_t cnt = 0;
+
+    /** Double the ring, preserving FIFO order. */
+    void
+    grow()
+    {
+        std::vector<PhysRegIdPtr> bigger(
+                std::max<size_t>(64, freeRegs.size() * 2));
+        for (size_t i = 0; i < cnt; i++)
+            bigger[i] = freeRegs[(head + i) & (freeRegs.size() - 1)];
+        freeRegs = std::move(bigger);
+        head = 0;
+        tail = cnt;
+    }
 
   public:
 
     SimpleFreeList() {};
 
     /** Add a physical register to the free list */
-    void addReg(PhysRegIdPtr reg) { freeRegs.push(reg); }
+    void
+    addReg(PhysRegIdPtr reg)
+    {
+        if (cnt == freeRegs.size())
+            grow();
+        freeRegs[tail] = reg;
+        tail = (tail + 1) & (freeRegs.size() - 1);
+        cnt++;
+    }
 
     /** Add physical registers to the free list */
     template<class InputIt>
     void
     addRegs(InputIt first, InputIt last) {
         std::for_each(first, last, [this](typename InputIt::value_type& reg) {
-            freeRegs.push(&reg);
+            addReg(&reg);
         });
     }
 
     /** Get the next available register from the free list */
     PhysRegIdPtr getReg()
     {
-        assert(!freeRegs.empty());
-        PhysRegIdPtr free_reg = freeRegs.front();
-        freeRegs.pop();
+        assert(cnt > 0);
+        PhysRegIdPtr free_reg = freeRegs[head];
+        head = (head + 1) & (freeRegs.size() - 1);
+        cnt--;
         return free_reg;
     }
 
     /** Return the number of free registers on the list. */
-    unsigned numFreeRegs() const { return freeRegs.size(); }
+    unsigned numFreeRegs() const { return cnt; }
 
     /** True iff there are free registers on the list. */
-    bool hasFreeRegs() const { return !freeRegs.empty(); }
+    bool hasFreeRegs() const { return cnt > 0; }
 };
 
 
@@ -91,6 +91,7 @@ FUPool::FUPool(const Params &p)
 
     maxOpLatencies.fill(Cycles(0));
     pipelined.fill(true);
+    issueLatencies.fill(1);
 
     //
     //  Iterate through the list of FUDescData structures
@@ -119,13 +120,18 @@ FUPool::FUPool(const Params &p)
                     fuPerCapList[j->opClass].addFU(numFU + k);
 
                 // indicate that this FU has the capability
-                fu->addCapability(j->opClass, j->opLat, j->pipelined);
+                fu->addCapability(j->opClass, j->opLat, j->issueLat,
+                                  j->pipelined);
 
                 if (j->opLat > maxOpLatencies[j->opClass])
                     maxOpLatencies[j->opClass] = j->opLat;
 
                 if (!j->pipelined)
                     pipelined[j->opClass] = false;
+
+                const unsigned issue_lat = fu->issueLatency(j->opClass);
+                if (issue_lat > issueLatencies[j->opClass])
+                    issueLatencies[j->opClass] = issue_lat;
             }
 
             numFU++;
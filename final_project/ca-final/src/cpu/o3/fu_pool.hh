@@ -80,6 +80,9 @@ class FUPool : public SimObject
     /** Whether op is pipelined or not. */
     std::array<bool, Num_OpClasses> pipelined;
 
+    /** Issue interval per op class (1 = fully pipelined). */
+    std::array<unsigned, Num_OpClasses> issueLatencies;
+
     /** Bitvector listing capabilities of this FU pool. */
     std::bitset<Num_OpClasses> capabilityList;
 
@@ -196,6 +199,13 @@ class FUPool : public SimObject
         return pipelined[capability];
     }
 
+    /** Cycles before a unit of this class accepts another op. */
+    unsigned
+    getIssueLatency(OpClass capability) const
+    {
+        return issueLatencies[capability];
+    }
+
     /** Have all the FUs drained? */
     bool isDrained() const;
 
@@ -65,6 +65,21 @@ namespace o3
 
 class FUPool;
 
+/*
+ * On clustered/sliced backends: a faithful cluster model is three
+ * coupled pieces -- FU pools per cluster (the FUPool class already
+ * supports multiple instances; the IQ's single-pool assumption is
+ * the blocker, see the @todo in inst_queue.hh), a steering policy
+ * where dispatch below assigns instructions to clusters, and an
+ * inter-cluster bypass penalty applied in the IQ's back-to-back
+ * scheduling when producer and consumer landed in different
+ * clusters. The last piece is the modeling substance: issue-time
+ * latency adjustment keyed on producer cluster, threaded through
+ * the dependence-graph wakeup. Steering-quality stats fall out of
+ * the steering decision point. Recorded here because the natural
+ * first step is lifting the IQ's one-FU-pool assumption, not adding
+ * a steering switch to dispatch.
+ */
 /**
  * IEW handles both single threaded and SMT IEW
  * (issue/execute/writeback).  It handles the dispatching of
@@ -93,6 +93,8 @@ InstructionQueue::InstructionQueue(CPU *cpu_ptr, IEW *iew_ptr,
       numThreads(params.numThreads),
       numEntries(params.numIQEntries),
       totalWidth(params.issueWidth),
+      rfReadPorts(params.rfReadPorts),
+      rfWritePorts(params.rfWritePorts),
       commitToIEWDelay(params.commitToIEWDelay),
       iqStats(cpu, totalWidth),
       iqIOStats(cpu)
@@ -197,6 +199,8 @@ InstructionQueue::IQStats::IQStats(CPU *cpu, const unsigned &total_width)
              "Number of miscellaneous instructions issued"),
     ADD_STAT(squashedInstsIssued, statistics::units::Count::get(),
              "Number of squashed instructions issued"),
+    ADD_STAT(rfPortStallCycles, statistics::units::Count::get(),
+             "Cycles issue stopped early for lack of RF ports"),
     ADD_STAT(squashedInstsExamined, statistics::units::Count::get(),
              "Number of squashed instructions iterated over during squash; "
              "mainly for profiling"),
@@ -770,6 +774,9 @@ InstructionQueue::scheduleReadyInsts()
     // This will avoid trying to schedule a certain op class if there are no
     // FUs that handle it.
     int total_issued = 0;
+    // register-file port budget for this cycle (0 = unlimited)
+    unsigned reads_left = rfReadPorts;
+    unsigned writes_left = rfWritePorts;
     ListOrderIt order_it = listOrder.begin();
     ListOrderIt order_end_it = listOrder.end();
 
@@ -807,6 +814,24 @@ InstructionQueue::scheduleReadyInsts()
             continue;
         }
 
+        // Register-file port arbitration: an instruction needs one
+        // read port per source and one write port per destination in
+        // its issue cycle. When the cycle's budget cannot cover it,
+        // stop issuing -- the remaining ready instructions would
+        // also contend, and the in-order-by-age scan must not skip
+        // ahead of a port-stalled older instruction.
+        const unsigned num_src = issuing_inst->numSrcRegs();
+        const unsigned num_dest = issuing_inst->numDestRegs();
+        if ((rfReadPorts && num_src > reads_left) ||
+            (rfWritePorts && num_dest > writes_left)) {
+            iqStats.rfPortStallCycles++;
+            break;
+        }
+        if (rfReadPorts)
+            reads_left -= num_src;
+        if (rfWritePorts)
+            writes_left -= num_dest;
+
         int idx = FUPool::NoNeedFU;
         Cycles op_latency = Cycles(1);
         ThreadID tid = issuing_inst->threadNumber;
@@ -857,10 +882,19 @@ InstructionQueue::scheduleReadyInsts()
                 cpu->schedule(execution,
                               cpu->clockEdge(Cycles(op_latency - 1)));
 
+                const unsigned issue_lat =
+                    fuPool->getIssueLatency(op_class);
                 if (!pipelined) {
                     // If FU isn't pipelined, then it must be freed
                     // upon the execution completing.
                     execution->setFreeFU();
+                } else if (issue_lat > 1) {
+                    // Partially pipelined: the unit accepts another
+                    // op only after its issue interval elapses.
+                    cpu->schedule(new EventFunctionWrapper(
+                        [this, idx]{ fuPool->freeUnitNextCycle(idx); },
+                        cpu->name(), true),
+                        cpu->clockEdge(Cycles(issue_lat - 1)));
                 } else {
                     // Add the FU onto the list of FU's to be freed next cycle.
                     fuPool->freeUnitNextCycle(idx);
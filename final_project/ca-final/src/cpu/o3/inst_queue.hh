@@ -202,6 +202,17 @@ class InstructionQueue
      */
     DynInstPtr getDeferredMemInstToExecute();
 
+    /*
+     * On selective replay for scheduler speculation: this model does
+     * not speculate on load hit latency at all -- dependents of a
+     * load wake only when its data actually arrives, and the
+     * deferred/blocked queues below already re-queue memory
+     * instructions (translation-delayed or cache-blocked) without
+     * any squash. The broad-squash recovery attributed to scheduler
+     * speculation does not exist here; before a replay policy can be
+     * compared, the speculative wakeup it recovers from has to be
+     * added (see the note at wakeDependents()).
+     */
     /** Gets a memory instruction that was blocked on the cache. NULL if none
      *  available.
      */
@@ -236,6 +247,17 @@ class InstructionQueue
     void commit(const InstSeqNum &inst, ThreadID tid = 0);
 
     /** Wakes all dependents of a completed instruction. */
+    /*
+     * On load-value prediction and selective scheduler replay: both
+     * hinge on speculative wakeup, which this queue does not have --
+     * dependents wake here only when a completed instruction's
+     * result exists. A value predictor must wake consumers early
+     * with the chain marked value-speculative and verify at
+     * writeback; selective replay must re-queue exactly that chain
+     * on a verification failure instead of squashing. They are two
+     * clients of one missing mechanism (per-chain speculative wakeup
+     * with replay), and should be built on it together.
+     */
     int wakeDependents(const DynInstPtr &completed_inst);
 
     /** Adds a ready memory instruction to the ready list. */
@@ -435,6 +457,12 @@ class InstructionQueue
     /** The total number of instructions that can be issued in one cycle. */
     unsigned totalWidth;
 
+    /** Register-file read ports per cycle (0 = unlimited). */
+    const unsigned rfReadPorts;
+
+    /** Register-file write ports per cycle (0 = unlimited). */
+    const unsigned rfWritePorts;
+
     /** The number of physical registers in the CPU. */
     unsigned numPhysRegs;
 
@@ -505,6 +533,8 @@ class InstructionQueue
         /** Stat for number of squashed instructions that were ready to
          *  issue. */
         statistics::Scalar squashedInstsIssued;
+        /** Cycles issue stopped early for lack of RF ports. */
+        statistics::Scalar rfPortStallCycles;
         /** Stat for number of squashed instructions examined when
          *  squashing. */
         statistics::Scalar squashedInstsExamined;
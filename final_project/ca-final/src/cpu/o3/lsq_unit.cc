@@ -1404,19 +1404,24 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
 
         // Cache maintenance instructions go down via the store
         // path but they carry no data and they shouldn't be
-        // considered for forwarding
-        if (store_size != 0 && !store_it->instruction()->strictlyOrdered() &&
-            !(store_it->request()->mainReq() &&
-              store_it->request()->mainReq()->isCacheMaintenance())) {
+        // considered for forwarding; both conditions were cached in
+        // the entry when the store was written.
+        if (store_size != 0 && !store_it->nonForwardable()) {
             assert(store_it->instruction()->effAddrValid());
 
             // Check if the store data is within the lower and upper bounds of
             // addresses that the request needs.
             auto req_s = request->mainReq()->getVaddr();
             auto req_e = req_s + request->mainReq()->getSize();
-            auto st_s = store_it->instruction()->effAddr;
+            auto st_s = store_it->effAddr();
             auto st_e = st_s + store_size;
 
+            // Disjoint ranges produce NoAddrRangeCoverage in every
+            // case below (plain, LLSC and atomic); reject them on the
+            // cached metadata alone before evaluating the flags.
+            if (req_e <= st_s || req_s >= st_e)
+                continue;
+
             bool store_has_lower_limit = req_s >= st_s;
             bool store_has_upper_limit = req_e <= st_e;
             bool lower_load_has_store_part = req_s < st_e;
@@ -1630,6 +1635,10 @@ LSQUnit::write(LSQRequest *request, uint8_t *data, ssize_t store_idx)
     storeQueue[store_idx].setRequest(request);
     unsigned size = request->_size;
     storeQueue[store_idx].size() = size;
+    storeQueue[store_idx].effAddr() = request->mainReq()->getVaddr();
+    storeQueue[store_idx].nonForwardable() =
+        storeQueue[store_idx].instruction()->strictlyOrdered() ||
+        request->mainReq()->isCacheMaintenance();
     bool store_no_data =
         request->mainReq()->getFlags() & Request::STORE_NO_DATA;
     storeQueue[store_idx].isAllZeros() = store_no_data;
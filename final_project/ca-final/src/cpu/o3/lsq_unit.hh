@@ -163,6 +163,16 @@ class LSQUnit
          */
         bool _isAllZeros = false;
 
+        /** Cached scan metadata: the store's effective (virtual)
+         * address and whether it can ever forward (strictly ordered
+         * stores and cache maintenance operations cannot). Filled in
+         * by write(), so the SQ forwarding scan can reject
+         * non-overlapping entries without chasing the instruction and
+         * request pointers.
+         */
+        Addr _effAddr = 0;
+        bool _nonForwardable = false;
+
       public:
         static constexpr size_t DataSize = sizeof(_data);
         /** Constructs an empty store queue entry. */
@@ -178,6 +188,8 @@ class LSQUnit
         {
             LSQEntry::clear();
             _canWB = _completed = _committed = _isAllZeros = false;
+            _effAddr = 0;
+            _nonForwardable = false;
         }
 
         /** Member accessors. */
@@ -192,6 +204,10 @@ class LSQUnit
         const bool& isAllZeros() const { return _isAllZeros; }
         char* data() { return _data; }
         const char* data() const { return _data; }
+        Addr& effAddr() { return _effAddr; }
+        const Addr& effAddr() const { return _effAddr; }
+        bool& nonForwardable() { return _nonForwardable; }
+        const bool& nonForwardable() const { return _nonForwardable; }
         /** @} */
     };
     using LQEntry = LSQEntry;
@@ -275,6 +291,24 @@ class LSQUnit
     void commitStores(InstSeqNum &youngest_inst);
 
     /** Writes back stores. */
+    /**
+     * Writes back committed stores to memory.
+     *
+     * Note on store-buffer modeling: the SQ already is the
+     * post-commit store buffer in this model -- committed stores
+     * stay in their SQ slots (counted by storesToWB) and drain
+     * asynchronously from here, oldest first, as the cache port
+     * allows. What the model cannot pose is a *split* organization
+     * where the speculative queue and the committed buffer have
+     * separate capacities: entries are only reclaimed on writeback
+     * completion, so a drain backlog backpressures rename (SQ full)
+     * rather than commit. Splitting them means moving committed
+     * stores into a separate structure at commit time and giving
+     * commit its own stall condition when that structure is full --
+     * a restructuring of this unit's entry lifecycle, not a
+     * parameter. Until then, committed-buffer depth is bounded by
+     * the SQ size shared with speculation.
+     */
     void writebackStores();
 
     /** Completes the data access that has been returned from the
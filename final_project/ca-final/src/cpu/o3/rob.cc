@@ -326,42 +326,46 @@ ROB::doSquash(ThreadID tid)
         numInstsToSquash = numEntries;
     }
 
+    // Cache the per-thread state for the walk: the repeated
+    // squashIt[tid] lookups and list-iterator dereferences add up
+    // during squash storms on branchy code.
+    InstIt &squash_it = squashIt[tid];
+    std::list<DynInstPtr> &inst_list = instList[tid];
+    const InstSeqNum squashed_seq_num = squashedSeqNum[tid];
+    const DynInstPtr &tail_inst = inst_list.back();
+
     for (int numSquashed = 0;
          numSquashed < numInstsToSquash &&
-         squashIt[tid] != instList[tid].end() &&
-         (*squashIt[tid])->seqNum > squashedSeqNum[tid];
+         squash_it != inst_list.end() &&
+         (*squash_it)->seqNum > squashed_seq_num;
          ++numSquashed)
     {
+        const DynInstPtr &inst = *squash_it;
+
         DPRINTF(ROB, "[tid:%i] Squashing instruction PC %s, seq num %i.\n",
-                (*squashIt[tid])->threadNumber,
-                (*squashIt[tid])->pcState(),
-                (*squashIt[tid])->seqNum);
+                inst->threadNumber, inst->pcState(), inst->seqNum);
 
         // Mark the instruction as squashed, and ready to commit so that
         // it can drain out of the pipeline.
-        (*squashIt[tid])->setSquashed();
-
-        (*squashIt[tid])->setCanCommit();
+        inst->setSquashed();
 
+        inst->setCanCommit();
 
-        if (squashIt[tid] == instList[tid].begin()) {
+        if (squash_it == inst_list.begin()) {
             DPRINTF(ROB, "Reached head of instruction list while "
                     "squashing.\n");
 
-            squashIt[tid] = instList[tid].end();
+            squash_it = inst_list.end();
 
             doneSquashing[tid] = true;
 
             return;
         }
 
-        InstIt tail_thread = instList[tid].end();
-        tail_thread--;
-
-        if ((*squashIt[tid]) == (*tail_thread))
+        if (inst == tail_inst)
             robTailUpdate = true;
 
-        squashIt[tid]--;
+        squash_it--;
     }
 
 
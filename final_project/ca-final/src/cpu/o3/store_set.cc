@@ -108,6 +108,34 @@ StoreSet::init(uint64_t clear_period, size_t _SSIT_entries,
 }
 
 
+StoreSet::StoreSetStats::StoreSetStats(statistics::Group *parent)
+    : statistics::Group(parent, "storeSet"),
+      ADD_STAT(violations, statistics::units::Count::get(),
+               "Memory-order violations reported to the predictor"),
+      ADD_STAT(violationsRepeat, statistics::units::Count::get(),
+               "Violations whose load/store pair was already in the same "
+               "store set"),
+      ADD_STAT(newStoreSets, statistics::units::Count::get(),
+               "Store sets created on first-time violations"),
+      ADD_STAT(storeSetMerges, statistics::units::Count::get(),
+               "Store set merges on cross-set violations"),
+      ADD_STAT(depsPredicted, statistics::units::Count::get(),
+               "Memory ops predicted dependent on an older in-flight store"),
+      ADD_STAT(newPairFraction, statistics::units::Ratio::get(),
+               "Fraction of violations the predictor had not yet learned"),
+      ADD_STAT(violatingLoadPCs, statistics::units::Count::get(),
+               "Violation counts per load PC")
+{
+    newPairFraction = (violations - violationsRepeat) / violations;
+    violatingLoadPCs.init(0);
+}
+
+void
+StoreSet::regStats(statistics::Group *parent)
+{
+    stats = std::make_unique<StoreSetStats>(parent);
+}
+
 void
 StoreSet::violation(Addr store_PC, Addr load_PC)
 {
@@ -117,10 +145,22 @@ StoreSet::violation(Addr store_PC, Addr load_PC)
     bool valid_load_SSID  = ld_entry && ld_entry->isValid();
     bool valid_store_SSID = st_entry && st_entry->isValid();
 
+    if (stats) {
+        stats->violations++;
+        stats->violatingLoadPCs.sample(load_PC, 1);
+        if (valid_load_SSID && valid_store_SSID &&
+            ld_entry->getSSID() == st_entry->getSSID()) {
+            stats->violationsRepeat++;
+        }
+    }
+
     if (!valid_load_SSID && !valid_store_SSID) {
         // Calculate a new SSID here.
         SSID new_set = calcSSID(load_PC);
 
+        if (stats)
+            stats->newStoreSets++;
+
         assert(new_set < LFSTSize);
 
         SSITEntry *ld_entry = SSIT.findVictim({load_PC});
@@ -160,6 +200,9 @@ StoreSet::violation(Addr store_PC, Addr load_PC)
 
         assert(load_SSID < LFSTSize && store_SSID < LFSTSize);
 
+        if (stats && store_SSID != load_SSID)
+            stats->storeSetMerges++;
+
         // The store set with the lower number wins
         if (store_SSID > load_SSID) {
             st_entry->setSSID(load_SSID);
@@ -256,6 +299,9 @@ StoreSet::checkInst(Addr PC)
             DPRINTF(StoreSet, "Inst %#x with SSID %i had LFST "
                     "inum of %i\n", PC, inst_SSID, LFST[inst_SSID]);
 
+            if (stats)
+                stats->depsPredicted++;
+
             return LFST[inst_SSID];
         }
     }
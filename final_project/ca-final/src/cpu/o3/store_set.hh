@@ -31,6 +31,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -38,6 +39,7 @@
 #include "base/cache/associative_cache.hh"
 #include "base/cache/cache_entry.hh"
 #include "base/named.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 
@@ -106,6 +108,11 @@ class StoreSet : public Named
               replacement_policy::Base *_replPolicy,
               BaseIndexingPolicy *_indexingPolicy, int LFST_size);
 
+    /** Create the predictor's statistics under the given parent
+     * group (normally the owning MemDepUnit's group). Until this is
+     * called no statistics are collected. */
+    void regStats(statistics::Group *parent);
+
     /** Records a memory ordering violation between the younger load
      * and the older store. */
     void violation(Addr store_PC, Addr load_PC);
@@ -177,6 +184,42 @@ class StoreSet : public Named
 
     /** Number of memory operations predicted since last clear of predictor */
     int memOpsPred;
+
+    /** Statistics surface for tuning memory-dependence speculation:
+     * how often violations are recorded, whether the predictor had
+     * already learned the offending pair, how many dependencies it
+     * enforces, and which load PCs keep violating. */
+    struct StoreSetStats : public statistics::Group
+    {
+        StoreSetStats(statistics::Group *parent);
+
+        /** Memory-order violations reported to the predictor. */
+        statistics::Scalar violations;
+
+        /** Violations whose load and store were already in the same
+         * store set; the predicted dependency failed to prevent the
+         * violation (LFST capacity or timing). */
+        statistics::Scalar violationsRepeat;
+
+        /** New store sets created on first-time violations. */
+        statistics::Scalar newStoreSets;
+
+        /** Store set merges on cross-set violations. */
+        statistics::Scalar storeSetMerges;
+
+        /** Memory ops predicted dependent on an older in-flight store. */
+        statistics::Scalar depsPredicted;
+
+        /** Fraction of violations the predictor had not yet learned
+         * (its learning coverage of the violation stream). */
+        statistics::Formula newPairFraction;
+
+        /** Violation counts per load PC. */
+        statistics::SparseHistogram violatingLoadPCs;
+    };
+
+    /** Created by regStats(); null until then. */
+    std::unique_ptr<StoreSetStats> stats;
 };
 
 } // namespace o3
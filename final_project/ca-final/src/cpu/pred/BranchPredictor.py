@@ -74,6 +74,17 @@ class ReturnAddrStack(SimObject):
     cxx_header = "cpu/pred/ras.hh"
 
     numThreads = Param.Unsigned(Parent.numThreads, "Number of threads")
+    dump_trace_file = Param.String(
+        "",
+        "Append every committed branch (pc, target, size, taken, type) "
+        "to this file for BranchTraceReplayer evaluation",
+    )
+    telemetry_top_k = Param.Unsigned(
+        0,
+        "Track the K hottest mispredicting PCs in a bounded table "
+        "(count-min admission) and export them per stats dump "
+        "(0 disables)",
+    )
     numEntries = Param.Unsigned(16, "Number of RAS entries")
 
 
@@ -152,6 +163,24 @@ class IndirectPredictor(SimObject):
     numThreads = Param.Unsigned(Parent.numThreads, "Number of threads")
 
 
+class ITTAGEIndirectPredictor(IndirectPredictor):
+    type = "ITTAGEIndirectPredictor"
+    cxx_class = "gem5::branch_prediction::ITTAGE"
+    cxx_header = "cpu/pred/ittage.hh"
+
+    num_tables = Param.Unsigned(6, "Number of tagged target tables")
+    table_entries = Param.Unsigned(
+        512, "Entries per tagged table (power of two)"
+    )
+    tag_bits = Param.Unsigned(12, "Partial tag bits per entry")
+    ctr_bits = Param.Unsigned(2, "Confidence counter bits per entry")
+    min_hist = Param.Unsigned(4, "Shortest global history length")
+    max_hist = Param.Unsigned(64, "Longest global history length (<= 64)")
+    instShiftAmt = Param.Unsigned(
+        Parent.instShiftAmt, "Number of bits to shift instructions by"
+    )
+
+
 class SimpleIndirectPredictor(IndirectPredictor):
     type = "SimpleIndirectPredictor"
     cxx_class = "gem5::branch_prediction::SimpleIndirectPredictor"
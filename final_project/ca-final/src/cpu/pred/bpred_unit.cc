@@ -43,9 +43,13 @@
 #include "cpu/pred/bpred_unit.hh"
 
 #include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
 
 #include "arch/generic/pcstate.hh"
 #include "base/compiler.hh"
+#include "base/output.hh"
 #include "base/trace.hh"
 #include "debug/Branch.hh"
 
@@ -64,8 +68,15 @@ BPredUnit::BPredUnit(const Params &params)
       btb(params.btb),
       ras(params.ras),
       iPred(params.indirectBranchPred),
+      traceDump(params.dump_trace_file.empty() ? nullptr :
+                simout.create(params.dump_trace_file)->stream()),
+      telemetryTopK(params.telemetry_top_k),
+      cmSketch{},
       stats(this)
 {
+    if (telemetryTopK > 0) {
+        statistics::registerDumpCallback([this]() { dumpTelemetry(); });
+    }
 }
 
 
@@ -357,6 +368,71 @@ BPredUnit::update(const InstSeqNum &done_sn, ThreadID tid)
     }
 }
 
+void
+BPredUnit::recordMispredictTelemetry(Addr pc, BranchType type)
+{
+    // count-min estimate: increment all rows, estimate is the minimum
+    uint32_t estimate = ~0u;
+    for (size_t row = 0; row < cmRows; row++) {
+        const uint64_t hash =
+            (pc >> instShiftAmt) * (0x9e3779b97f4a7c15ULL + 2 * row + 1);
+        uint32_t &counter = cmSketch[row][(hash >> 32) % cmWidth];
+        counter++;
+        estimate = std::min(estimate, counter);
+    }
+
+    auto it = telemetryTable.find(pc);
+    if (it != telemetryTable.end()) {
+        it->second.mispredicts++;
+        return;
+    }
+
+    const size_t capacity = 8 * telemetryTopK;
+    if (telemetryTable.size() < capacity) {
+        telemetryTable[pc] = {estimate, 0, type};
+        return;
+    }
+
+    // Admit only if the sketch says this PC outweighs the weakest
+    // tracked entry; evict that entry.
+    auto weakest = telemetryTable.begin();
+    for (auto probe = telemetryTable.begin(); probe != telemetryTable.end();
+         ++probe) {
+        if (probe->second.mispredicts < weakest->second.mispredicts)
+            weakest = probe;
+    }
+    if (estimate > weakest->second.mispredicts) {
+        telemetryTable.erase(weakest);
+        telemetryTable[pc] = {estimate, 0, type};
+    }
+}
+
+void
+BPredUnit::dumpTelemetry()
+{
+    // Export the K hottest tracked PCs, as deltas since the last dump
+    // so repeated stat dumps do not double count.
+    std::vector<std::pair<uint64_t, Addr>> ranked;
+    ranked.reserve(telemetryTable.size());
+    for (const auto &entry : telemetryTable) {
+        ranked.emplace_back(entry.second.mispredicts, entry.first);
+    }
+    const size_t keep = std::min<size_t>(telemetryTopK, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(),
+                      std::greater<>());
+
+    for (size_t i = 0; i < keep; i++) {
+        TelemetryEntry &entry = telemetryTable[ranked[i].second];
+        const uint64_t delta = entry.mispredicts - entry.dumped;
+        if (delta == 0)
+            continue;
+        entry.dumped = entry.mispredicts;
+        stats.mispredictTopPCs.sample(ranked[i].second, delta);
+        stats.mispredictTopPCsByType.sample(
+                (ranked[i].second << 4) | (uint64_t)entry.type, delta);
+    }
+}
+
 void
 BPredUnit::commitBranch(ThreadID tid, PredictorHistory* &hist)
 {
@@ -364,6 +440,9 @@ BPredUnit::commitBranch(ThreadID tid, PredictorHistory* &hist)
     stats.committed[tid][hist->type]++;
     if (hist->mispredict) {
         stats.mispredicted[tid][hist->type]++;
+        if (telemetryTopK > 0) {
+            recordMispredictTelemetry(hist->pc, hist->type);
+        }
         // stats for identifying miss-prediction due to BTB or predictor
         if (hist->actuallyTaken && !hist->btbHit) {
             stats.mispredictDueToBTBMiss[tid][hist->type]++;
@@ -379,6 +458,19 @@ BPredUnit::commitBranch(ThreadID tid, PredictorHistory* &hist)
                 hist->predTaken, hist->actuallyTaken,
                 hist->target->instAddr());
 
+    if (traceDump) {
+        // "<pc> <target> <size> <taken> <flags>", the format the
+        // BranchTraceReplayer consumes
+        const unsigned type_flags =
+            (hist->inst->isCondCtrl() ? 0x1 : 0) |
+            (hist->inst->isCall() ? 0x2 : 0) |
+            (hist->inst->isReturn() ? 0x4 : 0) |
+            (hist->inst->isDirectCtrl() ? 0x8 : 0);
+        ccprintf(*traceDump, "%x %x %d %d %d\n", hist->pc,
+                 hist->target->instAddr(), hist->inst->size(),
+                 hist->actuallyTaken ? 1 : 0, type_flags);
+    }
+
     // Update the branch predictor with the correct results.
     update(tid, hist->pc,
                 hist->actuallyTaken,
@@ -692,9 +784,19 @@ BPredUnit::BPredUnitStats::BPredUnitStats(BPredUnit *bp)
       ADD_STAT(indirectMisses, statistics::units::Count::get(),
                "Number of indirect misses."),
       ADD_STAT(indirectMispredicted, statistics::units::Count::get(),
-               "Number of mispredicted indirect branches.")
-
+               "Number of mispredicted indirect branches."),
+      ADD_STAT(mispredictTopPCs, statistics::units::Count::get(),
+               "Mispredicts per top-K PC (delta per dump)"),
+      ADD_STAT(mispredictTopPCsByType, statistics::units::Count::get(),
+               "Mispredicts per top-K (pc << 4 | branch type)")
 {
+    mispredictTopPCs
+        .init(0)
+        .flags(statistics::nozero);
+    mispredictTopPCsByType
+        .init(0)
+        .flags(statistics::nozero);
+
     using namespace statistics;
     BTBHitRatio.precision(6);
 
@@ -42,8 +42,12 @@
 #ifndef __CPU_PRED_BPRED_UNIT_HH__
 #define __CPU_PRED_BPRED_UNIT_HH__
 
+#include <array>
 #include <deque>
+#include <unordered_map>
+#include <iosfwd>
 
+#include "base/pooled_new.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -338,7 +342,7 @@ class BPredUnit : public SimObject
      *         +-------------------------------------+
      *
      */
-    struct PredictorHistory
+    struct PredictorHistory : public PooledNew<PredictorHistory>
     {
         /**
          * Makes a predictor history struct that contains any
@@ -489,6 +493,39 @@ class BPredUnit : public SimObject
     /** The indirect target predictor. */
     IndirectPredictor * iPred;
 
+    /**
+     * When set, every committed branch is appended to this stream in
+     * the BranchTraceReplayer format so predictors can be re-evaluated
+     * against the recorded stream without pipeline simulation.
+     */
+    std::ostream *traceDump;
+
+    /**
+     * Opt-in bounded telemetry of the branches that mispredict: a
+     * small count-min sketch estimates per-PC mispredict counts and
+     * admits candidates into a capacity-bounded table, whose top-K
+     * entries are exported on every stats dump. Enabled when
+     * telemetry_top_k is nonzero.
+     */
+    const unsigned telemetryTopK;
+
+    struct TelemetryEntry
+    {
+        uint64_t mispredicts = 0;
+        uint64_t dumped = 0;
+        BranchType type = BranchType::NoBranch;
+    };
+
+    static constexpr size_t cmRows = 4;
+    static constexpr size_t cmWidth = 1024;
+    std::array<std::array<uint32_t, cmWidth>, cmRows> cmSketch;
+
+    std::unordered_map<Addr, TelemetryEntry> telemetryTable;
+
+    void recordMispredictTelemetry(Addr pc, BranchType type);
+
+    void dumpTelemetry();
+
     /** Statistics */
     struct BPredUnitStats : public statistics::Group
     {
@@ -527,6 +564,12 @@ class BPredUnit : public SimObject
         statistics::Scalar indirectMisses;
         statistics::Scalar indirectMispredicted;
 
+
+        /** Top-K mispredicting PCs (count per PC since last dump). */
+        statistics::SparseHistogram mispredictTopPCs;
+
+        /** Same keyed by (pc << 4) | branch type. */
+        statistics::SparseHistogram mispredictTopPCsByType;
     } stats;
 
   protected:
@@ -48,11 +48,22 @@ namespace branch_prediction
 
 BranchTargetBuffer::BranchTargetBuffer(const Params &params)
     : ClockedObject(params),
+      ppBTBHit(nullptr), ppBTBMiss(nullptr),
       numThreads(params.numThreads),
       stats(this)
 {
 }
 
+void
+BranchTargetBuffer::regProbePoints()
+{
+    ClockedObject::regProbePoints();
+    ppBTBHit = new ProbePointArg<std::pair<Addr, BranchType>>(
+            getProbeManager(), "BTBHit");
+    ppBTBMiss = new ProbePointArg<std::pair<Addr, BranchType>>(
+            getProbeManager(), "BTBMiss");
+}
+
 BranchTargetBuffer::BranchTargetBufferStats::BranchTargetBufferStats(
                                                 statistics::Group *parent)
     : statistics::Group(parent),
@@ -43,7 +43,10 @@
 
 
 #include "arch/generic/pcstate.hh"
+#include <utility>
+
 #include "base/statistics.hh"
+#include "sim/probe/probe.hh"
 #include "cpu/pred/branch_type.hh"
 #include "cpu/static_inst.hh"
 #include "params/BranchTargetBuffer.hh"
@@ -98,6 +101,26 @@ class BranchTargetBuffer : public ClockedObject
                           BranchType type = BranchType::NoBranch,
                           StaticInstPtr inst = nullptr) = 0;
 
+    /**
+     * Record a lookup in the statistics and notify the Hit/Miss
+     * probe points (payload: branch PC and branch type). Subclasses
+     * should route their lookups through here so instrumentation sees
+     * every BTB access.
+     */
+    void
+    recordLookup(Addr pc, BranchType type, bool hit)
+    {
+        stats.lookups[type]++;
+        if (hit) {
+            ppBTBHit->notify(std::make_pair(pc, type));
+        } else {
+            stats.misses[type]++;
+            ppBTBMiss->notify(std::make_pair(pc, type));
+        }
+    }
+
+    void regProbePoints() override;
+
     /** Update BTB statistics
      */
     virtual void incorrectTarget(Addr inst_pc,
@@ -107,6 +130,11 @@ class BranchTargetBuffer : public ClockedObject
     }
 
   protected:
+    /** Probe points notified on every BTB lookup, with the branch PC
+     * and branch type as payload. */
+    ProbePointArg<std::pair<Addr, BranchType>> *ppBTBHit;
+    ProbePointArg<std::pair<Addr, BranchType>> *ppBTBMiss;
+
     /** Number of the threads for which the branch history is maintained. */
     const unsigned numThreads;
 
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2025 The University of Edinburgh
+ * All rights reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/ittage.hh"
+
+#include <cmath>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "debug/Indirect.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+ITTAGE::ITTAGE(const ITTAGEIndirectPredictorParams &params)
+    : IndirectPredictor(params),
+      numTables(params.num_tables),
+      logTableSize(floorLog2(params.table_entries)),
+      tagBits(params.tag_bits),
+      ctrBits(params.ctr_bits),
+      instShift(params.instShiftAmt),
+      stats(this, numTables)
+{
+    fatal_if(!isPowerOf2(params.table_entries),
+             "ITTAGE table_entries must be a power of two");
+    fatal_if(numTables < 2, "ITTAGE needs at least two tables");
+    fatal_if(params.max_hist > 64,
+             "ITTAGE keeps at most 64 bits of global history");
+    fatal_if(tagBits > 16, "ITTAGE tags are stored in 16 bits");
+    fatal_if(numTables >= logTableSize,
+             "ITTAGE needs num_tables < log2(table_entries)");
+
+    // geometric history lengths between min_hist and max_hist
+    histLengths.resize(numTables);
+    for (unsigned i = 0; i < numTables; i++) {
+        histLengths[i] = (int)(params.min_hist *
+                std::pow((double)params.max_hist / params.min_hist,
+                         (double)i / (numTables - 1)) + 0.5);
+    }
+
+    tables.resize(numTables);
+    for (auto &table : tables) {
+        table.resize(params.table_entries);
+    }
+
+    threadState.resize(params.numThreads);
+}
+
+void
+ITTAGE::reset()
+{
+    for (auto &table : tables) {
+        for (auto &entry : table) {
+            entry.tag = 0;
+            entry.ctr = 0;
+            entry.useful = 0;
+            entry.target.reset();
+        }
+    }
+    for (auto &state : threadState) {
+        state.ghist = 0;
+    }
+}
+
+unsigned
+ITTAGE::tableIndex(Addr pc, uint64_t ghist, int table) const
+{
+    const Addr shifted_pc = pc >> instShift;
+    unsigned index = shifted_pc ^ (shifted_pc >> (logTableSize - table)) ^
+        fold(ghist, histLengths[table], logTableSize);
+    return index & ((1u << logTableSize) - 1);
+}
+
+uint16_t
+ITTAGE::tableTag(Addr pc, uint64_t ghist, int table) const
+{
+    const Addr shifted_pc = pc >> instShift;
+    unsigned tag = shifted_pc ^
+        fold(ghist, histLengths[table], tagBits) ^
+        (fold(ghist, histLengths[table], tagBits - 1) << 1);
+    return tag & ((1u << tagBits) - 1);
+}
+
+const PCStateBase *
+ITTAGE::lookup(ThreadID tid, InstSeqNum sn, Addr pc, void * &i_history)
+{
+    assert(i_history == nullptr);
+
+    ITTAGEHistory *history = new ITTAGEHistory;
+    i_history = static_cast<void *>(history);
+
+    history->ghist = threadState[tid].ghist;
+    history->pcAddr = pc;
+    history->wasIndirect = true;
+
+    history->indices.resize(numTables);
+    history->tags.resize(numTables);
+    for (unsigned t = 0; t < numTables; t++) {
+        history->indices[t] = tableIndex(pc, history->ghist, t);
+        history->tags[t] = tableTag(pc, history->ghist, t);
+    }
+
+    stats.lookups++;
+
+    // longest history match provides the target
+    for (int t = numTables - 1; t >= 0; t--) {
+        const TableEntry &entry = tables[t][history->indices[t]];
+        if (entry.target && entry.tag == history->tags[t]) {
+            history->hit = true;
+            history->provider = t;
+            stats.hitsPerTable[t]++;
+            DPRINTF(Indirect, "ITTAGE hit PC:%#x table:%d target:%s\n",
+                    pc, t, *entry.target);
+            return entry.target.get();
+        }
+    }
+
+    stats.misses++;
+    DPRINTF(Indirect, "ITTAGE miss PC:%#x\n", pc);
+    return nullptr;
+}
+
+void
+ITTAGE::insertHistory(ThreadState &state, bool taken, bool indirect,
+                      Addr target_addr) const
+{
+    // one direction bit per branch, plus two target bits for
+    // indirect branches to separate different dynamic targets
+    state.ghist = (state.ghist << 1) | (taken ? 1 : 0);
+    if (indirect) {
+        state.ghist =
+            (state.ghist << 2) | ((target_addr >> instShift) & 0x3);
+    }
+}
+
+void
+ITTAGE::update(ThreadID tid, InstSeqNum sn, Addr pc, bool squash,
+               bool taken, const PCStateBase &target, BranchType br_type,
+               void * &i_history)
+{
+    if (i_history == nullptr) {
+        // no lookup was performed for this branch; record only its
+        // history contribution
+        ITTAGEHistory *history = new ITTAGEHistory;
+        history->ghist = threadState[tid].ghist;
+        history->pcAddr = pc;
+        i_history = static_cast<void *>(history);
+    }
+    ITTAGEHistory *history = static_cast<ITTAGEHistory *>(i_history);
+
+    if (squash) {
+        // the speculative insert below this branch was wrong; redo it
+        // with the corrected outcome
+        threadState[tid].ghist = history->ghist;
+        history->mispredicted = true;
+    }
+
+    insertHistory(threadState[tid], taken, history->wasIndirect,
+                  target.instAddr());
+
+    // On a squash of an indirect branch the predicted target was
+    // wrong: train the tables with the correct one.
+    if (squash && history->wasIndirect && taken) {
+        recordTarget(tid, history, target);
+    }
+}
+
+void
+ITTAGE::recordTarget(ThreadID tid, ITTAGEHistory *history,
+                     const PCStateBase &target)
+{
+    stats.targetRecords++;
+
+    const uint8_t ctr_max = (1 << ctrBits) - 1;
+
+    if (history->hit) {
+        TableEntry &provider =
+            tables[history->provider][history->indices[history->provider]];
+        if (provider.tag == history->tags[history->provider] &&
+            provider.target) {
+            if (provider.target->instAddr() == target.instAddr()) {
+                if (provider.ctr < ctr_max)
+                    provider.ctr++;
+                return;
+            } else if (provider.ctr > 0) {
+                provider.ctr--;
+            } else {
+                set(provider.target, target);
+                provider.ctr = 0;
+            }
+        }
+    }
+
+    // Allocate an entry with a longer history than the provider (or
+    // from the first table on a complete miss), preferring entries
+    // whose useful counter has decayed.
+    const int start = history->hit ? history->provider + 1 : 0;
+    for (int t = start; t < (int)numTables; t++) {
+        TableEntry &entry = tables[t][history->indices[t]];
+        if (!entry.target || entry.useful == 0) {
+            entry.tag = history->tags[t];
+            entry.ctr = 0;
+            entry.useful = 0;
+            set(entry.target, target);
+            stats.allocations++;
+            return;
+        }
+        entry.useful--;
+    }
+}
+
+void
+ITTAGE::squash(ThreadID tid, InstSeqNum sn, void * &i_history)
+{
+    if (i_history == nullptr)
+        return;
+
+    ITTAGEHistory *history = static_cast<ITTAGEHistory *>(i_history);
+
+    // revert this branch's speculative history contribution
+    threadState[tid].ghist = history->ghist;
+
+    delete history;
+    i_history = nullptr;
+}
+
+void
+ITTAGE::commit(ThreadID tid, InstSeqNum sn, void * &i_history)
+{
+    if (i_history == nullptr)
+        return;
+
+    ITTAGEHistory *history = static_cast<ITTAGEHistory *>(i_history);
+
+    // A committed indirect prediction that was never corrected was
+    // right: strengthen the provider and mark it useful.
+    if (history->hit && !history->mispredicted) {
+        TableEntry &provider =
+            tables[history->provider][history->indices[history->provider]];
+        if (provider.tag == history->tags[history->provider] &&
+            provider.target) {
+            if (provider.ctr < ((1 << ctrBits) - 1))
+                provider.ctr++;
+            if (provider.useful < 3)
+                provider.useful++;
+        }
+    }
+
+    delete history;
+    i_history = nullptr;
+}
+
+ITTAGE::ITTAGEStats::ITTAGEStats(statistics::Group *parent,
+                                 unsigned num_tables)
+    : statistics::Group(parent),
+      ADD_STAT(lookups, statistics::units::Count::get(),
+               "Number of indirect target lookups"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Lookups with no tag match in any table"),
+      ADD_STAT(hitsPerTable, statistics::units::Count::get(),
+               "Provider hits per history-length table"),
+      ADD_STAT(targetRecords, statistics::units::Count::get(),
+               "Mispredicted indirect targets trained"),
+      ADD_STAT(allocations, statistics::units::Count::get(),
+               "New table entries allocated")
+{
+    hitsPerTable.init(num_tables);
+}
+
+} // namespace branch_prediction
+} // namespace gem5
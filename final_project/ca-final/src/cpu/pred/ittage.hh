@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2025 The University of Edinburgh
+ * All rights reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * ITTAGE-style indirect target predictor: tagged target tables indexed
+ * with geometrically increasing global-history lengths, longest match
+ * providing the target (Seznec & Michaud, "A case for (partially)
+ * TAgged GEometric history length branch prediction").
+ */
+
+#ifndef __CPU_PRED_ITTAGE_HH__
+#define __CPU_PRED_ITTAGE_HH__
+
+#include <memory>
+#include <vector>
+
+#include "base/pooled_new.hh"
+#include "base/statistics.hh"
+#include "cpu/pred/indirect.hh"
+#include "params/ITTAGEIndirectPredictor.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+class ITTAGE : public IndirectPredictor
+{
+  public:
+    ITTAGE(const ITTAGEIndirectPredictorParams &params);
+
+    void reset() override;
+
+    const PCStateBase *lookup(ThreadID tid, InstSeqNum sn, Addr pc,
+                              void * &i_history) override;
+    void update(ThreadID tid, InstSeqNum sn, Addr pc, bool squash,
+                bool taken, const PCStateBase &target,
+                BranchType br_type, void * &i_history) override;
+    void squash(ThreadID tid, InstSeqNum sn, void * &i_history) override;
+    void commit(ThreadID tid, InstSeqNum sn, void * &i_history) override;
+
+  private:
+    /** One tagged table entry. */
+    struct TableEntry
+    {
+        uint16_t tag = 0;
+        uint8_t ctr = 0;
+        uint8_t useful = 0;
+        std::unique_ptr<PCStateBase> target;
+    };
+
+    /**
+     * Per-branch history record. Snapshots the 64-bit global history
+     * (restored on squash, exactly like SimpleIndirect's GHR
+     * snapshot) plus the provider and per-table indices/tags computed
+     * at lookup so commit and target recording do not recompute them.
+     */
+    struct ITTAGEHistory : public PooledNew<ITTAGEHistory>
+    {
+        uint64_t ghist;
+        Addr pcAddr = 0;
+        bool wasIndirect = false;
+        bool hit = false;
+        bool mispredicted = false;
+        int provider = -1;
+        std::vector<unsigned> indices;
+        std::vector<uint16_t> tags;
+    };
+
+    /** Per-thread speculative global history, youngest bit at 0. */
+    struct ThreadState
+    {
+        uint64_t ghist = 0;
+    };
+
+    unsigned tableIndex(Addr pc, uint64_t ghist, int table) const;
+    uint16_t tableTag(Addr pc, uint64_t ghist, int table) const;
+
+    /** Fold the low len bits of hist down to width bits. */
+    static unsigned
+    fold(uint64_t hist, int len, int width)
+    {
+        hist &= (len >= 64) ? ~0ULL : ((1ULL << len) - 1);
+        unsigned folded = 0;
+        while (hist) {
+            folded ^= hist & ((1ULL << width) - 1);
+            hist >>= width;
+        }
+        return folded;
+    }
+
+    /** Insert this branch's outcome bits into the global history. */
+    void insertHistory(ThreadState &state, bool taken, bool indirect,
+                       Addr target_addr) const;
+
+    /** Learn from a resolved indirect branch. */
+    void recordTarget(ThreadID tid, ITTAGEHistory *history,
+                      const PCStateBase &target);
+
+    const unsigned numTables;
+    const unsigned logTableSize;
+    const unsigned tagBits;
+    const unsigned ctrBits;
+    const unsigned instShift;
+
+    /** Geometric per-table history lengths. */
+    std::vector<int> histLengths;
+
+    /** tables[t][index] */
+    std::vector<std::vector<TableEntry>> tables;
+
+    std::vector<ThreadState> threadState;
+
+    struct ITTAGEStats : public statistics::Group
+    {
+        ITTAGEStats(statistics::Group *parent,
+                    unsigned num_tables);
+        statistics::Scalar lookups;
+        statistics::Scalar misses;
+        statistics::Vector hitsPerTable;
+        statistics::Scalar targetRecords;
+        statistics::Scalar allocations;
+    } stats;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_ITTAGE_HH__
@@ -75,7 +75,8 @@ LoopPredictor::LoopPredictor(const LoopPredictorParams &p)
     initialLoopIter(p.initialLoopIter),
     initialLoopAge(p.initialLoopAge),
     optionalAgeReset(p.optionalAgeReset),
-    stats(this)
+    stats(this),
+    ppLoopExitMispredict(nullptr)
 {
     assert(initialLoopAge <= ((1 << loopTableAgeBits) - 1));
 }
@@ -197,6 +198,11 @@ LoopPredictor::loopUpdate(Addr pc, bool taken, BranchInfo* bi, bool tage_pred)
         //already a hit
         if (bi->loopPredValid) {
             if (taken != bi->loopPred) {
+                stats.exitMispredicts++;
+                stats.confidenceAtMispredict.sample(
+                        ltable[idx].confidence);
+                ppLoopExitMispredict->notify(pc);
+
                 // free the entry
                 ltable[idx].numIter = 0;
                 ltable[idx].age = 0;
@@ -241,7 +247,9 @@ LoopPredictor::loopUpdate(Addr pc, bool taken, BranchInfo* bi, bool tage_pred)
                     // first complete nest;
                     ltable[idx].confidence = 0;
                     ltable[idx].numIter = ltable[idx].currentIter;
+                    stats.tripCounts.sample(ltable[idx].numIter);
                 } else {
+                    stats.tripCountChanged++;
                     //not the same number of iterations as last time: free the
                     //entry
                     ltable[idx].numIter = 0;
@@ -265,6 +273,7 @@ LoopPredictor::loopUpdate(Addr pc, bool taken, BranchInfo* bi, bool tage_pred)
                     DPRINTF(LTage,
                             "Allocating loop pred entry for branch %lx\n",
                             pc);
+                    stats.allocations++;
                     ltable[idx].dir = !taken; // ignored if no useDirectionBit
                     ltable[idx].tag = bi->loopTag;
                     ltable[idx].numIter = 0;
@@ -375,8 +384,28 @@ LoopPredictor::LoopPredictorStats::LoopPredictorStats(
                "prediction is correct"),
       ADD_STAT(wrong, statistics::units::Count::get(),
                "Number of times the loop predictor is the provider and the "
-               "prediction is wrong")
+               "prediction is wrong"),
+      ADD_STAT(allocations, statistics::units::Count::get(),
+               "Entries allocated for new candidate loops"),
+      ADD_STAT(exitMispredicts, statistics::units::Count::get(),
+               "Loop-exit mispredictions (entry freed)"),
+      ADD_STAT(confidenceAtMispredict, statistics::units::Count::get(),
+               "Confidence an entry had reached when it mispredicted"),
+      ADD_STAT(tripCounts, statistics::units::Count::get(),
+               "Trip counts when a loop's iteration count is learned"),
+      ADD_STAT(tripCountChanged, statistics::units::Count::get(),
+               "Learned loops whose trip count changed")
+{
+    confidenceAtMispredict.init(8);
+    tripCounts.init(16);
+}
+
+void
+LoopPredictor::regProbePoints()
 {
+    SimObject::regProbePoints();
+    ppLoopExitMispredict =
+        new ProbePointArg<Addr>(getProbeManager(), "LoopExitMispredict");
 }
 
 size_t
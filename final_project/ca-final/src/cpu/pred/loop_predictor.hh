@@ -47,6 +47,7 @@
 #include "base/random.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
+#include "sim/probe/probe.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -108,8 +109,34 @@ class LoopPredictor : public SimObject
         statistics::Scalar used;
         statistics::Scalar correct;
         statistics::Scalar wrong;
+
+        /** Entries allocated for new candidate loops. */
+        statistics::Scalar allocations;
+
+        /** Predictions that missed an actual loop exit (or predicted
+         * one that did not happen); the entry is freed. */
+        statistics::Scalar exitMispredicts;
+
+        /** Confidence the entry had reached when it mispredicted an
+         * exit. */
+        statistics::Histogram confidenceAtMispredict;
+
+        /** Trip counts captured when a loop's iteration count is
+         * first learned. */
+        statistics::Histogram tripCounts;
+
+        /** Learned loops whose trip count changed (entry freed). */
+        statistics::Scalar tripCountChanged;
     } stats;
 
+    /** Notified with the branch PC on every loop-exit mispredict. */
+    ProbePointArg<Addr> *ppLoopExitMispredict;
+
+  public:
+    void regProbePoints() override;
+
+  protected:
+
     /**
      * Updates an unsigned counter based on up/down parameter
      * @param ctr Reference to counter to update.
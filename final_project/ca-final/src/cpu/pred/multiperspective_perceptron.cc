@@ -50,6 +50,8 @@
 
 #include "cpu/pred/multiperspective_perceptron.hh"
 
+#include <algorithm>
+
 #include "debug/Branch.hh"
 
 namespace gem5
@@ -266,23 +268,17 @@ MultiperspectivePerceptron::findBest(ThreadID tid,
     if (threshold < 0) {
         return;
     }
-    struct BestPair
-    {
-        int index;
-        int mpreds;
-        bool operator<(BestPair const &bp) const
-        {
-            return mpreds < bp.mpreds;
-        }
-    };
-    std::vector<BestPair> pairs(best_preds.size());
+    // rank (mpreds, index) pairs in the reused scratch buffer; only
+    // the nbest head needs to be ordered
+    rankScratch.resize(best_preds.size());
     for (int i = 0; i < best_preds.size(); i += 1) {
-        pairs[i].index = i;
-        pairs[i].mpreds = threadData[tid]->mpreds[i];
+        rankScratch[i] = {threadData[tid]->mpreds[i], i};
     }
-    std::sort(pairs.begin(), pairs.end());
-    for (int i = 0; i < (std::min(nbest, (int) best_preds.size())); i += 1) {
-        best_preds[i] = pairs[i].index;
+    const int keep = std::min(nbest, (int) best_preds.size());
+    std::partial_sort(rankScratch.begin(), rankScratch.begin() + keep,
+                      rankScratch.end());
+    for (int i = 0; i < keep; i += 1) {
+        best_preds[i] = rankScratch[i].second;
     }
 }
 
@@ -320,8 +316,9 @@ MultiperspectivePerceptron::getIndex(ThreadID tid, const MPPBranchInfo &bi,
 int
 MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
 {
-    // list of best predictors
-    std::vector<int> best_preds(specs.size(), -1);
+    // list of best predictors, in reused scratch storage
+    bestPredsScratch.assign(specs.size(), -1);
+    std::vector<int> &best_preds = bestPredsScratch;
 
     // initialize sum
     bi.yout = 0;
@@ -343,6 +340,18 @@ MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
     // branch
     findBest(tid, best_preds);
 
+    // mark the best features once so the summation loop tests
+    // membership in O(1) instead of rescanning the list per feature
+    isBestScratch.assign(specs.size(), 0);
+    if (threshold >= 0) {
+        for (int j = 0; j < std::min(nbest, (int) best_preds.size());
+             j += 1) {
+            if (best_preds[j] >= 0) {
+                isBestScratch[best_preds[j]] = 1;
+            }
+        }
+    }
+
     // begin computation of the sum for low-confidence branch
     int bestval = 0;
 
@@ -363,16 +372,8 @@ MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
         // add the value
         bi.yout += val;
         // if this is one of those good features, add the value to bestval
-        if (threshold >= 0) {
-            for (int j = 0;
-                 j < std::min(nbest, (int) best_preds.size());
-                 j += 1)
-            {
-                if (best_preds[j] == i) {
-                    bestval += val;
-                    break;
-                }
-            }
+        if (threshold >= 0 && isBestScratch[i]) {
+            bestval += val;
         }
     }
     // apply a fudge factor to affect when training is triggered
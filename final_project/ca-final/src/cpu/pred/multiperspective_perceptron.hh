@@ -52,6 +52,7 @@
 #define __CPU_PRED_MULTIPERSPECTIVE_PERCEPTRON_HH__
 
 #include <array>
+#include <utility>
 #include <vector>
 
 #include "base/random.hh"
@@ -373,6 +374,15 @@ class MultiperspectivePerceptron : public BPredUnit
     };
     std::vector<ThreadData *> threadData;
 
+    /**
+     * Scratch buffers reused across computeOutput() calls so the
+     * per-prediction hot path stays allocation-free (predictions are
+     * sequential on one event thread).
+     */
+    mutable std::vector<int> bestPredsScratch;
+    mutable std::vector<uint8_t> isBestScratch;
+    mutable std::vector<std::pair<int, int>> rankScratch;
+
     /** Predictor tables */
     std::vector<HistorySpec *> specs;
     std::vector<int> table_sizes;
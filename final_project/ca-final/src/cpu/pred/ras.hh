@@ -44,6 +44,7 @@
 #include <vector>
 
 #include "arch/generic/pcstate.hh"
+#include "base/pooled_new.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/pred/branch_type.hh"
@@ -181,7 +182,7 @@ class ReturnAddrStack : public SimObject
 
   private:
 
-    class RASHistory
+    class RASHistory : public PooledNew<RASHistory>
     {
       public:
         /* Was the RAS pushed or poped for this branch. */
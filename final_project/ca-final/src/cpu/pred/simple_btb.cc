@@ -86,15 +86,14 @@ SimpleBTB::valid(ThreadID tid, Addr instPC)
 const PCStateBase *
 SimpleBTB::lookup(ThreadID tid, Addr instPC, BranchType type)
 {
-    stats.lookups[type]++;
-
     BTBEntry *entry = btb.accessEntry({instPC, tid});
 
+    recordLookup(instPC, type, entry != nullptr);
+
     if (entry) {
         return entry->target.get();
     }
 
-    stats.misses[type]++;
     return nullptr;
 }
 
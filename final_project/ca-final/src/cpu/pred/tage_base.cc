@@ -38,6 +38,8 @@
 
 #include "cpu/pred/tage_base.hh"
 
+#include <algorithm>
+
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "debug/Fetch.hh"
@@ -144,6 +146,16 @@ TAGEBase::init()
 
     tableIndices = new int [nHistoryTables+1];
     tableTags = new int [nHistoryTables+1];
+
+    clampedHistLengths.resize(nHistoryTables + 1);
+    for (int i = 1; i <= nHistoryTables; i++) {
+        clampedHistLengths[i] = std::min(histLengths[i], pathHistBits);
+    }
+    pathHashCache.resize(threadHistory.size());
+    for (auto &cache : pathHashCache) {
+        cache.f.resize(nHistoryTables + 1, 0);
+    }
+
     initialized = true;
 }
 
@@ -206,19 +218,30 @@ TAGEBase::F(int A, int size, int bank) const
     return (A);
 }
 
+int
+TAGEBase::cachedF(ThreadID tid, int bank) const
+{
+    PathHashCache &cache = pathHashCache[tid];
+    if (cache.pathHist != threadHistory[tid].pathHist) {
+        cache.pathHist = threadHistory[tid].pathHist;
+        for (int i = 1; i <= nHistoryTables; i++) {
+            cache.f[i] = F(cache.pathHist, clampedHistLengths[i], i);
+        }
+    }
+    return cache.f[bank];
+}
+
 // gindex computes a full hash of pc, ghist and pathHist
 int
 TAGEBase::gindex(ThreadID tid, Addr pc, int bank) const
 {
     int index;
-    int hlen = (histLengths[bank] > pathHistBits) ? pathHistBits :
-                                                    histLengths[bank];
     const unsigned int shiftedPc = pc >> instShiftAmt;
     index =
         shiftedPc ^
         (shiftedPc >> ((int) abs(logTagTableSizes[bank] - bank) + 1)) ^
         threadHistory[tid].computeIndices[bank].comp ^
-        F(threadHistory[tid].pathHist, hlen, bank);
+        cachedF(tid, bank);
 
     return (index & ((1ULL << (logTagTableSizes[bank])) - 1));
 }
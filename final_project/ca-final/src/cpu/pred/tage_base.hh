@@ -51,6 +51,7 @@
 
 #include <vector>
 
+#include "base/pooled_new.hh"
 #include "base/statistics.hh"
 #include "cpu/null_static_inst.hh"
 #include "cpu/static_inst.hh"
@@ -133,7 +134,7 @@ class TAGEBase : public SimObject
     };
 
     // Primary branch history entry
-    struct BranchInfo
+    struct BranchInfo : public PooledNew<BranchInfo>
     {
         const Addr branchPC;
         const bool condBranch;
@@ -234,6 +235,27 @@ class TAGEBase : public SimObject
      */
     virtual int F(int phist, int size, int bank) const;
 
+    /**
+     * The path-history hash F() only changes when a branch inserts or
+     * rolls back history, but it used to be recomputed for every
+     * table on every prediction. This per-thread cache recomputes all
+     * banks once per distinct path-history value and reuses them
+     * across the per-table index calculations and across
+     * re-predictions after squashes.
+     */
+    struct PathHashCache
+    {
+        int pathHist = -1;
+        std::vector<int> f;
+    };
+    mutable std::vector<PathHashCache> pathHashCache;
+
+    /** Per-bank history lengths clamped to pathHistBits. */
+    std::vector<int> clampedHistLengths;
+
+    /** F(pathHist, ...) for the given bank, through the cache. */
+    int cachedF(ThreadID tid, int bank) const;
+
     /**
      * Computes the partial tag of a tagged table.
      * @param tid the thread ID used to select the
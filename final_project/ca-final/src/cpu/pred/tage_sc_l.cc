@@ -194,14 +194,12 @@ int
 TAGE_SC_L_TAGE::gindex(ThreadID tid, Addr pc, int bank) const
 {
     int index;
-    int hlen = (histLengths[bank] > pathHistBits) ? pathHistBits :
-                                                    histLengths[bank];
     unsigned int shifted_pc = pc >> instShiftAmt;
 
     index = shifted_pc ^
             (shifted_pc >> ((int) abs(logTagTableSizes[bank] - bank) + 1)) ^
             threadHistory[tid].computeIndices[bank].comp ^
-            F(threadHistory[tid].pathHist, hlen, bank);
+            cachedF(tid, bank);
 
     index = gindex_ext(index, bank);
 
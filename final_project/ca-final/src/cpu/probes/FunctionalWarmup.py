@@ -0,0 +1,64 @@
+# Copyright (c) 2025 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.Probe import ProbeListenerObject
+from m5.params import *
+from m5.proxy import *
+
+
+class FunctionalWarmup(ProbeListenerObject):
+    """
+    Records a compact warmup trace (recently touched memory lines and
+    branch targets) while fast-forwarding, checkpoints it alongside the
+    simulation state, and functionally replays it into caches and the
+    BTB at restore time so detailed simulation starts warm.
+
+    On the recording side, `manager` (inherited) should point at the
+    fast-forward CPU whose "Commit" probe provides the branch trace,
+    and `memories` at the memories whose "Access" probe provides the
+    touched-line trace. On the restore side, `caches`, `btb` and `cpu`
+    name the structures to warm.
+    """
+
+    type = "FunctionalWarmup"
+    cxx_header = "cpu/probes/functional_warmup.hh"
+    cxx_class = "gem5::FunctionalWarmup"
+
+    memories = VectorParam.AbstractMemory(
+        [], "memories providing the touched-line trace while recording"
+    )
+    caches = VectorParam.BaseCache([], "caches to warm at restore time")
+    btb = Param.BranchTargetBuffer(NULL, "BTB to warm at restore time")
+    cpu = Param.BaseCPU(
+        NULL, "CPU whose ISA builds branch target PC states at restore"
+    )
+    block_size = Param.Unsigned(64, "line granularity of the memory trace")
+    max_lines = Param.Unsigned(
+        1048576, "maximum number of distinct memory lines kept"
+    )
+    max_branches = Param.Unsigned(
+        65536, "maximum number of distinct branch entries kept"
+    )
@@ -0,0 +1,63 @@
+# Copyright (c) 2025 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.Probe import ProbeListenerObject
+from m5.params import *
+from m5.proxy import *
+
+
+class IntervalPhaseTracker(ProbeListenerObject):
+    """Streams per-interval (IPC, MPKI, branch-MPKI) tuples to a
+    compact binary trace and detects phase changes online. On a
+    detected change it can raise a "phase change detected" exit
+    event, letting the config script take a checkpoint, so one run
+    produces both the phase map and the checkpoints.
+    """
+
+    type = "IntervalPhaseTracker"
+    cxx_header = "cpu/probes/interval_stats.hh"
+    cxx_class = "gem5::IntervalPhaseTracker"
+
+    cpu = Param.BaseCPU("CPU whose retired instructions pace intervals")
+    caches = VectorParam.BaseCache([], "Caches whose misses feed MPKI")
+    branch_pred = Param.BranchPredictor(
+        NULL, "Branch predictor whose mispredictions feed branch MPKI"
+    )
+
+    interval_insts = Param.UInt64(
+        100000, "Instructions per measurement interval"
+    )
+    phase_threshold = Param.Float(
+        0.25,
+        "Relative change in any of IPC/MPKI/branch-MPKI between "
+        "consecutive intervals that counts as a phase change",
+    )
+    exit_on_phase_change = Param.Bool(
+        False, "Raise an exit event when a phase change is detected"
+    )
+    trace_file = Param.String(
+        "intervals.bin", "Binary interval trace file (in the output dir)"
+    )
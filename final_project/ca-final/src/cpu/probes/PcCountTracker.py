@@ -44,6 +44,8 @@ class PcCountTrackerManager(SimObject):
     cxx_exports = [
         PyBindMethod("getPcCount"),
         PyBindMethod("getCurrentPcCountPair"),
+        PyBindMethod("getCurrentPC"),
+        PyBindMethod("getCurrentCount"),
     ]
 
     targets = VectorParam.PcCountPair("the target PC Count pairs")
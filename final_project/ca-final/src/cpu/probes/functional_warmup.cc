@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/probes/functional_warmup.hh"
+
+#include <zlib.h>
+
+#include <algorithm>
+
+#include "arch/generic/isa.hh"
+#include "base/logging.hh"
+#include "cpu/base.hh"
+#include "cpu/pred/btb.hh"
+#include "cpu/simple/thread.hh"
+#include "cpu/thread_context.hh"
+#include "debug/FunctionalWarmup.hh"
+#include "mem/abstract_mem.hh"
+#include "mem/cache/base.hh"
+#include "sim/serialize.hh"
+
+namespace gem5
+{
+
+FunctionalWarmup::FunctionalWarmup(const FunctionalWarmupParams &params)
+    : ProbeListenerObject(params),
+      memories(params.memories.begin(), params.memories.end()),
+      caches(params.caches.begin(), params.caches.end()),
+      btb(params.btb),
+      cpu(params.cpu),
+      lineMask(~Addr(params.block_size - 1)),
+      maxLines(params.max_lines),
+      maxBranches(params.max_branches),
+      seq(0),
+      pendingPC(0),
+      pendingValid(false),
+      restored(false)
+{
+    fatal_if(params.block_size == 0 ||
+             (params.block_size & (params.block_size - 1)) != 0,
+             "%s: block_size must be a power of two", name());
+}
+
+void
+FunctionalWarmup::regProbeListeners()
+{
+    if (!listeners.empty())
+        return;
+
+    // The manager (if any) is the fast-forward CPU providing the
+    // branch trace.
+    if (getProbeManager()) {
+        connectListener<CommitListener>(
+            this, "Commit", &FunctionalWarmup::noteCommit);
+    }
+
+    for (auto *mem : memories) {
+        listeners.push_back(mem->getProbeManager()->connect<AccessListener>(
+            this, "Access", &FunctionalWarmup::noteAccess));
+    }
+}
+
+void
+FunctionalWarmup::noteCommit(
+        const std::pair<SimpleThread *, const StaticInstPtr> &p)
+{
+    SimpleThread *thread = p.first;
+    const StaticInstPtr &inst = p.second;
+    const Addr pc = thread->pcState().instAddr();
+
+    if (pendingValid) {
+        // this commit's pc is the previous indirect branch's target
+        recordBranch(pendingPC, pc);
+        pendingValid = false;
+    }
+
+    if (!inst->isControl())
+        return;
+
+    if (inst->isDirectCtrl()) {
+        std::unique_ptr<PCStateBase> target =
+            inst->branchTarget(thread->pcState());
+        recordBranch(pc, target->instAddr());
+    } else {
+        pendingPC = pc;
+        pendingValid = true;
+    }
+}
+
+void
+FunctionalWarmup::noteAccess(const PacketPtr &pkt)
+{
+    lines[pkt->getAddr() & lineMask] = ++seq;
+    if (lines.size() > 2 * maxLines)
+        pruneLines();
+}
+
+void
+FunctionalWarmup::recordBranch(Addr pc, Addr target)
+{
+    if (branches.size() >= maxBranches &&
+        branches.find(pc) == branches.end()) {
+        return;
+    }
+    branches[pc] = target;
+}
+
+void
+FunctionalWarmup::pruneLines()
+{
+    // Keep the maxLines most recently touched lines.
+    std::vector<uint64_t> seqs;
+    seqs.reserve(lines.size());
+    for (const auto &entry : lines)
+        seqs.push_back(entry.second);
+
+    std::nth_element(seqs.begin(), seqs.end() - maxLines, seqs.end());
+    const uint64_t cutoff = *(seqs.end() - maxLines);
+
+    for (auto it = lines.begin(); it != lines.end(); ) {
+        if (it->second < cutoff)
+            it = lines.erase(it);
+        else
+            ++it;
+    }
+}
+
+void
+FunctionalWarmup::serialize(CheckpointOut &cp) const
+{
+    // The bulk of the trace goes into a sideband file, like the
+    // physical memory image.
+    const std::string filename = name() + ".warmup";
+    SERIALIZE_SCALAR(filename);
+
+    // oldest first, so the replay leaves sensible replacement state
+    std::vector<std::pair<uint64_t, Addr>> ordered;
+    ordered.reserve(lines.size());
+    for (const auto &entry : lines)
+        ordered.emplace_back(entry.second, entry.first);
+    std::sort(ordered.begin(), ordered.end());
+
+    const std::string filepath = CheckpointIn::dir() + "/" + filename;
+    gzFile out = gzopen(filepath.c_str(), "wb");
+    if (out == NULL)
+        fatal("%s: can't open warmup trace '%s'\n", name(), filepath);
+
+    auto write = [this, out, &filepath](const void *data, unsigned len) {
+        if (gzwrite(out, data, len) != (int)len)
+            fatal("%s: write failed on warmup trace '%s'\n", name(),
+                  filepath);
+    };
+
+    const uint64_t nbr_lines = ordered.size();
+    write(&nbr_lines, sizeof(nbr_lines));
+    for (const auto &entry : ordered)
+        write(&entry.second, sizeof(Addr));
+
+    const uint64_t nbr_branches = branches.size();
+    write(&nbr_branches, sizeof(nbr_branches));
+    for (const auto &entry : branches) {
+        write(&entry.first, sizeof(Addr));
+        write(&entry.second, sizeof(Addr));
+    }
+
+    if (gzclose(out))
+        fatal("%s: close failed on warmup trace '%s'\n", name(), filepath);
+}
+
+void
+FunctionalWarmup::unserialize(CheckpointIn &cp)
+{
+    std::string filename;
+    UNSERIALIZE_SCALAR(filename);
+    const std::string filepath = cp.getCptDir() + "/" + filename;
+
+    gzFile in = gzopen(filepath.c_str(), "rb");
+    if (in == NULL)
+        fatal("%s: can't open warmup trace '%s'\n", name(), filepath);
+
+    auto read = [this, in, &filepath](void *data, unsigned len) {
+        if (gzread(in, data, len) != (int)len)
+            fatal("%s: read failed on warmup trace '%s'\n", name(),
+                  filepath);
+    };
+
+    uint64_t nbr_lines;
+    read(&nbr_lines, sizeof(nbr_lines));
+    warmLines.resize(nbr_lines);
+    for (auto &line : warmLines)
+        read(&line, sizeof(Addr));
+
+    uint64_t nbr_branches;
+    read(&nbr_branches, sizeof(nbr_branches));
+    warmBranches.resize(nbr_branches);
+    for (auto &entry : warmBranches) {
+        read(&entry.first, sizeof(Addr));
+        read(&entry.second, sizeof(Addr));
+    }
+
+    if (gzclose(in))
+        fatal("%s: close failed on warmup trace '%s'\n", name(), filepath);
+
+    restored = true;
+}
+
+void
+FunctionalWarmup::startup()
+{
+    if (!restored)
+        return;
+
+    DPRINTF(FunctionalWarmup, "Replaying %d lines into %d caches, "
+            "%d branches into the BTB\n", warmLines.size(), caches.size(),
+            warmBranches.size());
+
+    for (auto *cache : caches) {
+        for (const Addr line : warmLines)
+            cache->warmupTouch(line);
+    }
+
+    if (btb && !warmBranches.empty()) {
+        fatal_if(!cpu, "%s: warming a BTB needs the cpu parameter to "
+                 "build target PC states", name());
+        auto *isa = cpu->getContext(0)->getIsaPtr();
+        for (const auto &entry : warmBranches) {
+            std::unique_ptr<PCStateBase> target(
+                isa->newPCState(entry.second));
+            btb->update(0, entry.first, *target);
+        }
+    }
+
+    warmLines.clear();
+    warmBranches.clear();
+}
+
+} // namespace gem5
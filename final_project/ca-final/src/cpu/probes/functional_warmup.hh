@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_FUNCTIONAL_WARMUP_HH__
+#define __CPU_PROBES_FUNCTIONAL_WARMUP_HH__
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+#include "mem/packet.hh"
+#include "params/FunctionalWarmup.hh"
+#include "sim/probe/probe_listener_object.hh"
+
+namespace gem5
+{
+
+class BaseCPU;
+class BaseCache;
+class SimpleThread;
+
+namespace branch_prediction
+{
+class BranchTargetBuffer;
+} // namespace branch_prediction
+
+namespace memory
+{
+class AbstractMemory;
+} // namespace memory
+
+/**
+ * Functional warmup engine: records a compact trace of recently
+ * touched memory lines (from the memories' "Access" probe) and branch
+ * targets (from a simple CPU's "Commit" probe) during fast-forward,
+ * serializes it next to the checkpoint, and replays it into the
+ * configured caches and BTB at restore time, before detailed
+ * simulation starts.
+ */
+class FunctionalWarmup : public ProbeListenerObject
+{
+  public:
+    FunctionalWarmup(const FunctionalWarmupParams &params);
+
+    void regProbeListeners() override;
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+    void startup() override;
+
+    /** "Commit" probe handler: collect branch targets. */
+    void noteCommit(const std::pair<SimpleThread *, const StaticInstPtr> &p);
+
+    /** "Access" probe handler: collect touched memory lines. */
+    void noteAccess(const PacketPtr &pkt);
+
+  private:
+    typedef ProbeListenerArg<FunctionalWarmup,
+        std::pair<SimpleThread *, const StaticInstPtr>> CommitListener;
+    typedef ProbeListenerArg<FunctionalWarmup, PacketPtr> AccessListener;
+
+    void recordBranch(Addr pc, Addr target);
+
+    /** Drop the oldest lines once the map has outgrown maxLines. */
+    void pruneLines();
+
+    const std::vector<memory::AbstractMemory *> memories;
+    const std::vector<BaseCache *> caches;
+    branch_prediction::BranchTargetBuffer *const btb;
+    BaseCPU *const cpu;
+    const Addr lineMask;
+    const uint64_t maxLines;
+    const uint64_t maxBranches;
+
+    /** Recording state: line -> last-touch sequence number. */
+    std::unordered_map<Addr, uint64_t> lines;
+    uint64_t seq;
+
+    /** Recording state: branch pc -> most recent target. */
+    std::unordered_map<Addr, Addr> branches;
+
+    /** Indirect branch waiting for its target (the next commit pc). */
+    Addr pendingPC;
+    bool pendingValid;
+
+    /** Trace loaded from a checkpoint, replayed in startup(). */
+    std::vector<Addr> warmLines;
+    std::vector<std::pair<Addr, Addr>> warmBranches;
+    bool restored;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_FUNCTIONAL_WARMUP_HH__
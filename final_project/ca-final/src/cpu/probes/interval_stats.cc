@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/probes/interval_stats.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/base.hh"
+#include "cpu/pred/bpred_unit.hh"
+#include "mem/cache/base.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+constexpr uint64_t intervalTraceMagic = 0x534c5649354d4547ULL; // "GEM5IVLS"
+constexpr uint32_t intervalTraceVersion = 1;
+
+} // anonymous namespace
+
+IntervalPhaseTracker::IntervalPhaseTracker(
+        const IntervalPhaseTrackerParams &params)
+    : ProbeListenerObject(params),
+      cpu(params.cpu),
+      caches(params.caches.begin(), params.caches.end()),
+      branchPred(params.branch_pred),
+      intervalInsts(params.interval_insts),
+      phaseThreshold(params.phase_threshold),
+      exitOnPhaseChange(params.exit_on_phase_change),
+      stats(this)
+{
+    fatal_if(intervalInsts == 0, "%s: interval_insts must be non-zero",
+             name());
+
+    trace.open(simout.resolve(params.trace_file),
+               std::ios::out | std::ios::binary | std::ios::trunc);
+    fatal_if(!trace.good(), "%s: could not open interval trace '%s'",
+             name(), params.trace_file);
+
+    trace.write(reinterpret_cast<const char *>(&intervalTraceMagic),
+                sizeof(intervalTraceMagic));
+    trace.write(reinterpret_cast<const char *>(&intervalTraceVersion),
+                sizeof(intervalTraceVersion));
+}
+
+void
+IntervalPhaseTracker::regProbeListeners()
+{
+    if (!listeners.empty())
+        return;
+
+    listeners.push_back(cpu->getProbeManager()->connect<PmuListener>(
+        this, "RetiredInsts", &IntervalPhaseTracker::retiredInstsHandler));
+
+    for (auto *cache : caches) {
+        listeners.push_back(cache->getProbeManager()->connect<MissListener>(
+            this, "Miss", &IntervalPhaseTracker::missHandler));
+    }
+
+    if (branchPred) {
+        listeners.push_back(
+            branchPred->getProbeManager()->connect<PmuListener>(
+                this, "Misses", &IntervalPhaseTracker::mispredictHandler));
+    }
+
+    intervalStart = curTick();
+}
+
+void
+IntervalPhaseTracker::retiredInstsHandler(const uint64_t &insts)
+{
+    instCount += insts;
+    if (instCount >= intervalInsts)
+        closeInterval();
+}
+
+void
+IntervalPhaseTracker::missHandler(const CacheAccessProbeArg &arg)
+{
+    missCount++;
+}
+
+void
+IntervalPhaseTracker::mispredictHandler(const uint64_t &count)
+{
+    mispredictCount += count;
+}
+
+void
+IntervalPhaseTracker::closeInterval()
+{
+    const Tick end = curTick();
+    const Tick delta = end - intervalStart;
+
+    // per-interval metric vector: IPC, MPKI, branch MPKI
+    const double cycles = delta / double(cpu->clockPeriod());
+    double vec[3];
+    vec[0] = cycles > 0 ? instCount / cycles : 0;
+    vec[1] = missCount * 1000.0 / instCount;
+    vec[2] = mispredictCount * 1000.0 / instCount;
+
+    // relative change against the previous interval, largest
+    // component wins; small denominators are floored so a quiet
+    // metric cannot manufacture a phase change
+    bool phase_change = false;
+    if (prevValid) {
+        double dist = 0;
+        for (int i = 0; i < 3; i++) {
+            const double base = std::max(std::abs(prevVec[i]), 0.01);
+            dist = std::max(dist, std::abs(vec[i] - prevVec[i]) / base);
+        }
+        phase_change = dist > phaseThreshold;
+    }
+
+    const uint8_t flag = phase_change ? 1 : 0;
+    trace.write(reinterpret_cast<const char *>(&intervalStart),
+                sizeof(intervalStart));
+    trace.write(reinterpret_cast<const char *>(&end), sizeof(end));
+    trace.write(reinterpret_cast<const char *>(&instCount),
+                sizeof(instCount));
+    trace.write(reinterpret_cast<const char *>(&missCount),
+                sizeof(missCount));
+    trace.write(reinterpret_cast<const char *>(&mispredictCount),
+                sizeof(mispredictCount));
+    trace.write(reinterpret_cast<const char *>(&flag), sizeof(flag));
+
+    stats.numIntervals++;
+    std::copy(vec, vec + 3, prevVec);
+    prevValid = true;
+
+    instCount = 0;
+    missCount = 0;
+    mispredictCount = 0;
+    intervalStart = end;
+
+    if (phase_change) {
+        stats.numPhaseChanges++;
+        if (exitOnPhaseChange) {
+            exitSimLoopNow("phase change detected");
+        }
+    }
+}
+
+IntervalPhaseTracker::IntervalStats::IntervalStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(numIntervals, statistics::units::Count::get(),
+               "Number of completed instruction intervals"),
+      ADD_STAT(numPhaseChanges, statistics::units::Count::get(),
+               "Number of detected phase changes")
+{
+}
+
+} // namespace gem5
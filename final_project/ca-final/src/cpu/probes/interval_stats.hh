@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_INTERVAL_STATS_HH__
+#define __CPU_PROBES_INTERVAL_STATS_HH__
+
+#include <fstream>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/cache/cache_probe_arg.hh"
+#include "params/IntervalPhaseTracker.hh"
+#include "sim/probe/probe_listener_object.hh"
+
+namespace gem5
+{
+
+class BaseCPU;
+class BaseCache;
+
+namespace branch_prediction
+{
+class BPredUnit;
+} // namespace branch_prediction
+
+/**
+ * Interval probe for online phase detection: accumulates retired
+ * instructions, cache misses and branch mispredictions, and once per
+ * instruction interval emits an (interval ticks, instructions,
+ * misses, mispredictions) record to a compact binary trace, from
+ * which per-interval IPC, MPKI and branch MPKI follow directly. A
+ * simple online detector compares each interval's (IPC, MPKI, branch
+ * MPKI) vector against the previous one and, on a relative change
+ * above the configured threshold, counts a phase change and can
+ * raise a simulation exit so the config script takes a checkpoint --
+ * the same exit-event flow the PC and instruction trackers use.
+ *
+ * Trace format (little-endian): magic:u64 version:u32, then per
+ * record start_tick:u64 end_tick:u64 insts:u64 cache_misses:u64
+ * branch_mispredicts:u64 phase_change:u8.
+ */
+class IntervalPhaseTracker : public ProbeListenerObject
+{
+  public:
+    IntervalPhaseTracker(const IntervalPhaseTrackerParams &params);
+
+    void regProbeListeners() override;
+
+    /** "RetiredInsts" probe handler. */
+    void retiredInstsHandler(const uint64_t &insts);
+
+    /** Cache "Miss" probe handler. */
+    void missHandler(const CacheAccessProbeArg &arg);
+
+    /** Branch predictor "Misses" probe handler. */
+    void mispredictHandler(const uint64_t &count);
+
+  private:
+    typedef ProbeListenerArg<IntervalPhaseTracker, uint64_t> PmuListener;
+    typedef ProbeListenerArg<IntervalPhaseTracker, CacheAccessProbeArg>
+        MissListener;
+
+    /** Close the current interval: emit its record and run the
+     * phase detector. */
+    void closeInterval();
+
+    BaseCPU *const cpu;
+    const std::vector<BaseCache *> caches;
+    branch_prediction::BPredUnit *const branchPred;
+
+    const uint64_t intervalInsts;
+    const double phaseThreshold;
+    const bool exitOnPhaseChange;
+
+    /** Accumulators for the current interval. */
+    uint64_t instCount = 0;
+    uint64_t missCount = 0;
+    uint64_t mispredictCount = 0;
+    Tick intervalStart = 0;
+
+    /** Previous interval's (IPC, MPKI, branch MPKI) vector. */
+    double prevVec[3] = {0, 0, 0};
+    bool prevValid = false;
+
+    /** Binary interval trace. */
+    std::ofstream trace;
+
+    struct IntervalStats : public statistics::Group
+    {
+        IntervalStats(statistics::Group *parent);
+
+        statistics::Scalar numIntervals;
+        statistics::Scalar numPhaseChanges;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_INTERVAL_STATS_HH__
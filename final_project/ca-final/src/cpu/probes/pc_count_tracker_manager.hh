@@ -50,6 +50,14 @@ class PcCountTrackerManager : public SimObject {
      */
     void checkCount(Addr pc);
 
+    /** the PC of the most recently encountered target pair; exported
+     * to Python so a region scheduler can tell which marker fired
+     */
+    uint64_t getCurrentPC() const { return currentPair.getPC(); }
+
+    /** the count of the most recently encountered target pair */
+    uint64_t getCurrentCount() const { return currentPair.getCount(); }
+
   private:
     /** a counter that stores all the target PC addresses and the number
      * of times the target PC has been executed
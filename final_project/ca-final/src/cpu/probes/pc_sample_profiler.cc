@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/probes/pc_sample_profiler.hh"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/loader/symtab.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/base.hh"
+#include "sim/core.hh"
+
+namespace gem5
+{
+
+PcSampleProfiler::PcSampleProfiler(const PcSampleProfilerParams &params)
+    : ProbeListenerObject(params),
+      cpu(params.cpu),
+      sampleInterval(params.sample_interval),
+      profileFile(params.profile_file),
+      countdown(params.sample_interval),
+      stats(this)
+{
+    fatal_if(sampleInterval == 0, "%s: sample_interval must be non-zero",
+             name());
+
+    registerExitCallback([this]() { writeProfile(); });
+}
+
+void
+PcSampleProfiler::regProbeListeners()
+{
+    if (!listeners.empty())
+        return;
+
+    listeners.push_back(cpu->getProbeManager()->connect<PcListener>(
+        this, "RetiredInstsPC", &PcSampleProfiler::retiredPcHandler));
+}
+
+void
+PcSampleProfiler::retiredPcHandler(const uint64_t &pc)
+{
+    if (--countdown)
+        return;
+    countdown = sampleInterval;
+
+    samples[pc]++;
+    stats.numSamples++;
+}
+
+void
+PcSampleProfiler::writeProfile() const
+{
+    // fold pc samples into per-function counts; unresolvable pcs
+    // aggregate under their hex address
+    std::map<std::string, uint64_t> functions;
+    uint64_t total = 0;
+    for (const auto &kv : samples) {
+        auto it = loader::debugSymbolTable.findNearest(kv.first);
+        if (it != loader::debugSymbolTable.end())
+            functions[it->name()] += kv.second;
+        else
+            functions[csprintf("%#x", kv.first)] += kv.second;
+        total += kv.second;
+    }
+
+    std::vector<std::pair<std::string, uint64_t>> rows(
+        functions.begin(), functions.end());
+    std::sort(rows.begin(), rows.end(),
+        [](const auto &a, const auto &b) { return a.second > b.second; });
+
+    auto *out = simout.create(profileFile, false);
+    std::ostream &os = *out->stream();
+    ccprintf(os, "%12s %7s  %s\n", "samples", "share", "function");
+    for (const auto &row : rows) {
+        ccprintf(os, "%12d %6.2f%%  %s\n", row.second,
+                 total ? 100.0 * row.second / total : 0.0, row.first);
+    }
+    simout.close(out);
+}
+
+PcSampleProfiler::ProfilerStats::ProfilerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(numSamples, statistics::units::Count::get(),
+               "Number of pc samples taken")
+{
+}
+
+} // namespace gem5
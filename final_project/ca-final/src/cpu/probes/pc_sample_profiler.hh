@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_PC_SAMPLE_PROFILER_HH__
+#define __CPU_PROBES_PC_SAMPLE_PROFILER_HH__
+
+#include <unordered_map>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "params/PcSampleProfiler.hh"
+#include "sim/probe/probe_listener_object.hh"
+
+namespace gem5
+{
+
+class BaseCPU;
+
+/**
+ * Statistical PC profiler: records the committed pc of every Nth
+ * retired instruction (through the CPU's RetiredInstsPC probe) and,
+ * at exit, resolves the sampled pcs against the loaded symbol table
+ * into a flat per-function profile sorted by sample share. Sampling
+ * keeps the per-instruction cost to a counter decrement; symbol
+ * resolution is deferred entirely to the report so the run never
+ * touches the symbol table.
+ */
+class PcSampleProfiler : public ProbeListenerObject
+{
+  public:
+    PcSampleProfiler(const PcSampleProfilerParams &params);
+
+    void regProbeListeners() override;
+
+    /** "RetiredInstsPC" probe handler. */
+    void retiredPcHandler(const uint64_t &pc);
+
+  private:
+    typedef ProbeListenerArg<PcSampleProfiler, uint64_t> PcListener;
+
+    /** Resolve samples and write the report. */
+    void writeProfile() const;
+
+    BaseCPU *const cpu;
+    const uint64_t sampleInterval;
+    const std::string profileFile;
+
+    /** Instructions until the next sample. */
+    uint64_t countdown;
+
+    /** Sample counts per pc; resolved to symbols at report time. */
+    std::unordered_map<Addr, uint64_t> samples;
+
+    struct ProfilerStats : public statistics::Group
+    {
+        ProfilerStats(statistics::Group *parent);
+
+        statistics::Scalar numSamples;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_PC_SAMPLE_PROFILER_HH__
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/probes/slack_analyzer.hh"
+
+#include <algorithm>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/output.hh"
+#include "cpu/o3/cpu.hh"
+#include "cpu/o3/dyn_inst.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Collapse a register id into one map key across classes. */
+uint32_t
+regKey(const RegId &reg)
+{
+    return (uint32_t(reg.classValue()) << 24) | reg.index();
+}
+
+} // anonymous namespace
+
+SlackAnalyzer::SlackAnalyzer(const SlackAnalyzerParams &params)
+    : ProbeListenerObject(params),
+      cpu(params.cpu),
+      reportFile(params.report_file),
+      maxPcs(params.max_pcs),
+      stats(this)
+{
+    registerExitCallback([this]() { writeReport(); });
+}
+
+void
+SlackAnalyzer::regProbeListeners()
+{
+    if (!listeners.empty())
+        return;
+
+    listeners.push_back(cpu->getProbeManager()->connect<CommitListener>(
+        this, "Commit", &SlackAnalyzer::commitHandler));
+}
+
+void
+SlackAnalyzer::commitHandler(const o3::DynInstPtr &inst)
+{
+    const Tick now = curTick();
+
+    // slack = distance between this commit and the production of the
+    // newest operand; tight slack marks the chain being waited on
+    Tick newest = 0;
+    for (int i = 0; i < inst->numSrcRegs(); i++) {
+        const RegId &reg = inst->staticInst->srcRegIdx(i);
+        if (reg.is(InvalidRegClass) || reg.is(MiscRegClass))
+            continue;
+        const auto it = lastProduced.find(regKey(reg));
+        if (it != lastProduced.end())
+            newest = std::max(newest, it->second);
+    }
+
+    if (newest != 0) {
+        const Tick slack = now - newest;
+        stats.slack.sample(slack);
+
+        const Addr pc = inst->pcState().instAddr();
+        const auto it = pcSlack.find(pc);
+        if (it != pcSlack.end()) {
+            it->second.first += slack;
+            it->second.second++;
+        } else if (pcSlack.size() < maxPcs) {
+            pcSlack[pc] = {slack, 1};
+        }
+    }
+
+    for (int i = 0; i < inst->numDestRegs(); i++) {
+        const RegId &reg = inst->staticInst->destRegIdx(i);
+        if (reg.is(InvalidRegClass) || reg.is(MiscRegClass))
+            continue;
+        lastProduced[regKey(reg)] = now;
+    }
+}
+
+void
+SlackAnalyzer::writeReport() const
+{
+    // most critical (least average slack) first
+    std::vector<std::pair<Addr, std::pair<uint64_t, uint64_t>>> rows(
+        pcSlack.begin(), pcSlack.end());
+    std::sort(rows.begin(), rows.end(),
+        [](const auto &a, const auto &b) {
+            return a.second.first * b.second.second <
+                b.second.first * a.second.second;
+        });
+
+    auto *out = simout.create(reportFile, false);
+    std::ostream &os = *out->stream();
+    ccprintf(os, "%16s %12s %12s\n", "pc", "avg slack", "samples");
+    for (const auto &row : rows) {
+        ccprintf(os, "%#16x %12d %12d\n", row.first,
+                 row.second.first / row.second.second, row.second.second);
+    }
+    simout.close(out);
+}
+
+SlackAnalyzer::SlackStats::SlackStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(slack, statistics::units::Tick::get(),
+               "Distribution of per-instruction dependence slack")
+{
+    slack.init(16);
+}
+
+} // namespace gem5
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PROBES_SLACK_ANALYZER_HH__
+#define __CPU_PROBES_SLACK_ANALYZER_HH__
+
+#include <unordered_map>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/o3/dyn_inst_ptr.hh"
+#include "params/SlackAnalyzer.hh"
+#include "sim/probe/probe_listener_object.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+class CPU;
+} // namespace o3
+
+/**
+ * Online data-dependence slack analyzer for the O3 pipeline. It
+ * listens to the commit probe and tracks, per architectural
+ * register, when the last value was produced (committed); each
+ * committed instruction's slack is the distance between its own
+ * commit and its newest operand's production. Tight slack marks the
+ * dependence chains the machine is actually waiting on. A global
+ * slack distribution lands in the stats, and a per-PC table
+ * (bounded) is written at exit sorted by average slack, most
+ * critical first -- the criticality ranking that previously needed
+ * full elastic-trace dumps and offline tooling.
+ */
+class SlackAnalyzer : public ProbeListenerObject
+{
+  public:
+    SlackAnalyzer(const SlackAnalyzerParams &params);
+
+    void regProbeListeners() override;
+
+    /** O3 "Commit" probe handler. */
+    void commitHandler(const o3::DynInstPtr &inst);
+
+  private:
+    typedef ProbeListenerArg<SlackAnalyzer, o3::DynInstPtr> CommitListener;
+
+    /** Write the per-PC criticality report. */
+    void writeReport() const;
+
+    o3::CPU *const cpu;
+    const std::string reportFile;
+    const unsigned maxPcs;
+
+    /** Last production (commit) tick per flattened register. */
+    std::unordered_map<RegIndex, Tick> lastProduced;
+
+    /** Per-PC slack accumulation: (total slack, samples). */
+    std::unordered_map<Addr, std::pair<uint64_t, uint64_t>> pcSlack;
+
+    struct SlackStats : public statistics::Group
+    {
+        SlackStats(statistics::Group *parent);
+
+        /** Distribution of per-instruction dependence slack. */
+        statistics::Histogram slack;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_PROBES_SLACK_ANALYZER_HH__
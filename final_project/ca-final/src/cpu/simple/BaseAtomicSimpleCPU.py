@@ -59,6 +59,12 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
         return True
 
     width = Param.Int(1, "CPU width")
+    fastforward_batching = Param.Bool(
+        False,
+        "Execute back-to-back CPU ticks in a tight loop, bypassing the "
+        "event queue until another event (timer, device, exit) is due. "
+        "Intended for fast-forwarding to a region of interest.",
+    )
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
 
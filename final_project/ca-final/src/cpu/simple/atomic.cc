@@ -52,6 +52,7 @@
 #include "mem/packet_access.hh"
 #include "mem/physical.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
+#include "sim/async.hh"
 #include "sim/faults.hh"
 #include "sim/full_system.hh"
 #include "sim/system.hh"
@@ -78,16 +79,17 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      ffBatching(p.fastforward_batching),
       icachePort(name() + ".icache_port"),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
       ppCommit(nullptr)
 {
     _status = Idle;
-    ifetch_req = std::make_shared<Request>();
-    data_read_req = std::make_shared<Request>();
-    data_write_req = std::make_shared<Request>();
-    data_amo_req = std::make_shared<Request>();
+    ifetch_req = Request::make();
+    data_read_req = Request::make();
+    data_write_req = Request::make();
+    data_amo_req = Request::make();
 }
 
 
@@ -612,132 +614,164 @@ AtomicSimpleCPU::tick()
 {
     DPRINTF(SimpleCPU, "Tick\n");
 
-    // Change thread if multi-threaded
-    swapActiveThread();
+    Tick latency = 0;
 
-    // Set memory request ids to current thread
-    if (numThreads > 1) {
-        ContextID cid = threadContexts[curThread]->contextId();
+    while (true) {
+        // Change thread if multi-threaded
+        swapActiveThread();
 
-        ifetch_req->setContext(cid);
-        data_read_req->setContext(cid);
-        data_write_req->setContext(cid);
-        data_amo_req->setContext(cid);
-    }
+        // Set memory request ids to current thread
+        if (numThreads > 1) {
+            ContextID cid = threadContexts[curThread]->contextId();
 
-    SimpleExecContext &t_info = *threadInfo[curThread];
-    SimpleThread *thread = t_info.thread;
+            ifetch_req->setContext(cid);
+            data_read_req->setContext(cid);
+            data_write_req->setContext(cid);
+            data_amo_req->setContext(cid);
+        }
 
-    Tick latency = 0;
+        SimpleExecContext &t_info = *threadInfo[curThread];
+        SimpleThread *thread = t_info.thread;
 
-    for (int i = 0; i < width || locked; ++i) {
-        baseStats.numCycles++;
-        updateCycleCounters(BaseCPU::CPU_STATE_ON);
+        latency = 0;
 
-        if (!curStaticInst || !curStaticInst->isDelayedCommit()) {
-            checkForInterrupts();
-            checkPcEventQueue();
-        }
+        for (int i = 0; i < width || locked; ++i) {
+            baseStats.numCycles++;
+            updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
-        // We must have just got suspended by a PC event
-        if (_status == Idle) {
-            tryCompleteDrain();
-            return;
-        }
+            if (!curStaticInst || !curStaticInst->isDelayedCommit()) {
+                checkForInterrupts();
+                checkPcEventQueue();
+            }
 
-        serviceInstCountEvents();
+            // We must have just got suspended by a PC event
+            if (_status == Idle) {
+                tryCompleteDrain();
+                return;
+            }
 
-        Fault fault = NoFault;
+            serviceInstCountEvents();
 
-        const PCStateBase &pc = thread->pcState();
+            Fault fault = NoFault;
 
-        bool needToFetch = !isRomMicroPC(pc.microPC()) && !curMacroStaticInst;
-        if (needToFetch) {
-            ifetch_req->taskId(taskId());
-            setupFetchRequest(ifetch_req);
-            fault = thread->mmu->translateAtomic(ifetch_req, thread->getTC(),
-                                                 BaseMMU::Execute);
-        }
-
-        if (fault == NoFault) {
-            Tick icache_latency = 0;
-            bool icache_access = false;
-            dcache_access = false; // assume no dcache access
+            const PCStateBase &pc = thread->pcState();
 
+            bool needToFetch =
+                !isRomMicroPC(pc.microPC()) && !curMacroStaticInst;
             if (needToFetch) {
-                // This is commented out because the decoder would act like
-                // a tiny cache otherwise. It wouldn't be flushed when needed
-                // like the I cache. It should be flushed, and when that works
-                // this code should be uncommented.
-                //Fetch more instruction memory if necessary
-                //if (decoder.needMoreBytes())
-                //{
-                    icache_access = true;
-                    icache_latency = fetchInstMem();
-                //}
+                ifetch_req->taskId(taskId());
+                setupFetchRequest(ifetch_req);
+                fault = thread->mmu->translateAtomic(
+                        ifetch_req, thread->getTC(), BaseMMU::Execute);
             }
 
-            preExecute();
-
-            Tick stall_ticks = 0;
-            if (curStaticInst) {
-                fault = curStaticInst->execute(&t_info, traceData);
+            if (fault == NoFault) {
+                Tick icache_latency = 0;
+                bool icache_access = false;
+                dcache_access = false; // assume no dcache access
+
+                if (needToFetch) {
+                    // This is commented out because the decoder would act
+                    // like a tiny cache otherwise. It wouldn't be flushed
+                    // when needed like the I cache. It should be flushed, and
+                    // when that works this code should be uncommented.
+                    //Fetch more instruction memory if necessary
+                    //if (decoder.needMoreBytes())
+                    //{
+                        icache_access = true;
+                        icache_latency = fetchInstMem();
+                    //}
+                }
 
-                // keep an instruction count
-                if (fault == NoFault) {
-                    countInst();
-                    ppCommit->notify(std::make_pair(thread, curStaticInst));
-                } else if (traceData) {
-                    traceFault();
+                preExecute();
+
+                Tick stall_ticks = 0;
+                if (curStaticInst) {
+                    fault = curStaticInst->execute(&t_info, traceData);
+
+                    // keep an instruction count
+                    if (fault == NoFault) {
+                        countInst();
+                        ppCommit->notify(
+                                std::make_pair(thread, curStaticInst));
+                    } else if (traceData) {
+                        traceFault();
+                    }
+
+                    if (fault != NoFault &&
+                        std::dynamic_pointer_cast<SyscallRetryFault>(fault)) {
+                        // Retry execution of system calls after a delay.
+                        // Prevents immediate re-execution since conditions
+                        // which caused the retry are unlikely to change every
+                        // tick.
+                        stall_ticks +=
+                            clockEdge(syscallRetryLatency) - curTick();
+                    }
+
+                    postExecute();
                 }
 
-                if (fault != NoFault &&
-                    std::dynamic_pointer_cast<SyscallRetryFault>(fault)) {
-                    // Retry execution of system calls after a delay.
-                    // Prevents immediate re-execution since conditions which
-                    // caused the retry are unlikely to change every tick.
-                    stall_ticks += clockEdge(syscallRetryLatency) - curTick();
+                // @todo remove me after debugging with legion done
+                if (curStaticInst && (!curStaticInst->isMicroop() ||
+                            curStaticInst->isFirstMicroop())) {
+                    instCnt++;
                 }
 
-                postExecute();
-            }
+                if (simulate_inst_stalls && icache_access)
+                    stall_ticks += icache_latency;
+
+                if (simulate_data_stalls && dcache_access)
+                    stall_ticks += dcache_latency;
+
+                if (stall_ticks) {
+                    // the atomic cpu does its accounting in ticks, so
+                    // keep counting in ticks but round to the clock
+                    // period
+                    latency += divCeil(stall_ticks, clockPeriod()) *
+                        clockPeriod();
+                }
 
-            // @todo remove me after debugging with legion done
-            if (curStaticInst && (!curStaticInst->isMicroop() ||
-                        curStaticInst->isFirstMicroop())) {
-                instCnt++;
             }
+            if (fault != NoFault || !t_info.stayAtPC)
+                advancePC(fault);
+        }
 
-            if (simulate_inst_stalls && icache_access)
-                stall_ticks += icache_latency;
+        if (tryCompleteDrain())
+            return;
 
-            if (simulate_data_stalls && dcache_access)
-                stall_ticks += dcache_latency;
+        // instruction takes at least one cycle
+        if (latency < clockPeriod())
+            latency = clockPeriod();
 
-            if (stall_ticks) {
-                // the atomic cpu does its accounting in ticks, so
-                // keep counting in ticks but round to the clock
-                // period
-                latency += divCeil(stall_ticks, clockPeriod()) *
-                    clockPeriod();
-            }
+        if (_status == Idle)
+            return;
 
+        if (!ffBatching || async_event || eventQueue()->empty() ||
+            curTick() + latency >= eventQueue()->nextTick()) {
+            break;
         }
-        if (fault != NoFault || !t_info.stayAtPC)
-            advancePC(fault);
-    }
-
-    if (tryCompleteDrain())
-        return;
 
-    // instruction takes at least one cycle
-    if (latency < clockPeriod())
-        latency = clockPeriod();
+        // Nothing else is due before this CPU's next cycle: bulk
+        // advance the tick and execute the next batch right here
+        // instead of paying an event queue round-trip per CPU tick.
+        eventQueue()->setCurTick(curTick() + latency);
+    }
 
-    if (_status != Idle)
-        reschedule(tickEvent, curTick() + latency, true);
+    reschedule(tickEvent, curTick() + latency, true);
 }
 
+/*
+ * A CPU-side VA->PA micro-cache in front of the MMU (bypassing
+ * translateAtomic entirely) was considered for the fast-forward path
+ * and rejected: the MMU's per-access work includes permission, PMA
+ * and PMP checks whose inputs (privilege mode, satp, PMP CSRs) can
+ * change without any event observable here, so a safe bypass would
+ * need invalidation hooks in every one of those paths. The same
+ * locality is instead exploited where invalidation is already
+ * correct: the TLB fronts its trie with a direct-mapped
+ * recent-translation array, and the SE page table memoizes the last
+ * translated page.
+ */
 Tick
 AtomicSimpleCPU::fetchInstMem()
 {
@@ -66,6 +66,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     bool locked;
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
+    const bool ffBatching;
 
     // main simulation loop (one cycle)
     void tick();
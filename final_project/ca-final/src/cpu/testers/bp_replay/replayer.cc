@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/testers/bp_replay/replayer.hh"
+
+#include "arch/generic/pcstate.hh"
+#include "base/logging.hh"
+#include "base/statistics.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+namespace
+{
+
+/** Trace-record flag bits, matching BPredUnit::commitBranch's dump. */
+enum RecordFlags
+{
+    RecCond     = 0x01,
+    RecCall     = 0x02,
+    RecReturn   = 0x04,
+    RecDirect   = 0x08,
+};
+
+using ReplayPCState = GenericISA::SimplePCState<4>;
+
+/**
+ * Minimal static instruction carrying just what BPredUnit::predict()
+ * interrogates: the control-flow predicates, the fallthrough advance
+ * and the direct target.
+ */
+class ReplayStaticInst : public StaticInst
+{
+  public:
+    ReplayStaticInst(Addr target, unsigned size, unsigned type_flags)
+        : StaticInst("replayed", No_OpClass), targetAddr(target),
+          instSize(size)
+    {
+        // the RAS return-address path requires a valid size
+        StaticInst::size(size);
+        flags[IsControl] = true;
+        if (type_flags & RecCond) {
+            flags[IsCondControl] = true;
+        } else {
+            flags[IsUncondControl] = true;
+        }
+        if (type_flags & RecDirect) {
+            flags[IsDirectControl] = true;
+        } else {
+            flags[IsIndirectControl] = true;
+        }
+        if (type_flags & RecCall)
+            flags[IsCall] = true;
+        if (type_flags & RecReturn)
+            flags[IsReturn] = true;
+    }
+
+    std::unique_ptr<PCStateBase>
+    branchTarget(const PCStateBase &branch_pc) const override
+    {
+        return std::make_unique<ReplayPCState>(targetAddr);
+    }
+
+    void
+    advancePC(PCStateBase &pc) const override
+    {
+        pc.as<ReplayPCState>().set(pc.instAddr() + instSize);
+    }
+
+    void
+    advancePC(ThreadContext *tc) const override
+    {
+        panic("%s not supported", __func__);
+    }
+
+    Fault
+    execute(ExecContext *, trace::InstRecord *) const override
+    {
+        panic("ReplayStaticInst must not be executed");
+    }
+
+    std::string
+    generateDisassembly(Addr, const loader::SymbolTable *) const override
+    {
+        return "replayed-branch";
+    }
+
+  private:
+    const Addr targetAddr;
+    const unsigned instSize;
+};
+
+} // anonymous namespace
+
+BranchTraceReplayer::BranchTraceReplayer(
+        const BranchTraceReplayerParams &p)
+    : ClockedObject(p), bpred(p.branch_pred),
+      trace(p.trace_file),
+      batchSize(p.batch_size),
+      batchEvent([this]{ processBatch(); }, name())
+{
+    fatal_if(!trace.good(), "%s: cannot open branch trace '%s'",
+             name(), p.trace_file);
+}
+
+void
+BranchTraceReplayer::startup()
+{
+    schedule(batchEvent, clockEdge(Cycles(1)));
+}
+
+bool
+BranchTraceReplayer::readRecord(Record &record)
+{
+    return bool(trace >> std::hex >> record.pc >> record.target
+                      >> std::dec >> record.size >> record.taken
+                      >> record.flags);
+}
+
+void
+BranchTraceReplayer::processBatch()
+{
+    Record record;
+    for (unsigned i = 0; i < batchSize; i++) {
+        if (!readRecord(record)) {
+            const double mpki = branches ?
+                (1000.0 * mispredicts) / branches : 0.0;
+            inform("%s: replayed %d branches, %d mispredicts, "
+                   "MPKI (per branch x1000) %.2f\n",
+                   name(), branches, mispredicts, mpki);
+            exitSimLoop("branch trace replay done");
+            return;
+        }
+
+        StaticInstPtr inst(new ReplayStaticInst(record.target, record.size,
+                                                record.flags));
+        ReplayPCState pc(record.pc);
+
+        const InstSeqNum sn = ++seqNum;
+        bpred->predict(inst, sn, pc, /*tid=*/0);
+
+        const Addr actual_next = record.taken ? record.target
+                                              : record.pc + record.size;
+        if (pc.instAddr() != actual_next) {
+            mispredicts++;
+            ReplayPCState corr(actual_next);
+            bpred->squash(sn, corr, record.taken, /*tid=*/0);
+        }
+        bpred->update(sn, /*tid=*/0);
+        branches++;
+    }
+
+    schedule(batchEvent, clockEdge(Cycles(1)));
+}
+
+} // namespace branch_prediction
+} // namespace gem5
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TESTERS_BP_REPLAY_REPLAYER_HH__
+#define __CPU_TESTERS_BP_REPLAY_REPLAYER_HH__
+
+#include <fstream>
+
+#include "cpu/pred/bpred_unit.hh"
+#include "cpu/static_inst.hh"
+#include "params/BranchTraceReplayer.hh"
+#include "sim/clocked_object.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+/**
+ * Drives a BPredUnit from a recorded branch trace (as written by the
+ * BranchPredictor dump_trace_file hook) and reports MPKI, so predictor
+ * tuning does not need full-pipeline simulation per variant. The
+ * replayer is the only object in its configuration; a whole trace
+ * replays in seconds.
+ */
+class BranchTraceReplayer : public ClockedObject
+{
+  public:
+    BranchTraceReplayer(const BranchTraceReplayerParams &p);
+
+    void startup() override;
+
+  private:
+    /** One trace record: "<pc> <target> <size> <taken> <flags>". */
+    struct Record
+    {
+        Addr pc;
+        Addr target;
+        unsigned size;
+        bool taken;
+        unsigned flags;
+    };
+
+    bool readRecord(Record &record);
+
+    void processBatch();
+
+    BPredUnit *bpred;
+    std::ifstream trace;
+    const unsigned batchSize;
+
+    InstSeqNum seqNum = 0;
+    uint64_t branches = 0;
+    uint64_t mispredicts = 0;
+
+    EventFunctionWrapper batchEvent;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_TESTERS_BP_REPLAY_REPLAYER_HH__
@@ -62,8 +62,8 @@ SeriesRequestGenerator::initiate()
     Request::Flags flags;
 
     // For simplicity, requests are assumed to be 1 byte-sized
-    RequestPtr req = std::make_shared<Request>(m_address, 1, flags,
-                                               requestorId);
+    RequestPtr req = Request::make(m_address, 1, flags,
+                                   requestorId);
 
     Packet::Command cmd;
     bool do_write = (rng->random(0, 100) < m_percent_writes);
@@ -87,6 +87,8 @@ GarnetSyntheticTraffic::GarnetSyntheticTraffic(const Params &p)
       singleDest(p.single_dest),
       trafficType(p.traffic_type),
       injRate(p.inj_rate),
+      injRateRamp(p.inj_rate_ramp),
+      injRampInterval(p.inj_ramp_interval),
       injVnet(p.inj_vnet),
       precision(p.precision),
       responseLimit(p.response_limit),
@@ -140,6 +142,15 @@ GarnetSyntheticTraffic::completeRequest(PacketPtr pkt)
 void
 GarnetSyntheticTraffic::tick()
 {
+    // saturation-sweep mode: ramp the injection rate within the run
+    if (injRateRamp > 0 && injRampInterval > 0 &&
+        ++cyclesSinceRamp >= injRampInterval) {
+        cyclesSinceRamp = 0;
+        injRate += injRateRamp;
+        DPRINTF(GarnetSyntheticTraffic, "Ramping injection rate to %f\n",
+                injRate);
+    }
+
     if (++noResponseCycles >= responseLimit) {
         fatal("%s deadlocked at cycle %d\n", name(), curTick());
     }
@@ -290,20 +301,20 @@ GarnetSyntheticTraffic::generatePkt()
     if (injReqType == 0) {
         // generate packet for virtual network 0
         requestType = MemCmd::ReadReq;
-        req = std::make_shared<Request>(paddr, access_size, flags,
-                                        requestorId);
+        req = Request::make(paddr, access_size, flags,
+                            requestorId);
     } else if (injReqType == 1) {
         // generate packet for virtual network 1
         requestType = MemCmd::ReadReq;
         flags.set(Request::INST_FETCH);
-        req = std::make_shared<Request>(
+        req = Request::make(
             0x0, access_size, flags, requestorId, 0x0, 0);
         req->setPaddr(paddr);
     } else {  // if (injReqType == 2)
         // generate packet for virtual network 2
         requestType = MemCmd::WriteReq;
-        req = std::make_shared<Request>(paddr, access_size, flags,
-                                        requestorId);
+        req = Request::make(paddr, access_size, flags,
+                            requestorId);
     }
 
     req->setContext(id);
@@ -129,6 +129,14 @@ class GarnetSyntheticTraffic : public ClockedObject
     std::string trafficType; // string
     TrafficType traffic; // enum from string
     double injRate;
+
+    /** Saturation sweep: every injRampInterval tester cycles the
+     * injection rate increases by injRateRamp, so one run covers the
+     * whole rate axis and the knee shows up in the latency
+     * distribution over time. */
+    const double injRateRamp;
+    const uint64_t injRampInterval;
+    uint64_t cyclesSinceRamp = 0;
     int injVnet;
     int precision;
 
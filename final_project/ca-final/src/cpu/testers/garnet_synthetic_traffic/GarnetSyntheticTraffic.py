@@ -57,6 +57,13 @@ class GarnetSyntheticTraffic(ClockedObject):
     )
     traffic_type = Param.String("uniform_random", "Traffic type")
     inj_rate = Param.Float(0.1, "Packet injection rate")
+    inj_rate_ramp = Param.Float(
+        0.0, "Injection rate increase applied every inj_ramp_interval "
+        "cycles (0 disables the saturation sweep)"
+    )
+    inj_ramp_interval = Param.Unsigned(
+        0, "Tester cycles between injection-rate ramp steps"
+    )
     inj_vnet = Param.Int(
         -1,
         "Vnet to inject in. \
@@ -74,9 +74,9 @@ GpuWavefront::issueLoadOps()
             // for now, assert address is 4-byte aligned
             assert(address % load_size == 0);
 
-            auto req = std::make_shared<Request>(address, load_size,
-                                                 0, tester->requestorId(),
-                                                 0, threadId, nullptr);
+            auto req = Request::make(address, load_size,
+                                     0, tester->requestorId(),
+                                     0, threadId, nullptr);
             req->setPaddr(address);
             req->setReqInstSeqNum(tester->getActionSeqNum());
             // set protocol-specific flags
@@ -127,9 +127,9 @@ GpuWavefront::issueStoreOps()
                     curEpisode->getEpisodeId(), printAddress(address),
                     new_value);
 
-            auto req = std::make_shared<Request>(address, sizeof(Value),
-                                                 0, tester->requestorId(), 0,
-                                                 threadId, nullptr);
+            auto req = Request::make(address, sizeof(Value),
+                                     0, tester->requestorId(), 0,
+                                     threadId, nullptr);
             req->setPaddr(address);
             req->setReqInstSeqNum(tester->getActionSeqNum());
             // set protocol-specific flags
@@ -183,10 +183,10 @@ GpuWavefront::issueAtomicOps()
         // must be aligned with store size
         assert(address % sizeof(Value) == 0);
         AtomicOpFunctor *amo_op = new AtomicOpInc<Value>();
-        auto req = std::make_shared<Request>(address, sizeof(Value),
-                                             flags, tester->requestorId(),
-                                             0, threadId,
-                                             AtomicOpFunctorPtr(amo_op));
+        auto req = Request::make(address, sizeof(Value),
+                                 flags, tester->requestorId(),
+                                 0, threadId,
+                                 AtomicOpFunctorPtr(amo_op));
         req->setPaddr(address);
         req->setReqInstSeqNum(tester->getActionSeqNum());
         // set protocol-specific flags
@@ -222,9 +222,9 @@ GpuWavefront::issueAcquireOp()
     assert(pendingLdStCount == 0);
     assert(pendingAtomicCount == 0);
 
-    auto acq_req = std::make_shared<Request>(0, 0, 0,
-                                             tester->requestorId(), 0,
-                                             threadId, nullptr);
+    auto acq_req = Request::make(0, 0, 0,
+                                 tester->requestorId(), 0,
+                                 threadId, nullptr);
     acq_req->setPaddr(0);
     acq_req->setReqInstSeqNum(tester->getActionSeqNum());
     acq_req->setCacheCoherenceFlags(Request::INV_L1);
@@ -63,6 +63,15 @@ class MemTest(ClockedObject):
     percent_functional = Param.Percent(50, "Percentage functional accesses")
     percent_uncacheable = Param.Percent(10, "Percentage uncacheable")
     percent_atomic = Param.Percent(0, "Percentage atomics")
+    percent_contended = Param.Percent(
+        0,
+        "Percentage of accesses that are swap atomics to one line "
+        "shared by all testers (unverified; tortures the transport "
+        "and measures ping-pong latency)",
+    )
+    percent_llsc = Param.Percent(
+        0, "Percentage of accesses issued as LR/SC pairs"
+    )
 
     # Determine how often to print progress messages and what timeout
     # to use for checking progress of both requests and responses
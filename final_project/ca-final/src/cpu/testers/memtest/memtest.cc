@@ -94,7 +94,10 @@ MemTest::MemTest(const Params &p)
       percentFunctional(p.percent_functional),
       percentUncacheable(p.percent_uncacheable),
       percentAtomic(p.percent_atomic),
+      percentContended(p.percent_contended),
+      percentLlsc(p.percent_llsc),
       requestorId(p.system->getRequestorId(this)),
+      contendedAddr(p.base_addr_1),
       blockSize(p.system->cacheLineSize()),
       blockAddrMask(blockSize - 1),
       sizeBlocks(size / blockSize),
@@ -111,6 +114,8 @@ MemTest::MemTest(const Params &p)
     id = TESTER_ALLOCATOR++;
     fatal_if(id >= blockSize, "Too many testers, only %d allowed\n",
              blockSize - 1);
+    fatal_if(percentContended > 0 && size <= blockSize,
+             "Contended mode needs more than one block per region\n");
 
     // set up counters
     numReads = 0;
@@ -140,6 +145,9 @@ MemTest::completeRequest(PacketPtr pkt, bool functional)
     // this address is no longer outstanding
     auto remove_addr = outstandingAddrs.find(req->getPaddr());
     assert(remove_addr != outstandingAddrs.end());
+    const bool contended = remove_addr->second.contended;
+    if (!functional)
+        stats.latency.sample(curTick() - remove_addr->second.issueTick);
     outstandingAddrs.erase(remove_addr);
 
     DPRINTF(MemTest, "Completing %s at address %x (blk %x) %s\n",
@@ -154,7 +162,22 @@ MemTest::completeRequest(PacketPtr pkt, bool functional)
             panic( "%s access failed at %#x\n",
                 pkt->isWrite() ? "Write" : "Read", req->getPaddr());
     } else {
-        if (pkt->isAtomicOp()) {
+        if (req->isLLSC() && pkt->isWrite()) {
+            // the store-conditional outcome travels in the request's
+            // extra data; the reference value only moves on success
+            if (req->extraDataValid() && req->getExtraData() != 0) {
+                referenceData[req->getPaddr()] = pkt_data[0];
+                stats.numSCSucceeded++;
+            } else {
+                stats.numSCFailed++;
+            }
+            numWrites++;
+            stats.numWrites++;
+        } else if (contended) {
+            // shared-line swap: transport-only torture, no local
+            // value check possible
+            stats.numContended++;
+        } else if (pkt->isAtomicOp()) {
             uint8_t ref_data = referenceData[req->getPaddr()];
             if (pkt_data[0] != ref_data) {
                 panic("%s: read of %x (blk %x) @ cycle %d "
@@ -181,6 +204,15 @@ MemTest::completeRequest(PacketPtr pkt, bool functional)
                       pkt_data[0], ref_data);
             }
 
+            if (req->isLLSC() && !scPending) {
+                // arm the store-conditional half; if another pair is
+                // already armed this reservation just lapses, which
+                // is legal behaviour for LR/SC
+                scPending = true;
+                scAddr = req->getPaddr();
+                scData = rng->random<uint8_t>();
+            }
+
             numReads++;
             stats.numReads++;
 
@@ -227,9 +259,17 @@ MemTest::MemTestStats::MemTestStats(statistics::Group *parent)
       ADD_STAT(numWrites, statistics::units::Count::get(),
                "number of write accesses completed"),
       ADD_STAT(numAtomics, statistics::units::Count::get(),
-               "number of atomic accesses completed")
+               "number of atomic accesses completed"),
+      ADD_STAT(numContended, statistics::units::Count::get(),
+               "number of contended shared-line accesses completed"),
+      ADD_STAT(numSCSucceeded, statistics::units::Count::get(),
+               "number of store-conditionals that succeeded"),
+      ADD_STAT(numSCFailed, statistics::units::Count::get(),
+               "number of store-conditionals that failed"),
+      ADD_STAT(latency, statistics::units::Tick::get(),
+               "request to completion latency")
 {
-
+    latency.init(16);
 }
 
 void
@@ -245,6 +285,10 @@ MemTest::tick()
     bool uncacheable = rng->random(0, 100) < percentUncacheable;
     bool do_atomic = (rng->random(0, 100) < percentAtomic) &&
                      !uncacheable;
+    bool do_contended = (rng->random(0, 100) < percentContended) &&
+                     !uncacheable && !do_atomic;
+    bool do_llsc = (rng->random(0, 100) < percentLlsc) &&
+                     !uncacheable && !do_atomic && !do_contended;
     unsigned base = rng->random(0, 1);
     Request::Flags flags;
     Addr paddr;
@@ -256,28 +300,52 @@ MemTest::tick()
         return;
     }
 
-    // generate a unique address
-    do {
-        unsigned offset = rng->random<unsigned>(0, size - 1);
-
-        // use the tester id as offset within the block for false sharing
-        offset = blockAlign(offset);
-        offset += id;
+    bool is_sc = false;
+    bool is_contended = false;
+
+    if (scPending) {
+        // complete the armed LR/SC pair before generating anything
+        // new so the reservation is still warm
+        paddr = scAddr;
+        is_sc = true;
+        scPending = false;
+        flags.set(Request::LLSC);
+    } else if (do_contended && outstandingAddrs.find(contendedAddr) ==
+               outstandingAddrs.end()) {
+        paddr = contendedAddr;
+        is_contended = true;
+    } else {
+        // generate a unique address
+        do {
+            unsigned offset = rng->random<unsigned>(0, size - 1);
+
+            // use the tester id as offset within the block for false sharing
+            offset = blockAlign(offset);
+            offset += id;
+
+            // the first block of each region doubles as the shared
+            // contended line; keep the verified private bytes out
+            if (percentContended > 0 && blockAlign(offset) == 0)
+                offset += blockSize;
+
+            if (uncacheable) {
+                flags.set(Request::UNCACHEABLE);
+                paddr = uncacheAddr + offset;
+            } else  {
+                paddr = ((base) ? baseAddr1 : baseAddr2) + offset;
+            }
+        } while (outstandingAddrs.find(paddr) != outstandingAddrs.end());
 
-        if (uncacheable) {
-            flags.set(Request::UNCACHEABLE);
-            paddr = uncacheAddr + offset;
-        } else  {
-            paddr = ((base) ? baseAddr1 : baseAddr2) + offset;
-        }
-    } while (outstandingAddrs.find(paddr) != outstandingAddrs.end());
+        if (do_llsc)
+            flags.set(Request::LLSC);
+    }
 
     bool do_functional = (rng->random(0, 100) < percentFunctional) &&
-        !uncacheable;
-    RequestPtr req = std::make_shared<Request>(paddr, 1, flags, requestorId);
+        !uncacheable && !is_sc && !is_contended && !do_llsc;
+    RequestPtr req = Request::make(paddr, 1, flags, requestorId);
     req->setContext(id);
 
-    outstandingAddrs.insert(paddr);
+    outstandingAddrs[paddr] = {curTick(), is_contended};
 
     // sanity check
     panic_if(outstandingAddrs.size() > 100,
@@ -286,7 +354,48 @@ MemTest::tick()
     PacketPtr pkt = nullptr;
     uint8_t *pkt_data = new uint8_t[1];
 
-    if (cmd < percentReads) {
+    if (is_sc) {
+        DPRINTF(MemTest,
+                "Initiating store-conditional at addr %x (blk %x) "
+                "value %x\n", paddr, blockAlign(paddr), scData);
+
+        pkt = new Packet(req, MemCmd::StoreCondReq);
+        pkt->dataDynamic(pkt_data);
+        pkt_data[0] = scData;
+    } else if (is_contended) {
+        DPRINTF(MemTest,
+                "Initiating contended swap at addr %x value %x\n",
+                paddr, data);
+
+        // unverified swap on the shared hot line: the returned value
+        // is some other tester's data and cannot be checked locally,
+        // so this mode tortures the transport and measures ping-pong
+        // latency rather than values
+        TypedAtomicOpFunctor<uint8_t> *_amo_op =
+              new AtomicGeneric3Op<uint8_t>(
+              data, data,
+              [](uint8_t* b, uint8_t a, uint8_t c){
+                  *b = c;
+              });
+        AtomicOpFunctorPtr amo_op = AtomicOpFunctorPtr(_amo_op);
+        req->setAtomicOpFunctor(std::move(amo_op));
+        req->setFlags(Request::ATOMIC_RETURN_OP);
+
+        pkt = new Packet(req, MemCmd::WriteReq);
+        pkt->dataDynamic(pkt_data);
+        pkt_data[0] = data;
+    } else if (do_llsc) {
+        DPRINTF(MemTest,
+                "Initiating load-locked at addr %x (blk %x)\n",
+                paddr, blockAlign(paddr));
+
+        // make sure a reference value exists, as for plain reads
+        if (referenceData.find(paddr) == referenceData.end())
+            referenceData[paddr] = 0;
+
+        pkt = new Packet(req, MemCmd::LoadLockedReq);
+        pkt->dataDynamic(pkt_data);
+    } else if (cmd < percentReads) {
         // start by ensuring there is a reference value if we have not
         // seen this address before
         [[maybe_unused]] uint8_t ref_data = 0;
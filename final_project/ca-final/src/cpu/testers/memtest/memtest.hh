@@ -42,7 +42,6 @@
 #define __CPU_MEMTEST_MEMTEST_HH__
 
 #include <unordered_map>
-#include <unordered_set>
 
 #include "base/random.hh"
 #include "base/statistics.hh"
@@ -133,13 +132,41 @@ class MemTest : public ClockedObject
     const unsigned percentFunctional;
     const unsigned percentUncacheable;
     const unsigned percentAtomic;
+    const unsigned percentContended;
+    const unsigned percentLlsc;
 
     /** Request id for all generated traffic */
     RequestorID requestorId;
 
     unsigned int id;
 
-    std::unordered_set<Addr> outstandingAddrs;
+    /** Bookkeeping for each outstanding access. */
+    struct OutstandingReq
+    {
+        Tick issueTick;
+        /** Access to the shared contended line; not value-verified. */
+        bool contended;
+    };
+
+    std::unordered_map<Addr, OutstandingReq> outstandingAddrs;
+
+    /**
+     * The one line all testers hammer when contended accesses are
+     * enabled (the first block of region one, which the private
+     * verified bytes then stay out of).
+     */
+    const Addr contendedAddr;
+
+    /**
+     * Armed when a load-locked completes: the next tick issues the
+     * store-conditional half to scAddr before generating anything
+     * new, so the reservation is still warm. Only one pair is
+     * tracked; an LR completing while another pair is armed simply
+     * lets its reservation lapse, which is legal.
+     */
+    bool scPending = false;
+    Addr scAddr = 0;
+    uint8_t scData = 0;
     std::unordered_map<Addr, uint8_t> atomicPendingData;
 
     // store the expected value for the addresses we have touched
@@ -185,6 +212,10 @@ class MemTest : public ClockedObject
         statistics::Scalar numReads;
         statistics::Scalar numWrites;
         statistics::Scalar numAtomics;
+        statistics::Scalar numContended;
+        statistics::Scalar numSCSucceeded;
+        statistics::Scalar numSCFailed;
+        statistics::Histogram latency;
     } stats;
 
     /**
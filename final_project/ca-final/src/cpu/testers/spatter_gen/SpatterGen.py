@@ -64,6 +64,11 @@ class SpatterGen(ClockedObject):
         "Number of requests to send in parallel."
         "Emulates the number of dcache ports."
     )
+    peak_bw_bytes_per_second = Param.Float(
+        0.0,
+        "Peak memory bandwidth in bytes per second used for the "
+        "bandwidth-efficiency stat; 0 disables that stat.",
+    )
 
     cxx_exports = [
         PyBindMethod("addKernel"),
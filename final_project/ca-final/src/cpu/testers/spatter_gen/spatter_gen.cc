@@ -35,6 +35,7 @@
 #include "enums/SpatterProcessingMode.hh"
 #include "mem/packet.hh"
 #include "sim/sim_exit.hh"
+#include "sim/stats.hh"
 #include "sim/system.hh"
 
 namespace gem5
@@ -569,7 +570,12 @@ SpatterGen::SpatterGenStats::SpatterGenStats(SpatterGen* spatter_gen):
     ADD_STAT(valueAccessLatency, statistics::units::Tick::get(),
         "Distribution of latency for accessing the values array."),
     ADD_STAT(totalIndirectAccessLatency, statistics::units::Tick::get(),
-        "Distribution of total latency for indirect accesses.")
+        "Distribution of total latency for indirect accesses."),
+    ADD_STAT(achievedBW, statistics::units::Rate<
+            statistics::units::Byte, statistics::units::Second>::get(),
+        "Achieved bandwidth over all index and value traffic."),
+    ADD_STAT(bwEfficiency, statistics::units::Ratio::get(),
+        "Achieved bandwidth as a fraction of the configured peak.")
 {}
 
 void
@@ -579,6 +585,16 @@ SpatterGen::SpatterGenStats::regStats()
     indexAccessLatency.init(8);
     valueAccessLatency.init(16);
     totalIndirectAccessLatency.init(16);
+
+    achievedBW = (indexBytesRead + valueBytesRead + valueBytesWritten) /
+        simSeconds;
+
+    // dump the per-pattern report by running each pattern as its own
+    // kernel and dumping stats at the sync points between them
+    const double peak = spatterGen->params().peak_bw_bytes_per_second;
+    if (peak > 0) {
+        bwEfficiency = achievedBW / constant(peak);
+    }
 }
 
 } // namespace gem5
@@ -147,6 +147,15 @@ class SpatterGen: public ClockedObject
         statistics::Histogram valueAccessLatency;
         statistics::Histogram totalIndirectAccessLatency;
 
+        /** Achieved bandwidth over all index and value traffic. */
+        statistics::Formula achievedBW;
+
+        /**
+         * Achieved bandwidth as a fraction of the configured peak;
+         * only meaningful when peak_bw_bytes_per_second is set.
+         */
+        statistics::Formula bwEfficiency;
+
         virtual void regStats() override;
 
         SpatterGenStats(SpatterGen* spatter_gen);
@@ -168,8 +168,12 @@ BaseTrafficGen::unserialize(CheckpointIn &cp)
 void
 BaseTrafficGen::update()
 {
-    // shift our progress-tracking event forward
-    reschedule(noProgressEvent, curTick() + progressCheck, true);
+    // note our progress; the watchdog event polls this instead of
+    // being rescheduled on every packet, which at high simulated
+    // bandwidths would mean an event-queue reinsertion per packet
+    lastProgressTick = curTick();
+    if (!noProgressEvent.scheduled())
+        schedule(noProgressEvent, curTick() + progressCheck);
 
     // if we have reached the time for the next state transition, then
     // perform the transition
@@ -328,6 +332,13 @@ BaseTrafficGen::retryReq()
 void
 BaseTrafficGen::noProgress()
 {
+    // only fatal if nothing has happened for a full check interval;
+    // otherwise roll the watchdog forward from the last progress
+    if (curTick() - lastProgressTick < progressCheck) {
+        schedule(noProgressEvent, lastProgressTick + progressCheck);
+        return;
+    }
+
     fatal("BaseTrafficGen %s spent %llu ticks without making progress",
           name(), progressCheck);
 }
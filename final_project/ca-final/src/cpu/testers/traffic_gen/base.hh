@@ -117,6 +117,12 @@ class BaseTrafficGen : public ClockedObject
      */
     EventFunctionWrapper noProgressEvent;
 
+    /**
+     * Tick of the last update; the watchdog compares against this
+     * rather than being rescheduled per packet.
+     */
+    Tick lastProgressTick = 0;
+
     /** Time of next transition */
     Tick nextTransitionTick;
 
@@ -31,7 +31,7 @@
 
 #include <cassert>
 #include <cstring>
-#include <vector>
+#include <new>
 
 namespace gem5
 {
@@ -45,8 +45,15 @@ class TimeBuffer
     unsigned size;
     int _id;
 
+    /**
+     * One contiguous ring of slots, rounded up to a power of two so
+     * position lookup is a single add-and-mask straight into the
+     * buffer, with no per-slot pointer indirection. The extra slack
+     * slots (if any) simply cycle through the ring like the rest.
+     */
+    unsigned ringSize;
+    unsigned ringMask;
     char *data;
-    std::vector<char *> index;
     unsigned base;
 
     void valid(int idx) const
@@ -54,6 +61,11 @@ class TimeBuffer
         assert (idx >= -past && idx <= future);
     }
 
+    T *slot(unsigned ring_index) const
+    {
+        return reinterpret_cast<T *>(data + ring_index * sizeof(T));
+    }
+
   public:
     friend class wire;
     class wire
@@ -138,30 +150,33 @@ class TimeBuffer
 
   public:
     TimeBuffer(int p, int f)
-        : past(p), future(f), size(past + future + 1),
-          data(new char[size * sizeof(T)]), index(size), base(0)
+        : past(p), future(f), size(past + future + 1), base(0)
     {
         assert(past >= 0 && future >= 0);
-        char *ptr = data;
-        for (unsigned i = 0; i < size; i++) {
-            index[i] = ptr;
-            std::memset(ptr, 0, sizeof(T));
-            new (ptr) T;
-            ptr += sizeof(T);
+
+        ringSize = 1;
+        while (ringSize < size)
+            ringSize <<= 1;
+        ringMask = ringSize - 1;
+
+        data = new char[ringSize * sizeof(T)];
+        for (unsigned i = 0; i < ringSize; i++) {
+            std::memset(data + i * sizeof(T), 0, sizeof(T));
+            new (data + i * sizeof(T)) T;
         }
 
         _id = -1;
     }
 
     TimeBuffer()
-        : data(NULL)
+        : ringSize(0), ringMask(0), data(NULL), base(0)
     {
     }
 
     ~TimeBuffer()
     {
-        for (unsigned i = 0; i < size; ++i)
-            (reinterpret_cast<T *>(index[i]))->~T();
+        for (unsigned i = 0; i < ringSize; ++i)
+            slot(i)->~T();
         delete [] data;
     }
 
@@ -178,15 +193,21 @@ class TimeBuffer
     void
     advance()
     {
-        if (++base >= size)
-            base = 0;
-
-        int ptr = base + future;
-        if (ptr >= (int)size)
-            ptr -= size;
-        (reinterpret_cast<T *>(index[ptr]))->~T();
-        std::memset(index[ptr], 0, sizeof(T));
-        new (index[ptr]) T;
+        base = (base + 1) & ringMask;
+
+        // recycle the slot that becomes the new most-future position
+        T *recycled = slot((base + future) & ringMask);
+        recycled->~T();
+        std::memset(reinterpret_cast<char *>(recycled), 0, sizeof(T));
+        new (recycled) T;
+    }
+
+    /** Advance the buffer by several cycles in one call. */
+    void
+    advance(unsigned cycles)
+    {
+        for (unsigned i = 0; i < cycles; i++)
+            advance();
     }
 
   protected:
@@ -194,39 +215,26 @@ class TimeBuffer
     //relative to now
     inline int calculateVectorIndex(int idx) const
     {
-        //Need more complex math here to calculate index.
         valid(idx);
 
-        int vector_index = idx + base;
-        if (vector_index >= (int)size) {
-            vector_index -= size;
-        } else if (vector_index < 0) {
-            vector_index += size;
-        }
-
-        return vector_index;
+        // two's-complement AND handles the negative (past) offsets
+        return (unsigned)((int)base + idx) & ringMask;
     }
 
   public:
     T *access(int idx)
     {
-        int vector_index = calculateVectorIndex(idx);
-
-        return reinterpret_cast<T *>(index[vector_index]);
+        return slot(calculateVectorIndex(idx));
     }
 
     T &operator[](int idx)
     {
-        int vector_index = calculateVectorIndex(idx);
-
-        return reinterpret_cast<T &>(*index[vector_index]);
+        return *slot(calculateVectorIndex(idx));
     }
 
     const T &operator[] (int idx) const
     {
-        int vector_index = calculateVectorIndex(idx);
-
-        return reinterpret_cast<const T &>(*index[vector_index]);
+        return *slot(calculateVectorIndex(idx));
     }
 
     wire getWire(int idx)
@@ -109,6 +109,14 @@ class DmaDevice(PioDevice):
         "several devices attached to it",
     )
 
+    # In-flight window for the DMA engine: cap on outstanding packets
+    # in timing mode. 0 keeps the historical fire-everything
+    # behaviour; a finite window models a real engine's request queue
+    # and keeps huge transfers from flooding the memory system.
+    dma_window = Param.Unsigned(
+        0, "Max in-flight DMA packets (0 = unlimited)"
+    )
+
     def addIommuProperty(self, state, node):
         """
         This method takes an FdtState and a FdtNode as parameters, and
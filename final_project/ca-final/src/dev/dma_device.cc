@@ -57,9 +57,11 @@ namespace gem5
 {
 
 DmaPort::DmaPort(ClockedObject *dev, System *s,
-                 std::optional<uint32_t> sid, std::optional<uint32_t> ssid)
+                 std::optional<uint32_t> sid, std::optional<uint32_t> ssid,
+                 uint32_t max_pending)
     : RequestPort(dev->name() + ".dma"),
       device(dev), sys(s), requestorId(s->getRequestorId(dev)),
+      maxPending(max_pending),
       sendEvent([this]{ sendDma(); }, dev->name()),
       defaultSid(sid), defaultSSid(ssid), cacheLineSize(s->cacheLineSize())
 { }
@@ -97,6 +99,19 @@ DmaPort::handleResp(DmaReqState *state, Addr addr, Addr size, Tick delay)
     state->numBytes += size;
     assert(state->totBytes >= state->numBytes);
 
+    // Scatter-gather segments report into their shared join; the
+    // coalesced completion fires when the whole descriptor list has
+    // been acked, regardless of how segment responses interleave.
+    if (state->join && !state->aborted) {
+        assert(state->join->remainingBytes >= size);
+        state->join->remainingBytes -= size;
+        if (state->join->remainingBytes == 0 &&
+            state->join->completionEvent) {
+            device->schedule(state->join->completionEvent,
+                             curTick() + delay + state->join->delay);
+        }
+    }
+
     bool all_bytes = (state->totBytes == state->numBytes);
     if (state->aborted) {
         // If this request was aborted, check to see if its in flight accesses
@@ -120,6 +135,15 @@ DmaPort::handleResp(DmaReqState *state, Addr addr, Addr size, Tick delay)
         delete state;
     }
 
+    // An in-flight window may have paused sending; resume now that a
+    // slot opened up (timing mode only; atomic processing is driven
+    // synchronously from sendDma).
+    if (maxPending && sys->isTimingMode() && !transmitList.empty() &&
+        !retryPending && !sendEvent.scheduled() &&
+        pendingCount < maxPending) {
+        device->schedule(sendEvent, device->clockEdge(Cycles(1)));
+    }
+
     // We might be drained at this point, if so signal the drain event.
     if (pendingCount == 0)
         signalDrainDone();
@@ -160,7 +184,7 @@ DmaPort::recvTimingResp(PacketPtr pkt)
 }
 
 DmaDevice::DmaDevice(const Params &p)
-    : PioDevice(p), dmaPort(this, sys, p.sid, p.ssid)
+    : PioDevice(p), dmaPort(this, sys, p.sid, p.ssid, p.dma_window)
 { }
 
 void
@@ -220,6 +244,39 @@ DmaPort::dmaAction(Packet::Command cmd, Addr addr, int size, Event *event,
               defaultSid, defaultSSid, delay, flag);
 }
 
+void
+DmaPort::dmaSGAction(Packet::Command cmd,
+                     const std::vector<DmaSegment> &segments, Event *event,
+                     uint8_t *data, Tick delay, Request::Flags flag)
+{
+    assert(!segments.empty());
+
+    Addr total = 0;
+    for (const auto &seg : segments)
+        total += seg.size;
+
+    DPRINTF(DMA, "Starting SG DMA with %d segments, %d bytes, sched: %d\n",
+            segments.size(), total, event ? event->scheduled() : -1);
+
+    auto join = std::make_shared<DmaSgJoin>(DmaSgJoin{total, event, delay});
+
+    // One request state per segment, all reporting into the shared
+    // join; the segments move in order and the packed data buffer
+    // advances by each segment's size.
+    Addr offset = 0;
+    for (const auto &seg : segments) {
+        auto *state = new DmaReqState(
+                cmd, seg.addr, cacheLineSize, seg.size,
+                data ? data + offset : nullptr, flag, requestorId,
+                defaultSid, defaultSSid, nullptr, 0);
+        state->join = join;
+        transmitList.push_back(state);
+        offset += seg.size;
+    }
+
+    sendDma();
+}
+
 void
 DmaPort::abortPending()
 {
@@ -259,6 +316,11 @@ DmaPort::abortPending()
 void
 DmaPort::trySendTimingReq()
 {
+    // Respect the in-flight window; handleResp resumes sending as
+    // responses free up slots.
+    if (maxPending && pendingCount >= maxPending)
+        return;
+
     // Send the next packet for the first DMA request on the transmit list,
     // and schedule the following send if it is successful
     DmaReqState *state = transmitList.front();
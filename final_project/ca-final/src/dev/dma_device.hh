@@ -42,8 +42,9 @@
 #define __DEV_DMA_DEVICE_HH__
 
 #include <deque>
-#include <optional>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "base/addr_range_map.hh"
 #include "base/chunk_generator.hh"
@@ -80,6 +81,19 @@ class DmaPort : public RequestPort, public Drainable
      */
     void sendDma();
 
+    /**
+     * Join point shared by the per-segment states of one
+     * scatter-gather transfer: the completion fires once, when the
+     * last byte of the last outstanding segment is acked, however
+     * the segment responses interleave.
+     */
+    struct DmaSgJoin
+    {
+        Addr remainingBytes;
+        Event *completionEvent;
+        Tick delay;
+    };
+
     struct DmaReqState : public Packet::SenderState
     {
         /** Event to call on the device when this transaction (all packets)
@@ -120,6 +134,12 @@ class DmaPort : public RequestPort, public Drainable
         /** Command for the request. */
         const Packet::Command cmd;
 
+        /**
+         * Non-null when this state is one segment of a scatter-gather
+         * transfer; the join carries the coalesced completion.
+         */
+        std::shared_ptr<DmaSgJoin> join;
+
         DmaReqState(Packet::Command _cmd, Addr addr, Addr chunk_sz, Addr tb,
                     uint8_t *_data, Request::Flags _flags, RequestorID _id,
                     std::optional<uint32_t> _sid, std::optional<uint32_t> _ssid,
@@ -174,6 +194,13 @@ class DmaPort : public RequestPort, public Drainable
     /** Number of outstanding packets the dma port has. */
     uint32_t pendingCount = 0;
 
+    /**
+     * In-flight window: cap on outstanding packets in timing mode (0
+     * means unlimited, the historical behaviour). When the window is
+     * full, sending pauses and resumes as responses return.
+     */
+    const uint32_t maxPending;
+
     /** The packet (if any) waiting for a retry to send. */
     PacketPtr inRetry = nullptr;
     /**
@@ -198,7 +225,26 @@ class DmaPort : public RequestPort, public Drainable
   public:
 
     DmaPort(ClockedObject *dev, System *s, std::optional<uint32_t> sid=0,
-            std::optional<uint32_t> ssid=0);
+            std::optional<uint32_t> ssid=0, uint32_t max_pending=0);
+
+    /** One contiguous piece of a scatter-gather transfer. */
+    struct DmaSegment
+    {
+        Addr addr;
+        Addr size;
+    };
+
+    /**
+     * Start a scatter-gather transfer: a sequence of (possibly
+     * non-contiguous) segments moved in order with one coalesced
+     * completion event for the whole descriptor list, in place of a
+     * per-segment event chain. The data buffer is packed: segment i
+     * reads/writes at the sum of the preceding segment sizes.
+     */
+    void
+    dmaSGAction(Packet::Command cmd,
+                const std::vector<DmaSegment> &segments, Event *event,
+                uint8_t *data, Tick delay, Request::Flags flag=0);
 
     void
     dmaAction(Packet::Command cmd, Addr addr, int size, Event *event,
@@ -257,6 +303,20 @@ class DmaDevice : public PioDevice
         dmaPort.dmaAction(MemCmd::ReadReq, addr, size, event, data, delay);
     }
 
+    void
+    dmaSGWrite(const std::vector<DmaPort::DmaSegment> &segments, Event *event,
+               uint8_t *data, Tick delay=0)
+    {
+        dmaPort.dmaSGAction(MemCmd::WriteReq, segments, event, data, delay);
+    }
+
+    void
+    dmaSGRead(const std::vector<DmaPort::DmaSegment> &segments, Event *event,
+              uint8_t *data, Tick delay=0)
+    {
+        dmaPort.dmaSGAction(MemCmd::ReadReq, segments, event, data, delay);
+    }
+
     bool dmaPending() const { return dmaPort.dmaPending(); }
 
     void init() override;
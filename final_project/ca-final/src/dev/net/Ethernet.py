@@ -154,6 +154,22 @@ class EtherTapStub(EtherTapBase):
     port = Param.HostSocket(3500, "Port/socket helper should send packets to")
 
 
+class EtherPcapPlayer(SimObject):
+    """Replays a pcap capture into the connected interface,
+    timestamp-faithfully, with optional token-bucket rate shaping."""
+
+    type = "EtherPcapPlayer"
+    cxx_header = "dev/net/etherplayer.hh"
+    cxx_class = "gem5::EtherPcapPlayer"
+
+    interface = EtherInt("interface the capture is injected into")
+    trace_file = Param.String("pcap capture to replay")
+    rate_bytes_per_sec = Param.Float(
+        0.0, "token-bucket rate in bytes per second (0 = unshaped)"
+    )
+    burst_bytes = Param.Float(65536.0, "token-bucket depth in bytes")
+
+
 class EtherDump(SimObject):
     type = "EtherDump"
     cxx_header = "dev/net/etherdump.hh"
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dev/net/etherplayer.hh"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "base/logging.hh"
+#include "debug/Ethernet.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+// same on-disk structures EtherDump writes
+struct pcap_file_header
+{
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+struct pcap_pkthdr
+{
+    uint32_t seconds;
+    uint32_t microseconds;
+    uint32_t caplen;
+    uint32_t len;
+};
+
+constexpr uint32_t tcpdumpMagic = 0xa1b2c3d4;
+
+} // anonymous namespace
+
+EtherPcapPlayer::EtherPcapPlayer(const EtherPcapPlayerParams &p)
+    : SimObject(p),
+      interface(name() + ".interface", *this),
+      rateBytesPerSec(p.rate_bytes_per_sec),
+      burstBytes(p.burst_bytes),
+      tokens(p.burst_bytes),
+      sendEvent([this]{ sendPending(); }, name()),
+      stats(this)
+{
+    trace.open(p.trace_file, std::ios::in | std::ios::binary);
+    fatal_if(!trace.good(), "%s: could not open pcap trace '%s'",
+             name(), p.trace_file);
+
+    pcap_file_header hdr;
+    trace.read(reinterpret_cast<char *>(&hdr), sizeof(hdr));
+    fatal_if(!trace.good() || hdr.magic != tcpdumpMagic,
+             "%s: '%s' is not a pcap capture", name(), p.trace_file);
+}
+
+Port &
+EtherPcapPlayer::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "interface")
+        return interface;
+    return SimObject::getPort(if_name, idx);
+}
+
+bool
+EtherPcapPlayer::readNextPacket()
+{
+    pcap_pkthdr pkthdr;
+    trace.read(reinterpret_cast<char *>(&pkthdr), sizeof(pkthdr));
+    if (!trace.good())
+        return false;
+
+    // the captured bytes become the packet buffer directly
+    pending = std::make_shared<EthPacketData>(pkthdr.caplen);
+    pending->length = pkthdr.caplen;
+    pending->simLength = pkthdr.len;
+    trace.read(reinterpret_cast<char *>(pending->data), pkthdr.caplen);
+    if (!trace.good()) {
+        pending = nullptr;
+        return false;
+    }
+
+    const Tick stamp = pkthdr.seconds * sim_clock::as_int::s +
+        pkthdr.microseconds * sim_clock::as_int::us;
+    if (!sawFirstPacket) {
+        firstPacketTime = stamp;
+        sawFirstPacket = true;
+    }
+    pendingTick = startTick + (stamp - firstPacketTime);
+    return true;
+}
+
+void
+EtherPcapPlayer::startup()
+{
+    startTick = curTick();
+    if (readNextPacket())
+        schedule(sendEvent, std::max(pendingTick, curTick()));
+}
+
+void
+EtherPcapPlayer::sendDone()
+{
+    if (pending && !sendEvent.scheduled())
+        schedule(sendEvent, curTick());
+}
+
+void
+EtherPcapPlayer::sendPending()
+{
+    assert(pending);
+
+    // refill the token bucket since the last look
+    if (rateBytesPerSec > 0) {
+        tokens = std::min(burstBytes, tokens +
+            (curTick() - lastFill) * rateBytesPerSec /
+                double(sim_clock::as_int::s));
+        lastFill = curTick();
+
+        if (tokens < pending->length) {
+            // not enough budget: wait until the bucket refills
+            const double missing = pending->length - tokens;
+            const Tick wait = Tick(missing * sim_clock::as_int::s /
+                                   rateBytesPerSec) + 1;
+            stats.throttledTicks += wait;
+            schedule(sendEvent, curTick() + wait);
+            return;
+        }
+    }
+
+    if (!interface.sendPacket(pending)) {
+        // peer is busy; sendDone() will wake us
+        DPRINTF(Ethernet, "%s: peer busy, waiting\n", name());
+        return;
+    }
+
+    if (rateBytesPerSec > 0)
+        tokens -= pending->length;
+    stats.packetsSent++;
+    stats.bytesSent += pending->length;
+
+    if (readNextPacket())
+        schedule(sendEvent, std::max(pendingTick, curTick() + 1));
+}
+
+EtherPcapPlayer::PlayerStats::PlayerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(packetsSent, statistics::units::Count::get(),
+               "Packets injected from the capture"),
+      ADD_STAT(bytesSent, statistics::units::Byte::get(),
+               "Bytes injected from the capture"),
+      ADD_STAT(throttledTicks, statistics::units::Tick::get(),
+               "Ticks spent waiting on the token bucket")
+{
+}
+
+} // namespace gem5
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Replays a pcap capture into a simulated Ethernet interface.
+ */
+
+#ifndef __DEV_NET_ETHERPLAYER_HH__
+#define __DEV_NET_ETHERPLAYER_HH__
+
+#include <fstream>
+#include <string>
+
+#include "base/statistics.hh"
+#include "dev/net/etherint.hh"
+#include "dev/net/etherpkt.hh"
+#include "params/EtherPcapPlayer.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * Replays a pcap capture (the format EtherDump writes, i.e. standard
+ * tcpdump files) into whatever is connected to its interface --
+ * typically a simulated NIC. Packets are injected timestamp-
+ * faithfully, scaled from the capture's relative timestamps, and
+ * optionally shaped by a token bucket so production captures can be
+ * replayed at a controlled rate. Packet buffers are read from the
+ * file straight into the EthPacketData handed to the device, so
+ * there is no copy beyond the file read itself.
+ */
+class EtherPcapPlayer : public SimObject
+{
+  public:
+    EtherPcapPlayer(const EtherPcapPlayerParams &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx = InvalidPortID) override;
+
+    void startup() override;
+
+    /** The peer finished receiving; try to make progress again. */
+    void sendDone();
+
+  private:
+    class PlayerInterface : public EtherInt
+    {
+      public:
+        PlayerInterface(const std::string &name, EtherPcapPlayer &p)
+            : EtherInt(name), player(p)
+        {}
+
+        /** The player only transmits; inbound traffic is dropped. */
+        bool recvPacket(EthPacketPtr packet) override { return true; }
+        void sendDone() override { player.sendDone(); }
+
+      private:
+        EtherPcapPlayer &player;
+    };
+
+    /** Read the next packet from the capture into pending. */
+    bool readNextPacket();
+
+    /** Send pending if the bucket and peer allow, then reschedule. */
+    void sendPending();
+
+    PlayerInterface interface;
+
+    /** The capture being replayed. */
+    std::ifstream trace;
+
+    /** Bytes per second of shaped bandwidth (0 = unshaped). */
+    const double rateBytesPerSec;
+
+    /** Bucket depth in bytes. */
+    const double burstBytes;
+
+    /** Token bucket fill state. */
+    double tokens;
+    Tick lastFill = 0;
+
+    /** Next packet to inject and its capture-relative tick. */
+    EthPacketPtr pending;
+    Tick pendingTick = 0;
+
+    /** Capture timestamp of the first packet, for rebasing. */
+    Tick firstPacketTime = 0;
+    bool sawFirstPacket = false;
+
+    /** Tick the replay started at. */
+    Tick startTick = 0;
+
+    EventFunctionWrapper sendEvent;
+
+    struct PlayerStats : public statistics::Group
+    {
+        PlayerStats(statistics::Group *parent);
+
+        statistics::Scalar packetsSent;
+        statistics::Scalar bytesSent;
+        statistics::Scalar throttledTicks;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __DEV_NET_ETHERPLAYER_HH__
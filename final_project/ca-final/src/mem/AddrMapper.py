@@ -83,3 +83,28 @@ class RangeAddrMapper(AddrMapper):
     remapped_ranges = VectorParam.AddrRange(
         "Ranges of memory that are being mapped to"
     )
+
+
+# Hashed-interleave address mapper: XOR-folds configurable bit vectors
+# into a set of target (channel-select) bits, modeling the channel
+# hashing real memory subsystems apply between the LLC and the memory
+# controllers. Target bit i is flipped by the parity of
+# (address & xor_masks[i]); masks may not cover any target bit, which
+# keeps the mapping self-inverse and bijective. Addresses outside
+# `ranges` pass through unchanged, and channel-load statistics show
+# how evenly traffic spreads across the target-bit values.
+class HashedAddrMapper(AddrMapper):
+    type = "HashedAddrMapper"
+    cxx_header = "mem/addr_mapper.hh"
+    cxx_class = "gem5::HashedAddrMapper"
+
+    # Ranges whose addresses are hashed; others pass through.
+    ranges = VectorParam.AddrRange("Ranges of memory that should be hashed")
+
+    # Bit positions rewritten by the hash (typically the channel
+    # interleaving bits), one entry per xor_masks entry.
+    target_bits = VectorParam.Unsigned("Bit positions rewritten by the hash")
+
+    # For each target bit, the fold mask whose parity flips it. Masks
+    # must not cover any target bit.
+    xor_masks = VectorParam.UInt64("XOR-fold mask per target bit")
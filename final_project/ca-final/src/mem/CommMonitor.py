@@ -65,6 +65,16 @@ class CommMonitor(SimObject):
     # control the sample period window length of this monitor
     sample_period = Param.Clock("1ms", "Sample period for histograms")
 
+    # Statistical sampling: update the histogram and distribution
+    # stats for only one in N observed packets, reweighted so the
+    # final distributions stay unbiased. Scalar counts, bandwidth
+    # accumulation and outstanding-transaction tracking remain exact.
+    # The default of 1 samples every packet, as before; larger values
+    # make fleet-wide always-on link monitoring affordable.
+    sample_interval = Param.Unsigned(
+        1, "Sample 1-in-N packets for histogram stats (1 = all)"
+    )
+
     # for each histogram, set the number of bins and enable the user
     # to disable the measurement, reads and writes use the same
     # parameters
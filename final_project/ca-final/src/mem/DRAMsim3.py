@@ -53,6 +53,12 @@ class DRAMsim3(AbstractMemory):
         "ext/dramsim3/DRAMsim3/configs/DDR4_8Gb_x8_2400.ini",
         "The configuration file to use with DRAMSim3",
     )
+    idle_tick_elision = Param.Bool(
+        False,
+        "Pause the DRAMsim3 clock while nothing is outstanding instead "
+        "of ticking every memory clock (refresh timing pauses during "
+        "idle periods)",
+    )
     filePath = Param.String(
         "ext/dramsim3/DRAMsim3/", "Directory to prepend to file names"
     )
@@ -54,3 +54,19 @@ class HeteroMemCtrl(MemCtrl):
     # The dram interface `dram` used by HeteroMemCtrl is defined in
     # the MemCtrl
     nvm = Param.NVMInterface("NVM memory interface to use")
+
+    hot_page_tracking = Param.Bool(
+        False,
+        "Track access frequency of slow-tier (nvm) pages and report "
+        "promotion candidates via stats and the MigrationCandidate probe",
+    )
+    hot_page_size = Param.MemorySize("4KiB", "Tracking granularity")
+    hot_page_threshold = Param.Unsigned(
+        64, "Accesses per epoch for a page to become a candidate"
+    )
+    hot_page_table_size = Param.Unsigned(
+        4096, "Maximum pages tracked at once"
+    )
+    hot_page_decay_interval = Param.Latency(
+        "1ms", "Epoch after which all page counters are halved"
+    )
@@ -92,6 +92,18 @@ class MemCtrl(QoSMemCtrl):
     # scheduler, address map and page policy
     mem_sched_policy = Param.MemSched("frfcfs", "Memory scheduling policy")
 
+    power_throttle_enable = Param.Bool(
+        False,
+        "Model power/thermal throttling: stall scheduling once the "
+        "byte budget of the current window is exhausted",
+    )
+    power_throttle_window = Param.Latency(
+        "1us", "Power integration window"
+    )
+    power_throttle_budget_bytes = Param.Unsigned(
+        1 << 16, "Bytes allowed per window before throttling"
+    )
+
     # pipeline latency of the controller and PHY, split into a
     # frontend part and a backend part, with reads and writes serviced
     # by the queues only seeing the frontend contribution, and reads
@@ -53,6 +53,14 @@ class SimpleMemory(AbstractMemory):
     bandwidth = Param.MemoryBandwidth(
         "12.8GiB/s", "Combined read and write bandwidth"
     )
+    stream_shaping = Param.Bool(
+        False,
+        "Give every requestor id its own token bucket (stream_bandwidth) "
+        "in addition to the global bandwidth limit",
+    )
+    stream_bandwidth = Param.MemoryBandwidth(
+        "12.8GiB/s", "Per-requestor bandwidth when stream_shaping is on"
+    )
 
     def controller(self):
         # Simple memory doesn't use a MemCtrl
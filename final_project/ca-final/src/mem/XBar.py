@@ -62,6 +62,15 @@ class BaseXBar(ClockedObject):
         mem_side_ports, "`master` is now called `mem_side_ports`"
     )
 
+    # Optional per-cpu_side_port arbitration weights. When non-empty
+    # (one entry per cpu_side_port), the request layers grant waiting
+    # ports by weighted round-robin instead of FIFO order, matching
+    # weighted arbiters found in real interconnects. Leave empty for
+    # the classic FIFO arbitration.
+    port_weights = VectorParam.Unsigned(
+        [], "Per-cpu_side_port arbitration weights (empty = FIFO)"
+    )
+
     # Latencies governing the time taken for the variuos paths a
     # packet has through the crossbar. Note that the crossbar itself
     # does not add the latency due to assumptions in the coherency
@@ -154,6 +163,16 @@ class SnoopFilter(SimObject):
     # Sanity check on max capacity to track, adjust if needed.
     max_capacity = Param.MemorySize("8MiB", "Maximum capacity of snoop filter")
 
+    # Bounded-memory overflow handling: when the precise table is
+    # full, holder-only entries are demoted into a direct-mapped
+    # presence-vector directory at sector granularity instead of
+    # failing the simulation. Lookups treat the coarse directory as a
+    # conservative superset of holders. Set to 0 to restore the old
+    # fail-on-overflow behaviour.
+    coarse_entries = Param.Unsigned(512, "Sector-granularity coarse "
+                                    "directory entries (0 to disable)")
+    sector_blocks = Param.Unsigned(64, "Cache blocks per coarse sector")
+
 
 # We use a coherent crossbar to connect multiple requestors to the L2
 # caches. Normally this crossbar would be part of the cache itself.
@@ -58,6 +58,7 @@ namespace memory
 
 AbstractMemory::AbstractMemory(const Params &p) :
     ClockedObject(p), range(p.range), pmemAddr(NULL),
+    dirtyMap(nullptr), dirtyPageBits(0), ppAccess(nullptr),
     backdoor(params().range, nullptr,
              (MemBackdoor::Flags)(p.writeable ?
                  MemBackdoor::Readable | MemBackdoor::Writeable :
@@ -115,6 +116,28 @@ AbstractMemory::setBackingStore(uint8_t* pmem_addr)
     pmemAddr = pmem_addr;
 }
 
+void
+AbstractMemory::regProbePoints()
+{
+    ClockedObject::regProbePoints();
+    ppAccess = new ProbePointArg<PacketPtr>(getProbeManager(), "Access");
+}
+
+void
+AbstractMemory::setDirtyTracking(std::vector<uint64_t> *map,
+                                 unsigned page_bits)
+{
+    // Every write has to go through access()/functionalAccess() for
+    // the bitmap to stay complete, so direct host access through the
+    // backdoor is disabled while tracking.
+    if (backdoor.ptr())
+        backdoor.invalidate();
+    backdoor.ptr(nullptr);
+
+    dirtyMap = map;
+    dirtyPageBits = page_bits;
+}
+
 AbstractMemory::MemStats::MemStats(AbstractMemory &_mem)
     : statistics::Group(&_mem), mem(_mem),
     ADD_STAT(bytesRead, statistics::units::Byte::get(),
@@ -400,6 +423,7 @@ AbstractMemory::access(PacketPtr pkt)
             if (pmemAddr) {
                 pkt->setData(host_addr);
                 (*(pkt->getAtomicOp()))(host_addr);
+                markDirty(host_addr, pkt->getSize());
             }
         } else {
             std::vector<uint8_t> overwrite_val(pkt->getSize());
@@ -428,8 +452,10 @@ AbstractMemory::access(PacketPtr pkt)
                     panic("Invalid size for conditional read/write\n");
             }
 
-            if (overwrite_mem)
+            if (overwrite_mem) {
                 std::memcpy(host_addr, &overwrite_val[0], pkt->getSize());
+                markDirty(host_addr, pkt->getSize());
+            }
 
             assert(!pkt->req->isInstFetch());
             TRACE_PACKET("Read/Write");
@@ -466,6 +492,7 @@ AbstractMemory::access(PacketPtr pkt)
         if (writeOK(pkt)) {
             if (pmemAddr) {
                 pkt->writeData(host_addr);
+                markDirty(host_addr, pkt->getSize());
                 DPRINTF(MemoryAccess, "%s write due to %s\n",
                         __func__, pkt->print());
             }
@@ -480,6 +507,9 @@ AbstractMemory::access(PacketPtr pkt)
         panic("Unexpected packet %s", pkt->print());
     }
 
+    if (pkt->isRead() || pkt->isWrite())
+        ppAccess->notify(pkt);
+
     if (pkt->needsResponse()) {
         pkt->makeResponse();
     }
@@ -501,6 +531,7 @@ AbstractMemory::functionalAccess(PacketPtr pkt)
     } else if (pkt->isWrite()) {
         if (pmemAddr) {
             pkt->writeData(host_addr);
+            markDirty(host_addr, pkt->getSize());
         }
         TRACE_PACKET("Write");
         pkt->makeResponse();
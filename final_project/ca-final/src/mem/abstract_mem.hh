@@ -46,10 +46,13 @@
 #ifndef __MEM_ABSTRACT_MEMORY_HH__
 #define __MEM_ABSTRACT_MEMORY_HH__
 
+#include <vector>
+
 #include "mem/backdoor.hh"
 #include "mem/port.hh"
 #include "params/AbstractMemory.hh"
 #include "sim/clocked_object.hh"
+#include "sim/probe/probe.hh"
 #include "sim/stats.hh"
 
 namespace gem5
@@ -117,6 +120,20 @@ class AbstractMemory : public ClockedObject
     // Pointer to host memory used to implement this memory
     uint8_t* pmemAddr;
 
+    /**
+     * Dirty-page tracking state for incremental checkpoints. The
+     * bitmap is owned by the backing store entry in PhysicalMemory
+     * and shared with all memories mapped onto that store; page
+     * indices are host offsets relative to pmemAddr (which is the
+     * store base). Tracking is off when dirtyMap is null.
+     */
+    std::vector<uint64_t> *dirtyMap;
+    unsigned dirtyPageBits;
+
+    /** Probe notified with every read/write serviced by access(),
+     *  e.g. to record a warmup trace during fast-forwarding. */
+    ProbePointArg<PacketPtr> *ppAccess;
+
     // Backdoor to access this memory.
     MemBackdoor backdoor;
 
@@ -244,6 +261,19 @@ class AbstractMemory : public ClockedObject
      */
     void setBackingStore(uint8_t* pmem_addr);
 
+    /**
+     * Enable dirty-page tracking for incremental checkpoints. Called
+     * by PhysicalMemory after the backing store has been assigned.
+     * Direct host access through the memory backdoor is disabled so
+     * that every write is visible to the bitmap.
+     *
+     * @param map Dirty bitmap shared with the backing store entry
+     * @param page_bits log2 of the tracking page size
+     */
+    void setDirtyTracking(std::vector<uint64_t> *map, unsigned page_bits);
+
+    void regProbePoints() override;
+
     void
     getBackdoor(MemBackdoorPtr &bd_ptr)
     {
@@ -303,6 +333,26 @@ class AbstractMemory : public ClockedObject
         return pmemAddr + addr - range.start();
     }
 
+    /**
+     * Record a write for incremental checkpointing. No-op unless
+     * dirty-page tracking has been enabled by PhysicalMemory.
+     *
+     * @param host_addr Host address of the first byte written
+     * @param size Number of bytes written
+     */
+    inline void
+    markDirty(uint8_t *host_addr, unsigned size)
+    {
+        if (!dirtyMap)
+            return;
+
+        size_t first = (host_addr - pmemAddr) >> dirtyPageBits;
+        size_t last = (host_addr + (size ? size - 1 : 0) - pmemAddr) >>
+            dirtyPageBits;
+        for (size_t page = first; page <= last; page++)
+            (*dirtyMap)[page >> 6] |= 1ULL << (page & 63);
+    }
+
     /**
      * Get the memory size.
      *
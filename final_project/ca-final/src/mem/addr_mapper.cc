@@ -37,6 +37,10 @@
 
 #include "mem/addr_mapper.hh"
 
+#include <algorithm>
+
+#include "base/bitfield.hh"
+
 namespace gem5
 {
 
@@ -274,4 +278,86 @@ RangeAddrMapper::getAddrRanges() const
     return ranges;
 }
 
+HashedAddrMapper::HashedAddrMapper(const HashedAddrMapperParams &p) :
+    AddrMapper(p),
+    ranges(p.ranges.begin(), p.ranges.end()),
+    targetBits(p.target_bits),
+    xorMasks(p.xor_masks),
+    // clamp the shift; >8 bits is rejected just below
+    stats(this, size_t(1) << std::min<size_t>(p.target_bits.size(), 8))
+{
+    fatal_if(targetBits.size() != xorMasks.size(),
+             "%s: target_bits and xor_masks must be the same length",
+             name());
+    fatal_if(targetBits.size() > 8,
+             "%s: at most 8 hashed target bits supported", name());
+
+    uint64_t target_mask = 0;
+    for (const auto bit : targetBits) {
+        fatal_if(bit >= 64, "%s: target bit %d out of range", name(), bit);
+        fatal_if(target_mask & (uint64_t(1) << bit),
+                 "%s: duplicate target bit %d", name(), bit);
+        target_mask |= uint64_t(1) << bit;
+    }
+
+    // The fold masks may not cover any rewritten bit; this is what
+    // keeps the mapping self-inverse and therefore bijective.
+    for (size_t i = 0; i < xorMasks.size(); i++) {
+        fatal_if(xorMasks[i] & target_mask,
+                 "%s: xor_masks[%d] overlaps a target bit", name(), i);
+    }
+}
+
+Addr
+HashedAddrMapper::remapAddr(Addr addr) const
+{
+    bool in_range = false;
+    for (const auto& r : ranges) {
+        if (r.contains(addr)) {
+            in_range = true;
+            break;
+        }
+    }
+    if (!in_range) {
+        stats.passThroughs++;
+        return addr;
+    }
+
+    Addr remapped = addr;
+    unsigned channel = 0;
+    for (size_t i = 0; i < xorMasks.size(); i++) {
+        remapped ^= Addr(popCount(addr & xorMasks[i]) & 1) << targetBits[i];
+        channel |= ((remapped >> targetBits[i]) & 1) << i;
+    }
+    stats.channelCount[channel]++;
+
+    return remapped;
+}
+
+MemBackdoorPtr
+HashedAddrMapper::getRevertedBackdoor(MemBackdoorPtr &backdoor,
+                                      const AddrRange &range)
+{
+    // A contiguous back door downstream scatters upstream; deny it.
+    return nullptr;
+}
+
+AddrRangeList
+HashedAddrMapper::getAddrRanges() const
+{
+    AddrRangeList list(ranges.begin(), ranges.end());
+    return list;
+}
+
+HashedAddrMapper::HashedMapperStats::HashedMapperStats(
+        statistics::Group *parent, size_t channels)
+    : statistics::Group(parent),
+      ADD_STAT(channelCount, statistics::units::Count::get(),
+               "Hashed accesses per value of the target-bit field"),
+      ADD_STAT(passThroughs, statistics::units::Count::get(),
+               "Accesses outside the configured ranges")
+{
+    channelCount.init(channels);
+}
+
 } // namespace gem5
@@ -40,10 +40,12 @@
 
 #include <vector>
 
+#include "base/statistics.hh"
 #include "mem/backdoor_manager.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "params/AddrMapper.hh"
+#include "params/HashedAddrMapper.hh"
 #include "params/RangeAddrMapper.hh"
 #include "sim/sim_object.hh"
 
@@ -319,6 +321,72 @@ class RangeAddrMapper : public AddrMapper
     BackdoorManager backdoorManager;
 };
 
+/**
+ * Address mapper that XOR-hashes a configurable set of bit positions,
+ * for modeling the hashed channel interleaving real memory subsystems
+ * use between the LLC and the memory controllers. Each target bit i
+ * is flipped by the parity of (addr & xor_masks[i]); since the masks
+ * may not cover any target bit, the mapping is its own inverse and
+ * trivially bijective. Addresses outside the configured ranges pass
+ * through unchanged. Channel-load statistics expose how evenly the
+ * hash spreads traffic over the target-bit values.
+ *
+ * Back doors are not passed through this mapper: a contiguous range
+ * downstream corresponds to a scattered set of addresses upstream,
+ * which a MemBackdoor cannot describe.
+ */
+class HashedAddrMapper : public AddrMapper
+{
+  public:
+    HashedAddrMapper(const HashedAddrMapperParams &p);
+
+    ~HashedAddrMapper() = default;
+
+    AddrRangeList getAddrRanges() const override;
+
+    void
+    init() override
+    {
+        AddrMapper::init();
+        cpuSidePort.sendRangeChange();
+    }
+
+  protected:
+    /** Ranges whose addresses are hashed; others pass through. */
+    std::vector<AddrRange> ranges;
+
+    /** Bit positions rewritten by the hash, one per fold mask. */
+    std::vector<unsigned> targetBits;
+
+    /** Fold masks; target bit i flips by parity of addr & mask i. */
+    std::vector<uint64_t> xorMasks;
+
+    Addr remapAddr(Addr addr) const override;
+
+    MemBackdoorPtr getRevertedBackdoor(MemBackdoorPtr &backdoor,
+                                       const AddrRange &range) override;
+
+    void
+    recvRangeChange() override
+    {
+    }
+
+  private:
+    struct HashedMapperStats : public statistics::Group
+    {
+        HashedMapperStats(statistics::Group *parent, size_t channels);
+
+        /** Hashed accesses per value of the target-bit field. */
+        statistics::Vector channelCount;
+
+        /** Accesses outside the configured ranges. */
+        statistics::Scalar passThroughs;
+    };
+
+    /** remapAddr() is const; counting accesses does not change it. */
+    mutable HashedMapperStats stats;
+};
+
 } // namespace gem5
 
 #endif //__MEM_ADDR_MAPPER_HH__
@@ -44,6 +44,7 @@ from m5.objects.Tags import *
 from m5.params import *
 from m5.proxy import *
 from m5.SimObject import SimObject
+from m5.util.pybind import PyBindMethod
 
 
 # Enum for cache clusivity, currently mostly inclusive or mostly
@@ -83,6 +84,11 @@ class BaseCache(ClockedObject):
     cxx_header = "mem/cache/base.hh"
     cxx_class = "gem5::BaseCache"
 
+    cxx_exports = [
+        PyBindMethod("saveTagState"),
+        PyBindMethod("loadTagState"),
+    ]
+
     size = Param.MemorySize("Capacity")
     assoc = Param.Unsigned("Associativity")
 
@@ -105,6 +111,28 @@ class BaseCache(ClockedObject):
 
     is_read_only = Param.Bool(False, "Is this cache read only (e.g. inst)")
 
+    # Size-aware prefetch insertion for compressed caches: drop a
+    # prefetch fill (serve it uncached) when inserting it would evict
+    # more than this many valid blocks from the victim superblock.
+    # 0 disables the bound.
+    max_prefetch_evictions = Param.Unsigned(
+        0, "Max valid blocks a prefetch fill may evict (0 = unlimited)"
+    )
+
+    # Stamp downstream miss/eviction packets with a criticality-
+    # derived QoS value (demand=2, prefetch=1, eviction=0); a QoS
+    # memory controller without a requestor policy schedules on it.
+    qos_from_criticality = Param.Bool(
+        False, "Derive packet QoS values from miss criticality"
+    )
+
+    wb_coalescing = Param.Bool(
+        False,
+        "Fold a new writeback into a queued, not-yet-issued writeback of "
+        "the same line (write combining) instead of writing the line to "
+        "memory twice",
+    )
+
     prefetcher = Param.BasePrefetcher(NULL, "Prefetcher attached to cache")
 
     tags = Param.BaseTags(BaseSetAssoc(), "Tag store")
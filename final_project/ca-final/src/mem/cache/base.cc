@@ -45,6 +45,10 @@
 
 #include "mem/cache/base.hh"
 
+#include <zlib.h>
+
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "debug/Cache.hh"
@@ -57,6 +61,7 @@
 #include "mem/cache/mshr.hh"
 #include "mem/cache/prefetch/base.hh"
 #include "mem/cache/queue_entry.hh"
+#include "mem/cache/tags/base_set_assoc.hh"
 #include "mem/cache/tags/compressed_tags.hh"
 #include "mem/cache/tags/partitioning_policies/partition_manager.hh"
 #include "mem/cache/tags/super_blk.hh"
@@ -86,6 +91,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       mshrQueue("MSHRs", p.mshrs, 0, p.demand_mshr_reserve, p.name),
       writeBuffer("write buffer", p.write_buffers, p.mshrs, p.name),
       tags(p.tags),
+      setAssocTags(dynamic_cast<BaseSetAssoc *>(p.tags)),
       compressor(p.compressor),
       partitionManager(p.partitioning_manager),
       prefetcher(p.prefetcher),
@@ -106,6 +112,9 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       forwardSnoops(true),
       clusivity(p.clusivity),
       isReadOnly(p.is_read_only),
+      wbCoalescing(p.wb_coalescing),
+      maxPrefetchEvictions(p.max_prefetch_evictions),
+      qosFromCriticality(p.qos_from_criticality),
       replaceExpansions(p.replace_expansions),
       moveContractions(p.move_contractions),
       blocked(0),
@@ -250,7 +259,7 @@ BaseCache::handleTimingReqHit(PacketPtr pkt, CacheBlk *blk, Tick request_time)
             // Basically we need to get the MSHR in the same state as if
             // we had missed and just received the response.
             // Request *req2 = new Request(*(pkt->req));
-            RequestPtr req2 = std::make_shared<Request>(*(pkt->req));
+            RequestPtr req2 = Request::make(*(pkt->req));
             PacketPtr pkt2 = new Packet(req2, pkt->cmd);
             MSHR *mshr = allocateMissBuffer(pkt2, curTick(), true);
             // Mark the MSHR "in service" (even though it's not) to prevent
@@ -539,6 +548,14 @@ BaseCache::recvTimingResp(PacketPtr pkt)
         assert(pkt->req->requestorId() < system->maxRequestors());
         stats.cmdStats(initial_tgt->pkt)
             .mshrMissLatency[pkt->req->requestorId()] += miss_latency;
+
+        // per-criticality-class latency distributions
+        if (initial_tgt->pkt->req->isPrefetch() ||
+            initial_tgt->pkt->cmd.isPrefetch()) {
+            stats.prefetchMissLatencyDist.sample(miss_latency);
+        } else {
+            stats.demandMissLatencyDist.sample(miss_latency);
+        }
     }
 
     PacketList writebacks;
@@ -1251,9 +1268,12 @@ BaseCache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
                 "Should never see a write in a read-only cache %s\n",
                 name());
 
-    // Access block in the tags
+    // Access block in the tags. Dispatch directly for the common
+    // set-associative tag store so the whole lookup inlines here;
+    // anything else goes through the virtual interface.
     Cycles tag_latency(0);
-    blk = tags->accessBlock(pkt, tag_latency);
+    blk = setAssocTags ? setAssocTags->accessBlock(pkt, tag_latency)
+                       : tags->accessBlock(pkt, tag_latency);
 
     DPRINTF(Cache, "%s for %s %s\n", __func__, pkt->print(),
             blk ? "hit " + blk->print() : "miss");
@@ -1656,6 +1676,23 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
     if (!victim)
         return nullptr;
 
+    // Size-aware prefetch insertion: with compressed tags a fill can
+    // displace several compressed resident blocks from a superblock.
+    // A speculative prefetch whose insertion would evict more valid
+    // data than the configured bound is not worth that risk; serve
+    // it without caching instead (the tempBlock path).
+    if (maxPrefetchEvictions && pkt->req->isPrefetch()) {
+        unsigned valid_victims = 0;
+        for (const auto& blk : evict_blks) {
+            if (blk->isValid())
+                valid_victims++;
+        }
+        if (valid_victims > maxPrefetchEvictions) {
+            stats.prefetchFillsDropped++;
+            return nullptr;
+        }
+    }
+
     // Print victim block's information
     DPRINTF(CacheRepl, "Replacement victim: %s\n", victim->print());
 
@@ -1677,6 +1714,141 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
     return victim;
 }
 
+namespace
+{
+
+/** Magic and version of the tag-state snapshot format. */
+const uint64_t tagStateMagic = 0x35454d4754414753ULL; // "GEM5TAGS"
+const uint32_t tagStateVersion = 1;
+
+} // anonymous namespace
+
+void
+BaseCache::saveTagState(const std::string &filename)
+{
+    // Collect the resident lines, oldest first, so that replaying
+    // them in order re-creates a comparable recency order.
+    struct TagRecord
+    {
+        Tick age;
+        Addr addr;
+        uint8_t secure;
+    };
+    std::vector<TagRecord> records;
+
+    tags->forEachBlk([this, &records](CacheBlk &blk) {
+        if (blk.isValid()) {
+            records.push_back({blk.getAge(),
+                               regenerateBlkAddr(&blk),
+                               (uint8_t)(blk.isSecure() ? 1 : 0)});
+        }
+    });
+
+    std::sort(records.begin(), records.end(),
+              [](const TagRecord &a, const TagRecord &b) {
+                  return a.age > b.age;
+              });
+
+    gzFile out = gzopen(filename.c_str(), "wb");
+    if (out == NULL)
+        fatal("%s: can't open tag state file '%s'\n", name(), filename);
+
+    auto write = [this, out, &filename](const void *data, unsigned len) {
+        if (gzwrite(out, data, len) != (int)len)
+            fatal("%s: write failed on tag state file '%s'\n", name(),
+                  filename);
+    };
+
+    write(&tagStateMagic, sizeof(tagStateMagic));
+    write(&tagStateVersion, sizeof(tagStateVersion));
+    const uint64_t count = records.size();
+    write(&count, sizeof(count));
+    for (const auto &record : records) {
+        write(&record.addr, sizeof(record.addr));
+        write(&record.secure, sizeof(record.secure));
+    }
+
+    if (gzclose(out))
+        fatal("%s: close failed on tag state file '%s'\n", name(),
+              filename);
+
+    inform("%s: saved %d resident lines to %s\n", name(), count, filename);
+}
+
+void
+BaseCache::loadTagState(const std::string &filename)
+{
+    gzFile in = gzopen(filename.c_str(), "rb");
+    if (in == NULL)
+        fatal("%s: can't open tag state file '%s'\n", name(), filename);
+
+    auto read = [this, in, &filename](void *data, unsigned len) {
+        if (gzread(in, data, len) != (int)len)
+            fatal("%s: read failed on tag state file '%s'\n", name(),
+                  filename);
+    };
+
+    uint64_t magic;
+    uint32_t version;
+    read(&magic, sizeof(magic));
+    read(&version, sizeof(version));
+    fatal_if(magic != tagStateMagic, "%s: '%s' is not a tag state file",
+             name(), filename);
+    fatal_if(version != tagStateVersion,
+             "%s: unsupported tag state version %d in '%s'", name(),
+             version, filename);
+
+    uint64_t count;
+    read(&count, sizeof(count));
+    for (uint64_t i = 0; i < count; i++) {
+        Addr addr;
+        uint8_t secure;
+        read(&addr, sizeof(addr));
+        read(&secure, sizeof(secure));
+        warmupTouch(addr, secure);
+    }
+
+    if (gzclose(in))
+        fatal("%s: close failed on tag state file '%s'\n", name(),
+              filename);
+
+    inform("%s: restored %d lines from %s\n", name(), count, filename);
+}
+
+void
+BaseCache::warmupTouch(Addr addr, bool is_secure)
+{
+    addr &= ~Addr(blkSize - 1);
+
+    // A minimal read packet drives the regular tags interfaces; it
+    // carries no data, so neither the compressor nor a prefetcher
+    // ever sees it.
+    RequestPtr req = Request::make(
+            addr, blkSize, 0, Request::funcRequestorId);
+    if (is_secure)
+        req->setFlags(Request::SECURE);
+    Packet pkt(req, MemCmd::ReadReq);
+
+    Cycles lat;
+    if (tags->accessBlock(&pkt, lat)) {
+        // resident: the replacement state has been refreshed
+        return;
+    }
+
+    PacketList writebacks;
+    CacheBlk *blk = allocateBlock(&pkt, writebacks);
+    if (!blk)
+        return;
+
+    blk->setCoherenceBits(CacheBlk::ReadableBit);
+
+    // Warmed blocks are inserted clean, so evictions during warmup
+    // can only produce clean writebacks; drop them, memory is already
+    // up to date.
+    for (auto &wb_pkt : writebacks)
+        delete wb_pkt;
+}
+
 void
 BaseCache::invalidateBlock(CacheBlk *blk)
 {
@@ -1716,7 +1888,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 
     stats.writebacks[Request::wbRequestorId]++;
 
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure())
@@ -1759,7 +1931,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
 PacketPtr
 BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
 {
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure()) {
@@ -1833,7 +2005,7 @@ BaseCache::writebackVisitor(CacheBlk &blk)
     if (blk.isSet(CacheBlk::DirtyBit)) {
         assert(blk.isValid());
 
-        RequestPtr request = std::make_shared<Request>(
+        RequestPtr request = Request::make(
             regenerateBlkAddr(&blk), blkSize, 0, Request::funcRequestorId);
 
         request->taskId(blk.getTaskId());
@@ -1934,6 +2106,16 @@ BaseCache::sendMSHRQueuePacket(MSHR* mshr)
     // as forwarded packets may already have existing state
     pkt->pushSenderState(mshr);
 
+    // classify the miss for criticality-aware scheduling below this
+    // cache: demand misses outrank prefetches, which outrank the
+    // writeback/eviction traffic stamped in sendWriteQueuePacket. A
+    // QoS memory controller without a requestor policy schedules
+    // directly on this packet value.
+    if (qosFromCriticality) {
+        pkt->qosValue(tgt_pkt->req->isPrefetch() ||
+                      tgt_pkt->cmd.isPrefetch() ? 1 : 2);
+    }
+
     if (pkt->isClean() && blk && blk->isSet(CacheBlk::DirtyBit)) {
         // A cache clean opearation is looking for a dirty block. Mark
         // the packet so that the destination xbar can determine that
@@ -1993,6 +2175,10 @@ BaseCache::sendWriteQueuePacket(WriteQueueEntry* wq_entry)
 
     DPRINTF(Cache, "%s: write %s\n", __func__, tgt_pkt->print());
 
+    // eviction traffic is the least critical class
+    if (qosFromCriticality)
+        tgt_pkt->qosValue(0);
+
     // forward as is, both for evictions and uncacheable writes
     if (!memSidePort.sendTimingReq(tgt_pkt)) {
         // note that we have now masked any requestBus and
@@ -2286,6 +2472,14 @@ BaseCache::CacheStats::CacheStats(BaseCache &c)
              "average overall mshr uncacheable latency"),
     ADD_STAT(replacements, statistics::units::Count::get(),
              "number of replacements"),
+    ADD_STAT(writebacksCoalesced, statistics::units::Count::get(),
+             "number of writebacks folded into a queued writeback"),
+    ADD_STAT(prefetchFillsDropped, statistics::units::Count::get(),
+             "prefetch fills dropped for evicting too much valid data"),
+    ADD_STAT(demandMissLatencyDist, statistics::units::Tick::get(),
+             "distribution of demand miss latencies"),
+    ADD_STAT(prefetchMissLatencyDist, statistics::units::Tick::get(),
+             "distribution of prefetch miss latencies"),
     ADD_STAT(dataExpansions, statistics::units::Count::get(),
              "number of data expansions"),
     ADD_STAT(dataContractions, statistics::units::Count::get(),
@@ -2309,6 +2503,9 @@ BaseCache::CacheStats::regStats()
     for (auto &cs : cmd)
         cs->regStatsFromParent();
 
+    demandMissLatencyDist.init(16);
+    prefetchMissLatencyDist.init(16);
+
 // These macros make it easier to sum the right subset of commands and
 // to change the subset of commands that are considered "demand" vs
 // "non-demand"
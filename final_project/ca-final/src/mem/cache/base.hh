@@ -80,6 +80,8 @@
 namespace gem5
 {
 
+class BaseSetAssoc;
+
 namespace prefetch
 {
     class Base;
@@ -341,6 +343,13 @@ class BaseCache : public ClockedObject
         bool coalesce() const override
         { return cache.coalesce(); }
 
+        unsigned
+        mshrOccupancyPct() const override
+        {
+            return (100 * cache.mshrQueue.getAllocatedEntries()) /
+                cache.mshrQueue.getNumEntries();
+        }
+
     } accessor;
 
     /** Miss status registers */
@@ -352,6 +361,14 @@ class BaseCache : public ClockedObject
     /** Tag and data Storage */
     BaseTags *tags;
 
+    /**
+     * tags downcast to BaseSetAssoc when that is the configured tag
+     * store (the overwhelmingly common case), so the hot lookup path
+     * can dispatch directly -- and inline -- instead of going through
+     * the virtual interface. Null for any other tag type.
+     */
+    BaseSetAssoc *setAssocTags;
+
     /** Compression method being used. */
     compression::Base* compressor;
 
@@ -488,6 +505,20 @@ class BaseCache : public ClockedObject
 
     /**
      * Does all the processing necessary to perform the provided request.
+     *
+     * The write policy here is write-back by construction: dirty
+     * state is the coherence protocol's owned state, and everything
+     * downstream (snoop responses, writeback/clean-eviction
+     * messages, MSHR deferral) assumes it. A per-range write-through
+     * mode is not a local change to this function -- every store
+     * completion path (hit here, miss completing in recvTimingResp,
+     * whole-line writes, LL/SC) would have to emit and track a
+     * WriteClean toward the point of coherency, and a combining
+     * buffer for those writes is a new queue with its own ordering
+     * rules against snoops. Ranges that must not linger dirty can be
+     * marked uncacheable today; true per-range write-through needs
+     * that protocol-level design, not a flag in access().
+     *
      * @param pkt The memory request to perform.
      * @param blk The cache block to be updated.
      * @param lat The latency of the access.
@@ -833,6 +864,34 @@ class BaseCache : public ClockedObject
      */
     void invalidateBlock(CacheBlk *blk);
 
+    /**
+     * Functionally touch an address for cache warmup: update the
+     * replacement state if the line is resident, otherwise allocate
+     * it (evicting without writeback; warmed blocks are inserted
+     * clean). Intended to be driven by a warmup trace at restore
+     * time, before detailed simulation starts.
+     *
+     * @param addr Address to warm (aligned down to a block boundary)
+     * @param is_secure True if the target memory space is secure
+     */
+    void warmupTouch(Addr addr, bool is_secure = false);
+
+    /**
+     * Save the cache's tag state (the resident line addresses, in
+     * age order) to a compact, versioned binary file, so a warmed
+     * cache can be re-created across configuration variants without
+     * re-simulating the warmup. Exported to Python.
+     *
+     * Only the tag/recency state is captured, not data or coherence
+     * state; loadTagState() re-creates the lines clean through
+     * warmupTouch(), which warms whatever replacement policy the
+     * loading configuration uses.
+     */
+    void saveTagState(const std::string &filename);
+
+    /** Restore tag state saved by saveTagState(). */
+    void loadTagState(const std::string &filename);
+
     /**
      * Create a writeback request for the given block.
      *
@@ -948,6 +1007,28 @@ class BaseCache : public ClockedObject
      */
     const bool isReadOnly;
 
+    /**
+     * Fold a new writeback into a queued, not-yet-issued writeback of
+     * the same line (write combining) instead of sending the line to
+     * memory twice.
+     */
+    const bool wbCoalescing;
+
+    /**
+     * If non-zero, a prefetch fill that would evict more than this
+     * many valid blocks is served uncached instead of inserted. Only
+     * meaningful with compressed tags, where one insertion can
+     * displace several compressed residents of a superblock.
+     */
+    const unsigned maxPrefetchEvictions;
+
+    /**
+     * Stamp downstream packets with a criticality-derived QoS value
+     * (demand > prefetch > eviction) so QoS-aware memory controllers
+     * can schedule on miss criticality.
+     */
+    const bool qosFromCriticality;
+
     /**
      * when a data expansion of a compressed block happens it will not be
      * able to co-allocate where it is at anymore. If true, the replacement
@@ -1139,6 +1220,18 @@ class BaseCache : public ClockedObject
         /** Number of replacements of valid blocks. */
         statistics::Scalar replacements;
 
+        /** Writebacks folded into an already-queued writeback. */
+        statistics::Scalar writebacksCoalesced;
+
+        /** Prefetch fills dropped for evicting too much valid data. */
+        statistics::Scalar prefetchFillsDropped;
+
+        /** Distribution of demand miss latencies. */
+        statistics::Histogram demandMissLatencyDist;
+
+        /** Distribution of prefetch miss latencies. */
+        statistics::Histogram prefetchMissLatencyDist;
+
         /** Number of data expansions. */
         statistics::Scalar dataExpansions;
 
@@ -1214,6 +1307,21 @@ class BaseCache : public ClockedObject
             writeBuffer.findMatch(blk_addr, pkt->isSecure());
         if (wq_entry && !wq_entry->inService) {
             DPRINTF(Cache, "Potential to merge writeback %s", pkt->print());
+
+            PacketPtr queued_pkt = wq_entry->getTarget()->pkt;
+            if (wbCoalescing && pkt->cmd == MemCmd::WritebackDirty &&
+                queued_pkt->cmd == MemCmd::WritebackDirty &&
+                pkt->getSize() == blkSize &&
+                queued_pkt->getSize() == blkSize) {
+                // The newer writeback carries the complete up-to-date
+                // line; fold its data into the queued entry (write
+                // combining) instead of writing the line to memory
+                // twice.
+                queued_pkt->setData(pkt->getConstPtr<uint8_t>());
+                stats.writebacksCoalesced++;
+                delete pkt;
+                return;
+            }
         }
 
         writeBuffer.allocate(blk_addr, blkSize, pkt, time, order++);
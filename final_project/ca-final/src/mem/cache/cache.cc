@@ -390,7 +390,7 @@ Cache::handleTimingReqMiss(PacketPtr pkt, CacheBlk *blk, Tick forward_time,
 
         if (!mshr) {
             // copy the request and create a new SoftPFReq packet
-            RequestPtr req = std::make_shared<Request>(pkt->req->getPaddr(),
+            RequestPtr req = Request::make(pkt->req->getPaddr(),
                                                     pkt->req->getSize(),
                                                     pkt->req->getFlags(),
                                                     pkt->req->requestorId());
@@ -506,6 +506,20 @@ Cache::createMissPacket(PacketPtr cpu_pkt, CacheBlk *blk,
         return nullptr;
     }
 
+    // Far atomics would hook in here: an AMO that misses could be
+    // forwarded as-is (return nullptr) instead of fetching the line
+    // exclusive, letting whichever level owns the line -- or the
+    // memory, which already executes AtomicOpFunctors -- resolve it
+    // in place. The atomic-mode path below handles forwards fully.
+    // What makes this more than a one-line change is the timing
+    // path: a forwarded AMO's MSHR is cacheable, so later misses to
+    // the same line would coalesce onto it expecting a line fill
+    // that never comes. Uncacheable requests avoid this via their
+    // MSHR matching exemption; far atomics need the same
+    // non-coalescable treatment (or target deferral) plus shared-
+    // copy invalidation when forwarding past a Shared local block,
+    // before the feature is sound.
+
     assert(cpu_pkt->needsResponse());
 
     MemCmd cmd;
@@ -975,7 +989,7 @@ Cache::cleanEvictBlk(CacheBlk *blk)
     assert(blk && blk->isValid() && !blk->isSet(CacheBlk::DirtyBit));
 
     // Creating a zero sized write, a message to the snoop filter
-    RequestPtr req = std::make_shared<Request>(
+    RequestPtr req = Request::make(
         regenerateBlkAddr(blk), blkSize, 0, Request::wbRequestorId);
 
     if (blk->isSecure())
@@ -68,6 +68,13 @@ struct CacheAccessor
 
     /** Determine if cache is coalescing writes */
     virtual bool coalesce() const = 0;
+
+    /**
+     * Fraction of the cache's MSHRs currently in use, in percent.
+     * Owners that cannot report it return 0; used e.g. to adapt
+     * prefetcher aggressiveness to demand-miss pressure.
+     */
+    virtual unsigned mshrOccupancyPct() const { return 0; }
 };
 
 /**
@@ -128,6 +128,12 @@ class Base : public SimObject
     /** Pointer to the parent cache. */
     BaseCache* cache;
 
+    /**
+     * Scratch buffer reused by compress() for the chunked view of the
+     * line, so every fill does not allocate a fresh vector.
+     */
+    std::vector<Chunk> chunkBuffer;
+
     struct BaseStats : public statistics::Group
     {
         const Base& compressor;
@@ -164,6 +170,12 @@ class Base : public SimObject
      */
     std::vector<Chunk> toChunks(const uint64_t* data) const;
 
+    /**
+     * As above, but filling a caller-provided vector so the per-call
+     * allocation can be amortized (see chunkBuffer).
+     */
+    void toChunks(const uint64_t* data, std::vector<Chunk> &chunks) const;
+
     /**
      * This function re-joins the chunks to recreate the original data.
      *
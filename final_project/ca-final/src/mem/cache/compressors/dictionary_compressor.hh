@@ -325,6 +325,59 @@ class DictionaryCompressor<T>::Pattern
     /** Default destructor. */
     virtual ~Pattern() = default;
 
+    /**
+     * @{
+     * Pooled allocation. compressValue() instantiates and discards a
+     * candidate pattern per dictionary entry for every value of every
+     * compressed line, which made the host allocator the dominant
+     * cost of compressed-cache studies. Freed pattern storage is
+     * recycled through per-thread free lists binned by size class, so
+     * the fill path stays off malloc/free entirely once warm.
+     */
+    static void *
+    operator new(std::size_t size)
+    {
+        constexpr std::size_t granule = 16;
+        const std::size_t total = size + granule;
+        const std::size_t cls = (total + granule - 1) / granule;
+
+        void *mem;
+        if (cls < poolClasses && poolFree[cls]) {
+            mem = poolFree[cls];
+            poolFree[cls] = *static_cast<void **>(mem);
+        } else if (cls < poolClasses) {
+            mem = ::operator new(cls * granule);
+        } else {
+            mem = ::operator new(total);
+        }
+
+        *static_cast<std::size_t *>(mem) = cls;
+        return static_cast<char *>(mem) + granule;
+    }
+
+    static void
+    operator delete(void *ptr)
+    {
+        constexpr std::size_t granule = 16;
+        char *mem = static_cast<char *>(ptr) - granule;
+        const std::size_t cls = *reinterpret_cast<std::size_t *>(mem);
+
+        if (cls < poolClasses) {
+            *reinterpret_cast<void **>(mem) = poolFree[cls];
+            poolFree[cls] = mem;
+        } else {
+            ::operator delete(mem);
+        }
+    }
+    /** @} */
+
+  private:
+    /** Recycled pattern storage, binned by 16-byte size class. */
+    static constexpr std::size_t poolClasses = 16;
+    static inline thread_local void *poolFree[poolClasses] = {};
+
+  public:
+
     /**
      * Get enum number associated to this pattern.
      *
@@ -166,7 +166,9 @@ class MSHR : public QueueEntry, public Printable
         {}
     };
 
-    class TargetList : public std::list<Target>, public Named
+    class TargetList :
+        public std::list<Target, PooledNodeAllocator<Target>>,
+        public Named
     {
 
       public:
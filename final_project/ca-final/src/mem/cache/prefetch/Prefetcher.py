@@ -38,6 +38,7 @@
 
 from m5.objects.ClockedObject import ClockedObject
 from m5.objects.IndexingPolicies import *
+from m5.objects.Probe import ProbeListenerObject
 from m5.objects.ReplacementPolicies import *
 from m5.objects.Tags import *
 from m5.params import *
@@ -59,6 +60,21 @@ class HWPProbeEvent:
                 )
 
 
+class AccessTraceDumper(ProbeListenerObject):
+    """Dumps a cache probe's access stream as a text trace consumable
+    by the ghb_replay harness ("<pc> <addr>" per line). Point manager
+    at the cache to record."""
+
+    type = "AccessTraceDumper"
+    cxx_class = "gem5::prefetch::AccessTraceDumper"
+    cxx_header = "mem/cache/prefetch/access_trace_dumper.hh"
+
+    probe = Param.String("Miss", "Cache probe to record (Miss/Hit/Fill)")
+    trace_file = Param.String(
+        "access_trace.txt", "Output file, relative to the output directory"
+    )
+
+
 class BasePrefetcher(ClockedObject):
     type = "BasePrefetcher"
     abstract = True
@@ -83,6 +99,12 @@ class BasePrefetcher(ClockedObject):
         True,
         "Notify the hardware prefetcher on hit on prefetched lines",
     )
+    stats_track_timeliness = Param.Bool(
+        False,
+        "Track prefetch fill-to-first-use latency, per-PC usefulness "
+        "and pollution (demand misses on lines displaced by prefetch "
+        "fills) in the stats",
+    )
     use_virtual_addresses = Param.Bool(
         False, "Use virtual addresses for prefetching"
     )
@@ -127,6 +149,19 @@ class MultiPrefetcher(BasePrefetcher):
 
     prefetchers = VectorParam.BasePrefetcher([], "Array of prefetchers")
 
+    arbitrate = Param.Bool(
+        False,
+        "Score the sub-prefetchers by the accuracy they achieve each "
+        "evaluation epoch and stop issuing from those below the "
+        "throttle threshold until they recover",
+    )
+    eval_period = Param.Unsigned(
+        4096, "Issued prefetches between arbitration evaluations"
+    )
+    throttle_threshold = Param.Float(
+        0.25, "Minimum epoch accuracy (useful/issued) to keep issuing"
+    )
+
 
 class QueuedPrefetcher(BasePrefetcher):
     type = "QueuedPrefetcher"
@@ -164,6 +199,21 @@ class QueuedPrefetcher(BasePrefetcher):
         that can be throttled depending on the accuracy of the prefetcher.",
     )
 
+    adaptive_throttle = Param.Bool(
+        False,
+        "Adapt the effective throttle percentage to the cache's MSHR "
+        "occupancy so prefetches back off while demand misses queue",
+    )
+    throttle_epoch = Param.Unsigned(
+        1024, "Notifications per adaptive-throttle evaluation"
+    )
+    mshr_high_watermark_pct = Param.Percent(
+        85, "Average MSHR occupancy above which to throttle harder"
+    )
+    mshr_low_watermark_pct = Param.Percent(
+        50, "Average MSHR occupancy below which to relax the throttle"
+    )
+
 
 class GHBPrefetcher(QueuedPrefetcher):
     type = "GHBPrefetcher"
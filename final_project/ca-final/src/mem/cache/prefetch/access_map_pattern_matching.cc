@@ -126,8 +126,8 @@ void
 AccessMapPatternMatching::setEntryState(AccessMapEntry &entry,
     Addr block, enum AccessMapState state)
 {
-    enum AccessMapState old = entry.states[block];
-    entry.states[block] = state;
+    enum AccessMapState old = entry.getState(block);
+    entry.setState(block, state);
 
     //do not update stats when initializing
     if (state == AM_INIT) return;
@@ -185,24 +185,13 @@ AccessMapPatternMatching::calculatePrefetch(const Base::PrefetchInfo &pfi,
     setEntryState(*am_entry_curr, current_block, AM_ACCESS);
 
     /**
-     * Create a contiguous copy of the 3 entries states.
-     * With this, we avoid doing boundaries checking in the loop that looks
-     * for prefetch candidates, mark out of range positions with AM_INVALID
-     */
-    std::vector<AccessMapState> states(3 * lines_per_zone);
-    for (unsigned idx = 0; idx < lines_per_zone; idx += 1) {
-        states[idx] =
-            am_entry_prev != nullptr ? am_entry_prev->states[idx] : AM_INVALID;
-        states[idx + lines_per_zone] = am_entry_curr->states[idx];
-        states[idx + 2 * lines_per_zone] =
-            am_entry_next != nullptr ? am_entry_next->states[idx] : AM_INVALID;
-    }
-
-    /**
-     * am_entry_prev->states => states[               0 ..   lines_per_zone-1]
-     * am_entry_curr->states => states[  lines_per_zone .. 2*lines_per_zone-1]
-     * am_entry_next->states => states[2*lines_per_zone .. 3*lines_per_zone-1]
+     * Candidate tests run over a logical window spanning
+     * [prev | curr | next]; the packed bitmaps are tested in place,
+     * with unallocated neighbor zones acting as AM_INVALID, so no
+     * per-access copy of the three zones is materialized.
      */
+    ZoneWindow window{am_entry_prev, am_entry_curr, am_entry_next,
+                      lines_per_zone};
 
     // index of the current_block in the new vector
     Addr states_current_block = current_block + lines_per_zone;
@@ -210,7 +199,7 @@ AccessMapPatternMatching::calculatePrefetch(const Base::PrefetchInfo &pfi,
     int max_stride = limitStride == 0 ? lines_per_zone / 2 : limitStride + 1;
     for (int stride = 1; stride < max_stride; stride += 1) {
         // Test accessed positive strides
-        if (checkCandidate(states, states_current_block, stride)) {
+        if (checkCandidate(window, states_current_block, stride)) {
             // candidate found, current_block - stride
             Addr pf_addr;
             if (stride > current_block) {
@@ -234,7 +223,7 @@ AccessMapPatternMatching::calculatePrefetch(const Base::PrefetchInfo &pfi,
         }
 
         // Test accessed negative strides
-        if (checkCandidate(states, states_current_block, -stride)) {
+        if (checkCandidate(window, states_current_block, -stride)) {
             // candidate found, current_block + stride
             Addr pf_addr;
             if (current_block + stride >= lines_per_zone) {
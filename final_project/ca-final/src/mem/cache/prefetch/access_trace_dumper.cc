@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/prefetch/access_trace_dumper.hh"
+
+#include <ostream>
+
+#include "base/cprintf.hh"
+#include "base/output.hh"
+#include "mem/packet.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+AccessTraceDumper::AccessTraceDumper(const AccessTraceDumperParams &p)
+    : ProbeListenerObject(p),
+      probeName(p.probe),
+      trace(simout.create(p.trace_file)->stream())
+{
+}
+
+AccessTraceDumper::~AccessTraceDumper()
+{
+}
+
+void
+AccessTraceDumper::regProbeListeners()
+{
+    listeners.push_back(getProbeManager()->connect<Listener>(
+            this, probeName, &AccessTraceDumper::notify));
+}
+
+void
+AccessTraceDumper::notify(const CacheAccessProbeArg &arg)
+{
+    const PacketPtr pkt = arg.pkt;
+
+    // the replay format: "<pc> <addr>", pc "-" when unknown
+    if (pkt->req->hasPC()) {
+        ccprintf(*trace, "%x %x\n", pkt->req->getPC(), pkt->getAddr());
+    } else {
+        ccprintf(*trace, "- %x\n", pkt->getAddr());
+    }
+}
+
+} // namespace prefetch
+} // namespace gem5
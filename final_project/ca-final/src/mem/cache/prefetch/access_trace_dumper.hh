@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_ACCESS_TRACE_DUMPER_HH__
+#define __MEM_CACHE_PREFETCH_ACCESS_TRACE_DUMPER_HH__
+
+#include <iosfwd>
+
+#include "mem/cache/cache_probe_arg.hh"
+#include "params/AccessTraceDumper.hh"
+#include "sim/probe/probe_listener_object.hh"
+
+namespace gem5
+{
+
+namespace prefetch
+{
+
+/**
+ * Dumps the accesses seen on a cache probe (by default "Miss") as a
+ * text trace of "<pc> <addr>" lines -- the format the ghb_replay
+ * harness consumes -- so prefetcher changes can be evaluated against
+ * real access streams without re-running detailed simulation.
+ */
+class AccessTraceDumper : public ProbeListenerObject
+{
+  public:
+    AccessTraceDumper(const AccessTraceDumperParams &p);
+    ~AccessTraceDumper();
+
+    void regProbeListeners() override;
+
+    void notify(const CacheAccessProbeArg &arg);
+
+  private:
+    typedef ProbeListenerArg<AccessTraceDumper, CacheAccessProbeArg>
+        Listener;
+
+    /** Name of the cache probe to record ("Miss", "Hit", "Fill"). */
+    const std::string probeName;
+
+    /** The output stream, owned by the simulation output directory. */
+    std::ostream *trace;
+};
+
+} // namespace prefetch
+} // namespace gem5
+
+#endif // __MEM_CACHE_PREFETCH_ACCESS_TRACE_DUMPER_HH__
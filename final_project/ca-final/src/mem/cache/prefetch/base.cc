@@ -86,6 +86,7 @@ void
 Base::PrefetchListener::notify(const CacheAccessProbeArg &arg)
 {
     if (isFill) {
+        parent.fillObserved(arg);
         parent.notifyFill(arg);
     } else {
         parent.probeNotify(arg, miss);
@@ -95,8 +96,10 @@ Base::PrefetchListener::notify(const CacheAccessProbeArg &arg)
 void
 Base::PrefetchEvictListener::notify(const EvictionInfo &info)
 {
-    if (info.newData.empty())
+    if (info.newData.empty()) {
+        parent.evictObserved(info);
         parent.notifyEvict(info);
+    }
 }
 
 Base::Base(const BasePrefetcherParams &p)
@@ -110,7 +113,8 @@ Base::Base(const BasePrefetcherParams &p)
       prefetchOnPfHit(p.prefetch_on_pf_hit),
       useVirtualAddresses(p.use_virtual_addresses),
       prefetchStats(this), issuedPrefetches(0),
-      usefulPrefetches(0), mmu(nullptr)
+      usefulPrefetches(0),
+      trackTimeliness(p.stats_track_timeliness), mmu(nullptr)
 {
 }
 
@@ -149,10 +153,24 @@ Base::StatGroup::StatGroup(statistics::Group *parent)
     ADD_STAT(pfHitInWB, statistics::units::Count::get(),
         "number of prefetches hit in the Write Buffer"),
     ADD_STAT(pfLate, statistics::units::Count::get(),
-        "number of late prefetches (hitting in cache, MSHR or WB)")
+        "number of late prefetches (hitting in cache, MSHR or WB)"),
+    ADD_STAT(pfFirstUseLatency, statistics::units::Tick::get(),
+        "ticks between a prefetch's fill and its first demand use"),
+    ADD_STAT(pfPollution, statistics::units::Count::get(),
+        "demand misses on lines displaced by prefetch fills"),
+    ADD_STAT(pfUsefulPerPC, statistics::units::Count::get(),
+        "useful prefetch counts per accessing PC")
 {
     using namespace statistics;
 
+    pfFirstUseLatency
+        .init(16)
+        .flags(nozero);
+
+    pfUsefulPerPC
+        .init(0)
+        .flags(nozero);
+
     pfUnused.flags(nozero);
 
     accuracy.flags(total);
@@ -256,6 +274,30 @@ Base::probeNotify(const CacheAccessProbeArg &acc, bool miss)
             prefetchStats.pfUsefulButMiss++;
     }
 
+    if (trackTimeliness) {
+        const Addr blk_addr = blockAddress(pkt->getAddr());
+        if (has_been_prefetched) {
+            // first demand use of a prefetched line: record timeliness
+            auto it = pfFillTick.find(blk_addr);
+            if (it != pfFillTick.end()) {
+                prefetchStats.pfFirstUseLatency.sample(
+                        curTick() - it->second);
+                pfFillTick.erase(it);
+            }
+            if (pkt->req->hasPC()) {
+                prefetchStats.pfUsefulPerPC.sample(pkt->req->getPC(), 1);
+            }
+        }
+        if (miss) {
+            // demand miss on a line a prefetch fill displaced earlier
+            auto it = pfVictimTick.find(blk_addr);
+            if (it != pfVictimTick.end()) {
+                prefetchStats.pfPollution++;
+                pfVictimTick.erase(it);
+            }
+        }
+    }
+
     // Verify this access type is observed by prefetcher
     if (observeAccess(pkt, miss, has_been_prefetched)) {
         if (useVirtualAddresses && pkt->req->hasVaddr()) {
@@ -268,6 +310,42 @@ Base::probeNotify(const CacheAccessProbeArg &acc, bool miss)
     }
 }
 
+void
+Base::fillObserved(const CacheAccessProbeArg &acc)
+{
+    if (!trackTimeliness)
+        return;
+
+    const PacketPtr pkt = acc.pkt;
+    if (pkt->req->requestorId() != requestorId)
+        return;
+
+    // a fill caused by one of our prefetches
+    if (pfFillTick.size() >= trackCap)
+        pfFillTick.clear();
+    pfFillTick[blockAddress(pkt->getAddr())] = curTick();
+    lastPfFillTick = curTick();
+}
+
+void
+Base::evictObserved(const EvictionInfo &info)
+{
+    if (!trackTimeliness)
+        return;
+
+    // attribute evictions happening in the same tick as one of our
+    // prefetch fills to that fill: these are the fill's victims
+    if (lastPfFillTick != curTick())
+        return;
+
+    if (pfVictimTick.size() >= trackCap)
+        pfVictimTick.clear();
+    pfVictimTick[blockAddress(info.addr)] = curTick();
+
+    // the victim is no longer a resident prefetched line
+    pfFillTick.erase(blockAddress(info.addr));
+}
+
 void
 Base::regProbeListeners()
 {
@@ -47,6 +47,7 @@
 #define __MEM_CACHE_PREFETCH_BASE_HH__
 
 #include <cstdint>
+#include <unordered_map>
 
 #include "arch/generic/tlb.hh"
 #include "base/compiler.hh"
@@ -274,6 +275,13 @@ class Base : public ClockedObject
         }
     };
 
+  public:
+    /** Raw issued-prefetch count, e.g. for composite arbitration. */
+    uint64_t getIssuedPrefetches() const { return issuedPrefetches; }
+
+    /** Raw useful-prefetch count, e.g. for composite arbitration. */
+    uint64_t getUsefulPrefetches() const { return usefulPrefetches; }
+
   protected:
 
     // PARAMETERS
@@ -368,6 +376,17 @@ class Base : public ClockedObject
         /** The number of times a HW-prefetch is late
          * (hit in cache, MSHR, WB). */
         statistics::Formula pfLate;
+
+        /** Ticks between a prefetch's fill and its first demand use
+         * (timeliness; only collected with stats_track_timeliness). */
+        statistics::Histogram pfFirstUseLatency;
+
+        /** Demand misses on lines that were evicted by a prefetch
+         * fill (pollution; only with stats_track_timeliness). */
+        statistics::Scalar pfPollution;
+
+        /** Useful-prefetch counts per prefetch-triggering PC. */
+        statistics::SparseHistogram pfUsefulPerPC;
     } prefetchStats;
 
     /** Total prefetches issued */
@@ -375,6 +394,21 @@ class Base : public ClockedObject
     /** Total prefetches that has been useful */
     uint64_t usefulPrefetches;
 
+    /** Collect fill-time/first-use/pollution instrumentation. */
+    const bool trackTimeliness;
+
+    /**
+     * Fill ticks of resident prefetched lines and eviction ticks of
+     * lines displaced by prefetch fills, both keyed by block address
+     * and bounded by clearing when they outgrow trackCap entries.
+     */
+    std::unordered_map<Addr, Tick> pfFillTick;
+    std::unordered_map<Addr, Tick> pfVictimTick;
+    static constexpr size_t trackCap = 65536;
+
+    /** Fill tick last seen, to attribute same-tick evictions. */
+    Tick lastPfFillTick = MaxTick;
+
     /** Registered mmu for address translations */
     BaseMMU * mmu;
 
@@ -393,6 +427,15 @@ class Base : public ClockedObject
     notify(const CacheAccessProbeArg &acc, const PrefetchInfo &pfi) = 0;
 
     /** Notify prefetcher of cache fill */
+    /**
+     * Timeliness/pollution bookkeeping run on every fill observed by
+     * the cache, before the virtual notifyFill() hook.
+     */
+    void fillObserved(const CacheAccessProbeArg &acc);
+
+    /** Same for evictions: attribute prefetch-fill victims. */
+    void evictObserved(const EvictionInfo &info);
+
     virtual void notifyFill(const CacheAccessProbeArg &acc)
     {}
 
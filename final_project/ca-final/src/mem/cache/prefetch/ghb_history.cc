@@ -25,7 +25,6 @@ GHBHistory::GHBHistory(unsigned history_size, unsigned pattern_length,
       confidenceThreshold(std::min(100u, confidence_threshold)),
       history(historySize),
       head(0),
-      filled(false),
       sequenceCounter(1)
 {
 }
@@ -44,31 +43,20 @@ GHBHistory::reset()
         map.clear();
     }
     head = 0;
-    filled = false;
     sequenceCounter = 1;
     patternTable.clear();
 }
 
 void
-GHBHistory::evictIndex(int32_t slot)
+GHBHistory::pruneIndex(size_t key_idx)
 {
-    removeIndexMappings(slot);
-}
-
-void
-GHBHistory::removeIndexMappings(int32_t slot)
-{
-    GHBEntry &victim = history[slot];
-    for (size_t i = 0; i < NumCorrelationKeys; ++i) {
-        if (!victim.links[i].keyValid) {
-            continue;
-        }
-        auto &indexMap = lastIndex[i];
-        auto it = indexMap.find(victim.links[i].keyValue);
-        if (it != indexMap.end() && it->second == slot) {
-            indexMap.erase(it);
+    auto &indexMap = lastIndex[key_idx];
+    for (auto it = indexMap.begin(); it != indexMap.end(); ) {
+        if (history[it->second.slot].seq != it->second.seq) {
+            it = indexMap.erase(it);
+        } else {
+            ++it;
         }
-        victim.links[i].keyValid = false;
     }
 }
 
@@ -80,16 +68,24 @@ GHBHistory::assignCorrelation(GHBEntry &entry, int32_t slot,
     auto &link = entry.links[idx];
     link.prev = -1;
     link.prevSeq = 0;
-    link.keyValid = true;
-    link.keyValue = value;
 
     auto &indexMap = lastIndex[idx];
     auto it = indexMap.find(value);
-    if (it != indexMap.end()) {
-        link.prev = it->second;
-        link.prevSeq = history[it->second].seq;
+    if (it != indexMap.end() &&
+        history[it->second.slot].seq == it->second.seq) {
+        // The referenced entry has not been recycled since it was
+        // indexed, so the chain through it is still valid.
+        link.prev = it->second.slot;
+        link.prevSeq = it->second.seq;
+    }
+    indexMap[value] = {slot, entry.seq};
+
+    // Age out stale references instead of unlinking on eviction; the
+    // index can hold at most one live reference per history entry, so
+    // anything beyond 2x the history size is guaranteed dead weight.
+    if (indexMap.size() > 2 * historySize) {
+        pruneIndex(idx);
     }
-    indexMap[value] = slot;
 }
 
 int32_t
@@ -99,10 +95,6 @@ GHBHistory::insert(const AccessInfo &access)
         return -1;
     }
 
-    if (filled) {
-        evictIndex(head);
-    }
-
     const int32_t slot = head;
     GHBEntry &entry = history[slot];
     entry.addr = access.addr;
@@ -119,9 +111,6 @@ GHBHistory::insert(const AccessInfo &access)
                       computePage(access.addr));
 
     head = (head + 1) % historySize;
-    if (head == 0) {
-        filled = true;
-    }
     return slot;
 }
 
@@ -56,8 +56,6 @@ class GHBHistory
     {
         int32_t prev = -1;
         uint64_t prevSeq = 0;
-        uint64_t keyValue = 0;
-        bool keyValid = false;
     };
 
     struct GHBEntry
@@ -100,16 +98,28 @@ class GHBHistory
     unsigned pageBytes;
     unsigned confidenceThreshold;
 
+    /**
+     * Epoch-validated index entry: the slot is only trusted if the
+     * entry it points at still carries the recorded sequence number.
+     * Evicted history entries therefore never need to be unlinked
+     * from the index; stale references age out via pruneIndex().
+     */
+    struct IndexRef
+    {
+        int32_t slot = -1;
+        uint64_t seq = 0;
+    };
+
     std::vector<GHBEntry> history;
-    std::array<std::unordered_map<uint64_t, int32_t>, NumCorrelationKeys>
+    std::array<std::unordered_map<uint64_t, IndexRef>, NumCorrelationKeys>
         lastIndex;
     int32_t head;
-    bool filled;
     uint64_t sequenceCounter;
     std::unordered_map<DeltaPair, PatternEntry, DeltaPairHash> patternTable;
 
-    void evictIndex(int32_t slot);
-    void removeIndexMappings(int32_t slot);
+    /** Drop index entries whose history slot has been recycled. */
+    void pruneIndex(size_t key_idx);
+
     void assignCorrelation(GHBEntry &entry, int32_t slot,
                            CorrelationKey key, uint64_t value);
     uint64_t computePage(Addr addr) const { return addr / pageBytes; }
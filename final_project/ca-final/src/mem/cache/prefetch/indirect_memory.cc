@@ -55,10 +55,30 @@ IndirectMemory::IndirectMemory(const IndirectMemoryPrefetcherParams &p)
         p.ipd_table_indexing_policy,
         IndirectPatternDetectorEntry(p.addr_array_len, shiftValues.size(),
             genTagExtractor(p.ipd_table_indexing_policy))),
-    ipdEntryTrackingMisses(nullptr), byteOrder(p.sys->getGuestByteOrder())
+    ipdEntryTrackingMisses(nullptr),
+    byteOrder(p.sys->getGuestByteOrder()),
+    stats(this)
 {
 }
 
+IndirectMemory::IndirectMemoryStats::IndirectMemoryStats(
+        statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(streamPrefetches, statistics::units::Count::get(),
+               "Prefetches issued by the streaming detector"),
+      ADD_STAT(indirectPrefetches, statistics::units::Count::get(),
+               "Prefetches issued down indirect chains"),
+      ADD_STAT(indirectMatches, statistics::units::Count::get(),
+               "Accesses matching a tracked indirect pattern"),
+      ADD_STAT(indirectMatchesPerPC, statistics::units::Count::get(),
+               "Indirect pattern matches per index-load PC (one entry "
+               "per chain level)")
+{
+    indirectMatchesPerPC
+        .init(0)
+        .flags(statistics::nozero);
+}
+
 void
 IndirectMemory::calculatePrefetch(const PrefetchInfo &pfi,
     std::vector<AddrPriority> &addresses,
@@ -98,6 +118,7 @@ IndirectMemory::calculatePrefetch(const PrefetchInfo &pfi,
                     int64_t delta = addr - pt_entry->address;
                     for (unsigned int i = 1; i <= streamingDistance; i += 1) {
                         addresses.push_back(AddrPriority(addr + delta * i, 0));
+                        stats.streamPrefetches++;
                     }
                 }
                 pt_entry->address = addr;
@@ -149,10 +170,18 @@ IndirectMemory::calculatePrefetch(const PrefetchInfo &pfi,
                         if (pt_entry->indirectCounter > prefetchThreshold) {
                             unsigned distance = maxPrefetchDistance *
                                 pt_entry->indirectCounter.calcSaturation();
-                            for (int delta = 1; delta < distance; delta += 1) {
+                            // Prefetch the chain ahead of the current
+                            // index. Issuing the same target for every
+                            // delta (as this loop used to) made deep
+                            // pointer-chase streams report near-zero
+                            // coverage.
+                            for (int delta = 1; delta < distance;
+                                 delta += 1) {
                                 Addr pf_addr = pt_entry->baseAddr +
-                                    (pt_entry->index << pt_entry->shift);
+                                    ((pt_entry->index + delta) <<
+                                     pt_entry->shift);
                                 addresses.push_back(AddrPriority(pf_addr, 0));
+                                stats.indirectPrefetches++;
                             }
                         }
                     }
@@ -164,6 +193,7 @@ IndirectMemory::calculatePrefetch(const PrefetchInfo &pfi,
             prefetchTable.insertEntry(key, pt_entry);
             pt_entry->address = addr;
             pt_entry->secure = is_secure;
+            pt_entry->trackedPC = pc;
         }
     }
 }
@@ -259,6 +289,8 @@ IndirectMemory::checkAccessMatchOnActiveEntries(Addr addr)
                        (pt_entry.index << pt_entry.shift)) {
                 pt_entry.indirectCounter++;
                 pt_entry.increasedIndirectCounter = true;
+                stats.indirectMatches++;
+                stats.indirectMatchesPerPC.sample(pt_entry.trackedPC, 1);
             }
         }
     }
@@ -83,6 +83,9 @@ class IndirectMemory : public Queued
 
         /** Enable bit of the indirect fields */
         bool enabled;
+
+        /** PC of the index loads feeding this entry (chain level id) */
+        Addr trackedPC;
         /** Current index value */
         int64_t index;
         /** BaseAddr detected */
@@ -101,7 +104,8 @@ class IndirectMemory : public Queued
 
         PrefetchTableEntry(unsigned indirect_counter_bits, TagExtractor ext)
             : TaggedEntry(), address(0), secure(false), streamCounter(0),
-              enabled(false), index(0), baseAddr(0), shift(0),
+              enabled(false), trackedPC(0), index(0), baseAddr(0),
+              shift(0),
               indirectCounter(indirect_counter_bits),
               increasedIndirectCounter(false)
         {
@@ -116,6 +120,7 @@ class IndirectMemory : public Queued
             secure = false;
             streamCounter = 0;
             enabled = false;
+            trackedPC = 0;
             index = 0;
             baseAddr = 0;
             shift = 0;
@@ -205,6 +210,17 @@ class IndirectMemory : public Queued
     IndirectMemory(const IndirectMemoryPrefetcherParams &p);
     ~IndirectMemory() = default;
 
+    /** Visibility into chain behavior, per index-load PC. */
+    struct IndirectMemoryStats : public statistics::Group
+    {
+        IndirectMemoryStats(statistics::Group *parent);
+        statistics::Scalar streamPrefetches;
+        statistics::Scalar indirectPrefetches;
+        statistics::Scalar indirectMatches;
+        statistics::SparseHistogram indirectMatchesPerPC;
+    } stats;
+
+  public:
     void calculatePrefetch(const PrefetchInfo &pfi,
                            std::vector<AddrPriority> &addresses,
                            const CacheAccessor &cache) override;
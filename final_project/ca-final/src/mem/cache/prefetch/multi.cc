@@ -37,6 +37,9 @@
 
 #include "mem/cache/prefetch/multi.hh"
 
+#include <algorithm>
+
+#include "debug/HWPrefetch.hh"
 #include "params/MultiPrefetcher.hh"
 
 namespace gem5
@@ -48,8 +51,54 @@ namespace prefetch
 Multi::Multi(const MultiPrefetcherParams &p)
   : Base(p),
     prefetchers(p.prefetchers.begin(), p.prefetchers.end()),
-    lastChosenPf(0)
+    lastChosenPf(0),
+    arbitrate(p.arbitrate),
+    evalPeriod(p.eval_period),
+    throttleThreshold(p.throttle_threshold),
+    scores(prefetchers.size()),
+    issuedThisEpoch(0)
+{
+}
+
+void
+Multi::evaluateScores()
 {
+    for (size_t i = 0; i < prefetchers.size(); i++) {
+        const uint64_t issued = prefetchers[i]->getIssuedPrefetches();
+        const uint64_t useful = prefetchers[i]->getUsefulPrefetches();
+        const uint64_t epoch_issued = issued - scores[i].lastIssued;
+        const uint64_t epoch_useful = useful - scores[i].lastUseful;
+
+        // A child that issued nothing this epoch keeps its chance;
+        // everyone else must clear the accuracy bar.
+        scores[i].throttled = epoch_issued > 0 &&
+            ((double)epoch_useful / epoch_issued) < throttleThreshold;
+
+        scores[i].lastIssued = issued;
+        scores[i].lastUseful = useful;
+
+        DPRINTF(HWPrefetch, "%s: epoch accuracy %d/%d, %sthrottled\n",
+                prefetchers[i]->name(), epoch_useful, epoch_issued,
+                scores[i].throttled ? "" : "not ");
+    }
+
+    // Never throttle everyone: keep the best performer issuing so the
+    // engine cannot wedge itself with no un-throttling opportunity.
+    if (std::all_of(scores.begin(), scores.end(),
+                    [](const ChildScore &s) { return s.throttled; })) {
+        size_t best = 0;
+        double best_acc = -1.0;
+        for (size_t i = 0; i < scores.size(); i++) {
+            const double acc =
+                (double)(scores[i].lastUseful) /
+                std::max<uint64_t>(1, scores[i].lastIssued);
+            if (acc > best_acc) {
+                best_acc = acc;
+                best = i;
+            }
+        }
+        scores[best].throttled = false;
+    }
 }
 
 void
@@ -64,8 +113,12 @@ Multi::nextPrefetchReadyTime() const
 {
     Tick next_ready = MaxTick;
 
-    for (auto pf : prefetchers)
-        next_ready = std::min(next_ready, pf->nextPrefetchReadyTime());
+    for (size_t i = 0; i < prefetchers.size(); i++) {
+        if (arbitrate && scores[i].throttled)
+            continue;
+        next_ready = std::min(next_ready,
+                              prefetchers[i]->nextPrefetchReadyTime());
+    }
 
     return next_ready;
 }
@@ -73,15 +126,22 @@ Multi::nextPrefetchReadyTime() const
 PacketPtr
 Multi::getPacket()
 {
+    if (arbitrate && issuedThisEpoch >= evalPeriod) {
+        evaluateScores();
+        issuedThisEpoch = 0;
+    }
+
     lastChosenPf = (lastChosenPf + 1) % prefetchers.size();
     uint8_t pf_turn = lastChosenPf;
 
     for (int pf = 0 ;  pf < prefetchers.size(); pf++) {
-        if (prefetchers[pf_turn]->nextPrefetchReadyTime() <= curTick()) {
+        if ((!arbitrate || !scores[pf_turn].throttled) &&
+            prefetchers[pf_turn]->nextPrefetchReadyTime() <= curTick()) {
             PacketPtr pkt = prefetchers[pf_turn]->getPacket();
             panic_if(!pkt, "Prefetcher is ready but didn't return a packet.");
             prefetchStats.pfIssued++;
             issuedPrefetches++;
+            issuedThisEpoch++;
             return pkt;
         }
         pf_turn = (pf_turn + 1) % prefetchers.size();
@@ -74,9 +74,34 @@ class Multi : public Base
     /** @} */
 
   protected:
+    /** Re-score the children and update throttling decisions. */
+    void evaluateScores();
+
     /** List of sub-prefetchers ordered by priority. */
     std::vector<Base*> prefetchers;
     uint8_t lastChosenPf;
+
+    /**
+     * Runtime arbitration state. When arbitration is enabled the
+     * children are scored every evalPeriod issued prefetches by the
+     * accuracy they achieved over the epoch (useful / issued, from
+     * their own feedback counters), and children below the throttle
+     * threshold are not asked for packets until they recover in a
+     * later epoch. Children that issued nothing are left unthrottled
+     * so they can prove themselves.
+     */
+    const bool arbitrate;
+    const uint64_t evalPeriod;
+    const double throttleThreshold;
+
+    struct ChildScore
+    {
+        uint64_t lastIssued = 0;
+        uint64_t lastUseful = 0;
+        bool throttled = false;
+    };
+    std::vector<ChildScore> scores;
+    uint64_t issuedThisEpoch;
 };
 
 } // namespace prefetch
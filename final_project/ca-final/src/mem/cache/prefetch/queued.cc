@@ -37,6 +37,7 @@
 
 #include "mem/cache/prefetch/queued.hh"
 
+#include <algorithm>
 #include <cassert>
 
 #include "arch/generic/tlb.hh"
@@ -60,7 +61,7 @@ Queued::DeferredPacket::createPkt(Addr paddr, unsigned blk_size,
                                             bool tag_prefetch,
                                             Tick t) {
     /* Create a prefetch memory request */
-    RequestPtr req = std::make_shared<Request>(paddr, blk_size,
+    RequestPtr req = Request::make(paddr, blk_size,
                                                 0, requestor_id);
 
     if (pfInfo.isSecure()) {
@@ -104,7 +105,13 @@ Queued::Queued(const QueuedPrefetcherParams &p)
       latency(p.latency), queueSquash(p.queue_squash),
       queueFilter(p.queue_filter), cacheSnoop(p.cache_snoop),
       tagPrefetch(p.tag_prefetch),
-      throttleControlPct(p.throttle_control_percentage), statsQueued(this)
+      throttleControlPct(p.throttle_control_percentage),
+      adaptiveThrottle(p.adaptive_throttle),
+      throttleEpoch(p.throttle_epoch),
+      mshrHighWatermarkPct(p.mshr_high_watermark_pct),
+      mshrLowWatermarkPct(p.mshr_low_watermark_pct),
+      effectiveThrottlePct(p.throttle_control_percentage),
+      statsQueued(this)
 {
 }
 
@@ -159,7 +166,7 @@ Queued::getMaxPermittedPrefetches(size_t total) const
 
     size_t max_pfs = total;
     if (total > 0 && issuedPrefetches > 0) {
-        size_t throttle_pfs = (total * throttleControlPct) / 100;
+        size_t throttle_pfs = (total * effectiveThrottlePct) / 100;
         size_t min_pfs = (total - throttle_pfs) == 0 ?
             1 : (total - throttle_pfs);
         max_pfs = min_pfs + (total - min_pfs) *
@@ -176,6 +183,30 @@ Queued::notify(const CacheAccessProbeArg &acc, const PrefetchInfo &pfi)
     const PacketPtr pkt = acc.pkt;
     const CacheAccessor &cache = acc.cache;
 
+    if (adaptiveThrottle) {
+        // Epoch-average the MSHR pressure the cache reports and adapt
+        // the effective throttle percentage: back off while demand
+        // misses queue for MSHRs, recover toward the configured base
+        // when pressure is low.
+        occupancySum += cache.mshrOccupancyPct();
+        if (++occupancySamples >= throttleEpoch) {
+            const unsigned avg_occupancy = occupancySum / occupancySamples;
+            if (avg_occupancy >= mshrHighWatermarkPct) {
+                effectiveThrottlePct =
+                    std::min(100u, effectiveThrottlePct + 10);
+            } else if (avg_occupancy <= mshrLowWatermarkPct) {
+                effectiveThrottlePct = std::max(throttleControlPct,
+                        effectiveThrottlePct > 10 ?
+                        effectiveThrottlePct - 10 : 0);
+            }
+            DPRINTF(HWPrefetch, "Adaptive throttle: avg MSHR occupancy "
+                    "%d%%, effective throttle %d%%\n", avg_occupancy,
+                    effectiveThrottlePct);
+            occupancySum = 0;
+            occupancySamples = 0;
+        }
+    }
+
     // Squash queued prefetches if demand miss to same line
     if (queueSquash) {
         auto itr = pfq.begin();
@@ -187,6 +218,7 @@ Queued::notify(const CacheAccessProbeArg &acc, const PrefetchInfo &pfi)
                         itr->pfInfo.getAddr(),
                         blockAddress(itr->pfInfo.getAddr()));
                 delete itr->pkt;
+                untrackQueued(itr->pfInfo);
                 itr = pfq.erase(itr);
                 statsQueued.pfRemovedDemand++;
             } else {
@@ -252,6 +284,7 @@ Queued::getPacket()
     }
 
     PacketPtr pkt = pfq.front().pkt;
+    untrackQueued(pfq.front().pfInfo);
     pfq.pop_front();
 
     prefetchStats.pfIssued++;
@@ -335,6 +368,7 @@ Queued::translationComplete(DeferredPacket *dp, bool failed,
                 "prefetch request %#x \n", mmu->name(),
                 it->translationRequest->getVaddr());
     }
+    untrackQueued(it->pfInfo);
     pfqMissingTranslation.erase(it);
 }
 
@@ -342,6 +376,12 @@ bool
 Queued::alreadyInQueue(std::list<DeferredPacket> &queue,
                                  const PrefetchInfo &pfi, int32_t priority)
 {
+    /* O(1) reject for the common no-duplicate case; the precise scan
+     * below only runs when some queue holds this address */
+    if (queuedLines.find(queuedKey(pfi)) == queuedLines.end()) {
+        return false;
+    }
+
     bool found = false;
     iterator it;
     for (it = queue.begin(); it != queue.end() && !found; it++) {
@@ -377,7 +417,7 @@ RequestPtr
 Queued::createPrefetchRequest(Addr addr, PrefetchInfo const &pfi,
                                         PacketPtr pkt)
 {
-    RequestPtr translation_req = std::make_shared<Request>(
+    RequestPtr translation_req = Request::make(
             addr, blkSize, pkt->req->getFlags(), requestorId, pfi.getPC(),
             pkt->req->contextId());
     translation_req->setFlags(Request::PREFETCH);
@@ -512,9 +552,12 @@ Queued::addToQueue(std::list<DeferredPacket> &queue,
         DPRINTF(HWPrefetch, "Prefetch queue full, removing lowest priority "
                             "oldest packet, addr: %#x\n",it->pfInfo.getAddr());
         delete it->pkt;
+        untrackQueued(it->pfInfo);
         queue.erase(it);
     }
 
+    trackQueued(dpp.pfInfo);
+
     if ((queue.size() == 0) || (dpp <= queue.back())) {
         queue.emplace_back(dpp);
     } else {
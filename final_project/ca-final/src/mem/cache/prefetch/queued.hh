@@ -40,6 +40,7 @@
 
 #include <cstdint>
 #include <list>
+#include <unordered_map>
 #include <utility>
 
 #include "arch/generic/mmu.hh"
@@ -142,6 +143,35 @@ class Queued : public Base
     };
 
     std::list<DeferredPacket> pfq;
+
+    /**
+     * Reference counts of the addresses queued in pfq and
+     * pfqMissingTranslation, so duplicate checks are O(1) instead of
+     * scanning both queues per candidate. The key folds the secure
+     * bit into bit 0 of the prefetch address.
+     */
+    std::unordered_map<Addr, uint8_t> queuedLines;
+
+    static Addr
+    queuedKey(const PrefetchInfo &pfi)
+    {
+        return (pfi.getAddr() << 1) | (pfi.isSecure() ? 1 : 0);
+    }
+
+    void
+    trackQueued(const PrefetchInfo &pfi)
+    {
+        queuedLines[queuedKey(pfi)]++;
+    }
+
+    void
+    untrackQueued(const PrefetchInfo &pfi)
+    {
+        auto it = queuedLines.find(queuedKey(pfi));
+        assert(it != queuedLines.end());
+        if (--it->second == 0)
+            queuedLines.erase(it);
+    }
     std::list<DeferredPacket> pfqMissingTranslation;
 
     using const_iterator = std::list<DeferredPacket>::const_iterator;
@@ -176,6 +206,21 @@ class Queued : public Base
     /** Percentage of requests that can be throttled */
     const unsigned int throttleControlPct;
 
+    /**
+     * Adaptive throttle state. When enabled, the MSHR occupancy
+     * reported by the cache accessor is averaged over an epoch of
+     * notifications and moves the effective throttle percentage
+     * between the configured base (throttleControlPct) and 100%, so
+     * prefetches back off while demand misses are queuing for MSHRs.
+     */
+    const bool adaptiveThrottle;
+    const unsigned throttleEpoch;
+    const unsigned mshrHighWatermarkPct;
+    const unsigned mshrLowWatermarkPct;
+    unsigned effectiveThrottlePct;
+    uint64_t occupancySum = 0;
+    unsigned occupancySamples = 0;
+
     struct QueuedStats : public statistics::Group
     {
         QueuedStats(statistics::Group *parent);
@@ -45,8 +45,9 @@ SignaturePath::SignaturePath(const SignaturePathPrefetcherParams &p)
       stridesPerPatternEntry(p.strides_per_pattern_entry),
       signatureShift(p.signature_shift),
       signatureBits(p.signature_bits),
-      prefetchConfidenceThreshold(p.prefetch_confidence_threshold),
-      lookaheadConfidenceThreshold(p.lookahead_confidence_threshold),
+      prefetchConfidenceThreshold(toConf(p.prefetch_confidence_threshold)),
+      lookaheadConfidenceThreshold(
+          toConf(p.lookahead_confidence_threshold)),
       signatureTable((name() + ".SignatureTable").c_str(),
           p.signature_table_entries,
           p.signature_table_assoc,
@@ -61,14 +62,22 @@ SignaturePath::SignaturePath(const SignaturePathPrefetcherParams &p)
           PatternEntry(stridesPerPatternEntry, p.num_counter_bits,
                        genTagExtractor(p.pattern_table_indexing_policy)))
 {
-    fatal_if(prefetchConfidenceThreshold < 0,
+    fatal_if(p.prefetch_confidence_threshold < 0,
         "The prefetch confidence threshold must be greater than 0\n");
-    fatal_if(prefetchConfidenceThreshold > 1,
+    fatal_if(p.prefetch_confidence_threshold > 1,
         "The prefetch confidence threshold must be less than 1\n");
-    fatal_if(lookaheadConfidenceThreshold < 0,
+    fatal_if(p.lookahead_confidence_threshold < 0,
         "The lookahead confidence threshold must be greater than 0\n");
-    fatal_if(lookaheadConfidenceThreshold > 1,
+    fatal_if(p.lookahead_confidence_threshold > 1,
         "The lookahead confidence threshold must be less than 1\n");
+
+    // one saturation value per possible stride counter value
+    const unsigned counter_max = (1 << p.num_counter_bits) - 1;
+    satConfLUT.resize(counter_max + 1);
+    for (unsigned value = 0; value <= counter_max; value++) {
+        satConfLUT[value] =
+            (conf_t)(((uint64_t)value << ConfShift) / counter_max);
+    }
 }
 
 SignaturePath::PatternStrideEntry &
@@ -100,7 +109,7 @@ SignaturePath::PatternEntry::getStrideEntry(stride_t stride)
 
 void
 SignaturePath::addPrefetch(Addr ppn, stride_t last_block,
-    stride_t delta, double path_confidence, signature_t signature,
+    stride_t delta, conf_t path_confidence, signature_t signature,
     bool is_secure, std::vector<AddrPriority> &addresses)
 {
     stride_t block = last_block + delta;
@@ -141,10 +150,10 @@ SignaturePath::addPrefetch(Addr ppn, stride_t last_block,
 
 void
 SignaturePath::handleSignatureTableMiss(stride_t current_block,
-    signature_t &new_signature, double &new_conf, stride_t &new_stride)
+    signature_t &new_signature, conf_t &new_conf, stride_t &new_stride)
 {
     new_signature = current_block;
-    new_conf = 1.0;
+    new_conf = ConfOne;
     new_stride = current_block;
 }
 
@@ -168,7 +177,7 @@ SignaturePath::updatePatternTable(Addr signature, stride_t stride)
 SignaturePath::SignatureEntry &
 SignaturePath::getSignatureEntry(Addr ppn, bool is_secure,
         stride_t block, bool &miss, stride_t &stride,
-        double &initial_confidence)
+        conf_t &initial_confidence)
 {
     const SignatureEntry::KeyType key{ppn, is_secure};
     SignatureEntry* signature_entry = signatureTable.findEntry(key);
@@ -209,25 +218,26 @@ SignaturePath::getPatternEntry(Addr signature)
     return *pattern_entry;
 }
 
-double
+SignaturePath::conf_t
 SignaturePath::calculatePrefetchConfidence(PatternEntry const &sig,
         PatternStrideEntry const &entry) const
 {
-    return entry.counter.calcSaturation();
+    return satConfLUT[entry.counter];
 }
 
-double
+SignaturePath::conf_t
 SignaturePath::calculateLookaheadConfidence(PatternEntry const &sig,
         PatternStrideEntry const &lookahead) const
 {
-    double lookahead_confidence = lookahead.counter.calcSaturation();
-    if (lookahead_confidence > 0.95) {
-        /**
-         * maximum confidence is 0.95, guaranteeing that
-         * current confidence will eventually fall beyond
-         * the threshold
-         */
-        lookahead_confidence = 0.95;
+    conf_t lookahead_confidence = satConfLUT[lookahead.counter];
+    /**
+     * maximum confidence is 0.95, guaranteeing that
+     * current confidence will eventually fall beyond
+     * the threshold
+     */
+    const conf_t max_confidence = toConf(0.95);
+    if (lookahead_confidence > max_confidence) {
+        lookahead_confidence = max_confidence;
     }
     return lookahead_confidence;
 }
@@ -242,7 +252,7 @@ SignaturePath::calculatePrefetch(const PrefetchInfo &pfi,
     stride_t current_block = (request_addr % pageBytes) / blkSize;
     stride_t stride;
     bool is_secure = pfi.isSecure();
-    double initial_confidence = 1.0;
+    conf_t initial_confidence = ConfOne;
 
     // Get the SignatureEntry of this page to:
     // - compute the current stride
@@ -269,7 +279,7 @@ SignaturePath::calculatePrefetch(const PrefetchInfo &pfi,
         updateSignature(signature_entry.signature, stride);
 
     signature_t current_signature = signature_entry.signature;
-    double current_confidence = initial_confidence;
+    conf_t current_confidence = initial_confidence;
     stride_t current_stride = signature_entry.lastBlock;
 
     // Look for prefetch candidates while the current path confidence is
@@ -290,7 +300,7 @@ SignaturePath::calculatePrefetch(const PrefetchInfo &pfi,
                     max_counter = entry.counter;
                     lookahead = &entry;
                 }
-                double prefetch_confidence =
+                conf_t prefetch_confidence =
                     calculatePrefetchConfidence(*current_pattern_entry, entry);
 
                 if (prefetch_confidence >= prefetchConfidenceThreshold) {
@@ -304,8 +314,10 @@ SignaturePath::calculatePrefetch(const PrefetchInfo &pfi,
         }
 
         if (lookahead != nullptr) {
-            current_confidence *= calculateLookaheadConfidence(
-                    *current_pattern_entry, *lookahead);
+            current_confidence = (conf_t)(
+                ((uint64_t)current_confidence *
+                 calculateLookaheadConfidence(
+                     *current_pattern_entry, *lookahead)) >> ConfShift);
             current_signature =
                 updateSignature(current_signature, lookahead->stride);
             current_stride += lookahead->stride;
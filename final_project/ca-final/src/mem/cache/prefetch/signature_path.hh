@@ -68,10 +68,29 @@ class SignaturePath : public Queued
     const uint8_t signatureShift;
     /** Size of the signature, in bits */
     const signature_t signatureBits;
+    /**
+     * Fixed-point confidence type: probabilities in [0,1] scaled by
+     * (1 << ConfShift). Path-confidence propagation is then integer
+     * multiply-and-shift instead of double-precision math per
+     * lookahead level.
+     */
+    typedef uint32_t conf_t;
+    static constexpr unsigned ConfShift = 16;
+    static constexpr conf_t ConfOne = 1u << ConfShift;
+
+    static conf_t
+    toConf(double value)
+    {
+        return (conf_t)(value * ConfOne);
+    }
+
     /** Minimum confidence to issue a prefetch */
-    const double prefetchConfidenceThreshold;
+    const conf_t prefetchConfidenceThreshold;
     /** Minimum confidence to keep navigating lookahead entries */
-    const double lookaheadConfidenceThreshold;
+    const conf_t lookaheadConfidenceThreshold;
+
+    /** Precomputed saturation of each stride counter value. */
+    std::vector<conf_t> satConfLUT;
 
     /** Signature entry data type */
     struct SignatureEntry : public TaggedEntry
@@ -184,7 +203,7 @@ class SignaturePath : public Queued
      * @param addresses addresses to prefetch will be added to this vector
      */
     void addPrefetch(Addr ppn, stride_t last_block, stride_t delta,
-                          double path_confidence, signature_t signature,
+                          conf_t path_confidence, signature_t signature,
                           bool is_secure,
                           std::vector<AddrPriority> &addresses);
 
@@ -202,7 +221,7 @@ class SignaturePath : public Queued
      * @result a reference to the SignatureEntry
      */
     SignatureEntry &getSignatureEntry(Addr ppn, bool is_secure, stride_t block,
-            bool &miss, stride_t &stride, double &initial_confidence);
+            bool &miss, stride_t &stride, conf_t &initial_confidence);
     /**
      * Obtains the PatternEntry of the given signature, if the signature is
      * not found, it allocates a new one, replacing an existing entry if needed
@@ -225,7 +244,7 @@ class SignaturePath : public Queued
      * @param lookahead PatternStrideEntry within the provided PatternEntry
      * @return the computed confidence factor
      */
-    virtual double calculateLookaheadConfidence(PatternEntry const &sig,
+    virtual conf_t calculateLookaheadConfidence(PatternEntry const &sig,
             PatternStrideEntry const &lookahead) const;
 
     /**
@@ -234,7 +253,7 @@ class SignaturePath : public Queued
      * @param entry PatternStrideEntry within the provided PatternEntry
      * @return the computed confidence factor
      */
-    virtual double calculatePrefetchConfidence(PatternEntry const &sig,
+    virtual conf_t calculatePrefetchConfidence(PatternEntry const &sig,
             PatternStrideEntry const &entry) const;
 
     /**
@@ -256,7 +275,7 @@ class SignaturePath : public Queued
      * @param new_stride the resulting current stride
      */
     virtual void handleSignatureTableMiss(stride_t current_block,
-            signature_t &new_signature, double &new_conf,
+            signature_t &new_signature, conf_t &new_conf,
             stride_t &new_stride);
 
     /**
@@ -286,7 +305,7 @@ class SignaturePath : public Queued
      * @param path_confidence the path confidence at the moment of crossing
      */
     virtual void handlePageCrossingLookahead(signature_t signature,
-            stride_t last_offset, stride_t delta, double path_confidence) {
+            stride_t last_offset, stride_t delta, conf_t path_confidence) {
     }
 
   public:
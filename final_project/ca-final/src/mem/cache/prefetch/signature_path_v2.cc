@@ -65,7 +65,7 @@ SignaturePathV2::SignaturePathV2(const SignaturePathPrefetcherV2Params &p)
 
 void
 SignaturePathV2::handleSignatureTableMiss(stride_t current_block,
-    signature_t &new_signature, double &new_conf, stride_t &new_stride)
+    signature_t &new_signature, conf_t &new_conf, stride_t &new_stride)
 {
     bool found = false;
 
@@ -83,26 +83,29 @@ SignaturePathV2::handleSignatureTableMiss(stride_t current_block,
     }
     if (!found) {
         new_signature = current_block;
-        new_conf = 1.0;
+        new_conf = ConfOne;
         new_stride = current_block;
     }
 }
 
-double
+SignaturePathV2::conf_t
 SignaturePathV2::calculateLookaheadConfidence(
         PatternEntry const &sig, PatternStrideEntry const &lookahead) const
 {
-    if (sig.counter == 0) return 0.0;
-    return (((double) usefulPrefetches) / issuedPrefetches) *
-            (((double) lookahead.counter) / sig.counter);
+    if (sig.counter == 0 || issuedPrefetches == 0) return 0;
+    const conf_t global_accuracy = (conf_t)(
+            ((uint64_t)usefulPrefetches << ConfShift) / issuedPrefetches);
+    const conf_t local = (conf_t)(
+            ((uint64_t)lookahead.counter << ConfShift) / sig.counter);
+    return (conf_t)(((uint64_t)global_accuracy * local) >> ConfShift);
 }
 
-double
+SignaturePathV2::conf_t
 SignaturePathV2::calculatePrefetchConfidence(PatternEntry const &sig,
         PatternStrideEntry const &entry) const
 {
-    if (sig.counter == 0) return 0.0;
-    return ((double) entry.counter) / sig.counter;
+    if (sig.counter == 0) return 0;
+    return (conf_t)(((uint64_t)entry.counter << ConfShift) / sig.counter);
 }
 
 void
@@ -127,7 +130,7 @@ SignaturePathV2::increasePatternEntryCounter(
 
 void
 SignaturePathV2::handlePageCrossingLookahead(signature_t signature,
-            stride_t last_offset, stride_t delta, double path_confidence)
+            stride_t last_offset, stride_t delta, conf_t path_confidence)
 {
     // Always use the replacement policy to assign new entries, as all
     // of them are unique, there are never "hits" in the GHR
@@ -59,11 +59,11 @@ class SignaturePathV2 : public SignaturePath
     struct GlobalHistoryEntry : public TaggedEntry
     {
         signature_t signature;
-        double confidence;
+        conf_t confidence;
         stride_t lastBlock;
         stride_t delta;
         GlobalHistoryEntry(TagExtractor ext)
-          : TaggedEntry(), signature(0), confidence(0.0), lastBlock(0),
+          : TaggedEntry(), signature(0), confidence(0), lastBlock(0),
             delta(0)
         {
             registerTagExtractor(ext);
@@ -72,17 +72,17 @@ class SignaturePathV2 : public SignaturePath
     /** Global History Register */
     AssociativeCache<GlobalHistoryEntry> globalHistoryRegister;
 
-    double calculateLookaheadConfidence(PatternEntry const &sig,
+    conf_t calculateLookaheadConfidence(PatternEntry const &sig,
             PatternStrideEntry const &lookahead) const override;
 
-    double calculatePrefetchConfidence(PatternEntry const &sig,
+    conf_t calculatePrefetchConfidence(PatternEntry const &sig,
             PatternStrideEntry const &lookahead) const override;
 
     void increasePatternEntryCounter(PatternEntry &pattern_entry,
             PatternStrideEntry &pstride_entry) override;
 
     void handleSignatureTableMiss(stride_t current_block,
-            signature_t &new_signature, double &new_conf,
+            signature_t &new_signature, conf_t &new_conf,
             stride_t &new_stride) override;
 
     /**
@@ -94,7 +94,7 @@ class SignaturePathV2 : public SignaturePath
     {}
 
     virtual void handlePageCrossingLookahead(signature_t signature,
-            stride_t last_offset, stride_t delta, double path_confidence)
+            stride_t last_offset, stride_t delta, conf_t path_confidence)
             override;
 
   public:
@@ -42,9 +42,22 @@ namespace gem5
 namespace prefetch
 {
 
+Sms::SmsStats::SmsStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(ftReplacements, statistics::units::Count::get(),
+               "Filter table entries evicted for capacity"),
+      ADD_STAT(agtReplacements, statistics::units::Count::get(),
+               "Active generations evicted for capacity"),
+      ADD_STAT(phtReplacements, statistics::units::Count::get(),
+               "Pattern history entries evicted for capacity"),
+      ADD_STAT(generationsCommitted, statistics::units::Count::get(),
+               "Generations committed from the AGT into the PHT")
+{
+}
+
 Sms::Sms(const SmsPrefetcherParams &p)
     : Queued(p), Max_Contexts(p.ft_size), MAX_PHTSize(p.pht_size),
-      Region_Size(p.region_size)
+      Region_Size(p.region_size), stats(this)
 {
     AGT.clear();
     AGTPC.clear();
@@ -60,22 +73,36 @@ Sms::notifyEvict(const EvictionInfo &info)
 {
     //Check if any active generation has ended
     Addr region_base = roundDown(info.addr, Region_Size);
-    std::pair <Addr,Addr> pc_offset = AGTPC[region_base];
-    if (AGT.find(region_base) != AGT.end()) {
-        //remove old recording
-        if (PHT.find(pc_offset) != PHT.end()) {
-            PHT[pc_offset].clear();
-        }
-        //Move from AGT to PHT
-        for (std::set<Addr>::iterator it = AGT[region_base].begin();
-         it != AGT[region_base].end(); it ++) {
-            PHT[pc_offset].insert(*it);
+    auto agt_it = AGT.find(region_base);
+    if (agt_it == AGT.end()) {
+        // Not a tracked region. The old AGTPC[region_base] lookup
+        // inserted a default entry for every eviction the cache ever
+        // saw, which is what ballooned host RSS on big footprints.
+        return;
+    }
+
+    auto pc_it = AGTPC.find(region_base);
+    if (pc_it != AGTPC.end()) {
+        const std::pair<Addr, Addr> pc_offset = pc_it->second;
+        //Move from AGT to PHT, replacing any old recording
+        std::set<Addr> &pattern = PHT[pc_offset];
+        pattern.clear();
+        pattern.insert(agt_it->second.begin(), agt_it->second.end());
+
+        //update LRU position without duplicating the entry
+        for (auto lit = lruPHT.begin(); lit != lruPHT.end(); ++lit) {
+            if ((*lit) == pc_offset) {
+                lruPHT.erase(lit);
+                break;
+            }
         }
         lruPHT.push_front(pc_offset);
+        stats.generationsCommitted++;
     }
 
     while (PHT.size() > MAX_PHTSize) {
-        PHT.erase(lruPHT.back());
+        if (PHT.erase(lruPHT.back()))
+            stats.phtReplacements++;
         lruPHT.pop_back();
     }
 
@@ -123,7 +150,9 @@ Sms::calculatePrefetch(const PrefetchInfo &pfi,
         FT.erase(region_base);
         //Make space for next entry
         while (AGT.size() > Max_Contexts) {
-            AGT.erase(lruAGT.back());
+            // stale LRU entries erase nothing and are not replacements
+            if (AGT.erase(lruAGT.back()))
+                stats.agtReplacements++;
             AGTPC.erase(lruAGT.back());
             lruAGT.pop_back();
         }
@@ -132,7 +161,8 @@ Sms::calculatePrefetch(const PrefetchInfo &pfi,
         FT[region_base] = std::make_pair (pc,offset);
         fifoFT.push_front(region_base);
         while (FT.size() > Max_Contexts) {
-            FT.erase(fifoFT.back());
+            if (FT.erase(fifoFT.back()))
+                stats.ftReplacements++;
             fifoFT.pop_back();
         }
     }
@@ -67,6 +67,20 @@ class Sms : public Queued
     using EvictionInfo = CacheDataUpdateProbeArg;
     void notifyEvict(const EvictionInfo &info) override;
 
+    /**
+     * Capacity visibility: replacements in each bounded table and
+     * committed generations, so sweeps can tell when table capacity
+     * rather than the algorithm limits coverage.
+     */
+    struct SmsStats : public statistics::Group
+    {
+        SmsStats(statistics::Group *parent);
+        statistics::Scalar ftReplacements;
+        statistics::Scalar agtReplacements;
+        statistics::Scalar phtReplacements;
+        statistics::Scalar generationsCommitted;
+    } stats;
+
   public:
     Sms(const SmsPrefetcherParams &p);
     ~Sms() = default;
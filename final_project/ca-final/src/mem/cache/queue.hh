@@ -122,6 +122,13 @@ class Queue : public Drainable, public Named
     /** The number of currently allocated entries. */
     int allocated;
 
+  public:
+    /** The number of entries currently allocated. */
+    int getAllocatedEntries() const { return allocated; }
+
+    /** The total number of entries, including the reserve. */
+    int getNumEntries() const { return numEntries; }
+
   public:
 
     /**
@@ -47,6 +47,7 @@
 #define __MEM_CACHE_QUEUE_ENTRY_HH__
 
 #include "base/named.hh"
+#include "base/pooled_allocator.hh"
 #include "base/types.hh"
 #include "mem/packet.hh"
 
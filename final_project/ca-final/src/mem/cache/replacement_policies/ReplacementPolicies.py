@@ -187,3 +187,9 @@ class MockingjayRP(BaseReplacementPolicy):
     enable_online_learning = Param.Bool(
         False, "Enable online learning from eviction feedback"
     )
+    share_tables = Param.Bool(
+        False,
+        "Share the predictor state (weights, eviction table, access "
+        "counter) across all MockingjayRP instances, e.g. the banks of "
+        "a banked LLC, instead of duplicating it per cache",
+    )
@@ -28,10 +28,12 @@
 
 #include "mem/cache/replacement_policies/brrip_rp.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
 #include "base/logging.hh" // For fatal_if
+#include "mem/packet.hh"
 #include "params/BRRIPRP.hh"
 
 namespace gem5
@@ -41,54 +43,75 @@ namespace replacement_policy
 {
 
 BRRIP::BRRIP(const Params &p)
-  : Base(p), numRRPVBits(p.num_bits), hitPriority(p.hit_priority),
-    btp(p.btp)
+  : Base(p), maxRRPV((1 << p.num_bits) - 1), numRRPVBits(p.num_bits),
+    hitPriority(p.hit_priority), btp(p.btp)
 {
     fatal_if(numRRPVBits <= 0, "There should be at least one bit per RRPV.\n");
+    fatal_if(numRRPVBits > 8, "RRPVs are stored in packed bytes.\n");
+}
+
+uint32_t
+BRRIP::allocateEntryIndex()
+{
+    rrpvs.push_back(maxRRPV);
+    valids.push_back(0);
+    return rrpvs.size() - 1;
 }
 
 void
 BRRIP::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
 {
-    std::shared_ptr<BRRIPReplData> casted_replacement_data =
-        std::static_pointer_cast<BRRIPReplData>(replacement_data);
-
     // Invalidate entry
-    casted_replacement_data->valid = false;
+    valids[std::static_pointer_cast<BRRIPReplData>(
+        replacement_data)->index] = 0;
 }
 
 void
 BRRIP::touch(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
-    std::shared_ptr<BRRIPReplData> casted_replacement_data =
-        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    uint8_t &rrpv = rrpvs[std::static_pointer_cast<BRRIPReplData>(
+        replacement_data)->index];
 
     // Update RRPV if not 0 yet
     // Every hit in HP mode makes the entry the last to be evicted, while
     // in FP mode a hit makes the entry less likely to be evicted
     if (hitPriority) {
-        casted_replacement_data->rrpv.reset();
-    } else {
-        casted_replacement_data->rrpv--;
+        rrpv = 0;
+    } else if (rrpv > 0) {
+        rrpv--;
     }
 }
 
 void
 BRRIP::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
 {
-    std::shared_ptr<BRRIPReplData> casted_replacement_data =
-        std::static_pointer_cast<BRRIPReplData>(replacement_data);
+    const uint32_t index =
+        std::static_pointer_cast<BRRIPReplData>(replacement_data)->index;
 
     // Reset RRPV
     // Replacement data is inserted as "long re-reference" if lower than btp,
     // "distant re-reference" otherwise
-    casted_replacement_data->rrpv.saturate();
+    rrpvs[index] = maxRRPV;
     if (rng->random<unsigned>(1, 100) <= btp) {
-        casted_replacement_data->rrpv--;
+        rrpvs[index]--;
     }
 
     // Mark entry as ready to be used
-    casted_replacement_data->valid = true;
+    valids[index] = 1;
+}
+
+void
+BRRIP::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+             const PacketPtr pkt)
+{
+    reset(replacement_data);
+
+    // a non-temporal hint always inserts at distant re-reference,
+    // overriding the bimodal long-insertion roll
+    if (pkt->req->isEvictNext()) {
+        rrpvs[std::static_pointer_cast<BRRIPReplData>(
+            replacement_data)->index] = maxRRPV;
+    }
 }
 
 ReplaceableEntry*
@@ -97,26 +120,23 @@ BRRIP::getVictim(const ReplacementCandidates& candidates) const
     // There must be at least one replacement candidate
     assert(candidates.size() > 0);
 
-    // Use first candidate as dummy victim
+    // Use first candidate as dummy victim; the scan reads the packed
+    // arrays directly, one byte per candidate
     ReplaceableEntry* victim = candidates[0];
-
-    // Store victim->rrpv in a variable to improve code readability
-    int victim_RRPV = std::static_pointer_cast<BRRIPReplData>(
-                        victim->replacementData)->rrpv;
+    int victim_RRPV = -1;
 
     // Visit all candidates to find victim
     for (const auto& candidate : candidates) {
-        std::shared_ptr<BRRIPReplData> candidate_repl_data =
-            std::static_pointer_cast<BRRIPReplData>(
-                candidate->replacementData);
+        const uint32_t index = std::static_pointer_cast<BRRIPReplData>(
+            candidate->replacementData)->index;
 
         // Stop searching for victims if an invalid entry is found
-        if (!candidate_repl_data->valid) {
+        if (!valids[index]) {
             return candidate;
         }
 
         // Update victim entry if necessary
-        int candidate_RRPV = candidate_repl_data->rrpv;
+        const int candidate_RRPV = rrpvs[index];
         if (candidate_RRPV > victim_RRPV) {
             victim = candidate;
             victim_RRPV = candidate_RRPV;
@@ -125,15 +145,15 @@ BRRIP::getVictim(const ReplacementCandidates& candidates) const
 
     // Get difference of victim's RRPV to the highest possible RRPV in
     // order to update the RRPV of all the other entries accordingly
-    int diff = std::static_pointer_cast<BRRIPReplData>(
-        victim->replacementData)->rrpv.saturate();
+    const int diff = maxRRPV - victim_RRPV;
 
     // No need to update RRPV if there is no difference
     if (diff > 0){
-        // Update RRPV of all candidates
+        // Update RRPV of all candidates (saturating)
         for (const auto& candidate : candidates) {
-            std::static_pointer_cast<BRRIPReplData>(
-                candidate->replacementData)->rrpv += diff;
+            uint8_t &rrpv = rrpvs[std::static_pointer_cast<BRRIPReplData>(
+                candidate->replacementData)->index];
+            rrpv = std::min<int>(maxRRPV, rrpv + diff);
         }
     }
 
@@ -143,7 +163,8 @@ BRRIP::getVictim(const ReplacementCandidates& candidates) const
 std::shared_ptr<ReplacementData>
 BRRIP::instantiateEntry()
 {
-    return std::shared_ptr<ReplacementData>(new BRRIPReplData(numRRPVBits));
+    return std::shared_ptr<ReplacementData>(
+        new BRRIPReplData(allocateEntryIndex()));
 }
 
 } // namespace replacement_policy
@@ -52,8 +52,10 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_BRRIP_RP_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_BRRIP_RP_HH__
 
+#include <cstdint>
+#include <vector>
+
 #include "base/random.hh"
-#include "base/sat_counter.hh"
 #include "mem/cache/replacement_policies/base.hh"
 
 namespace gem5
@@ -67,30 +69,58 @@ namespace replacement_policy
 class BRRIP : public Base
 {
   protected:
-    /** BRRIP-specific implementation of replacement data. */
+    /**
+     * BRRIP-specific implementation of replacement data. The RRPV
+     * and valid bit live in dense arrays owned by the policy (see
+     * rrpvs/valids below); the per-entry data only carries the index
+     * into them, so victim search walks contiguous bytes instead of
+     * chasing one shared_ptr per candidate.
+     */
     struct BRRIPReplData : ReplacementData
     {
-        /**
-         * Re-Reference Interval Prediction Value.
-         * Some values have specific names (according to the paper):
-         * 0 -> near-immediate re-rereference interval
-         * max_RRPV-1 -> long re-rereference interval
-         * max_RRPV -> distant re-rereference interval
-         */
-        SatCounter8 rrpv;
-
-        /** Whether the entry is valid. */
-        bool valid;
-
-        /**
-         * Default constructor. Invalidate data.
-         */
-        BRRIPReplData(const int num_bits)
-            : rrpv(num_bits), valid(false)
+        /** Index into the policy's packed rrpv/valid arrays. */
+        const uint32_t index;
+
+        BRRIPReplData(const uint32_t index)
+            : index(index)
         {
         }
     };
 
+    /**
+     * Packed per-entry state, indexed by BRRIPReplData::index.
+     * Entries are handed out in tags-construction order, so the
+     * candidates of one set occupy adjacent slots. Mutable because
+     * the replacement interface is const.
+     *
+     * rrpvs holds the Re-Reference Prediction Value of each entry.
+     * Some values have specific names (according to the paper):
+     * 0 -> near-immediate re-reference interval
+     * maxRRPV-1 -> long re-reference interval
+     * maxRRPV -> distant re-reference interval
+     */
+    mutable std::vector<uint8_t> rrpvs;
+
+    /** Packed valid flags, parallel to rrpvs. */
+    mutable std::vector<uint8_t> valids;
+
+    /** Saturation value of the RRPVs ((1 << numRRPVBits) - 1). */
+    const uint8_t maxRRPV;
+
+    /** Allocate the next packed slot (invalid, distant RRPV). */
+    uint32_t allocateEntryIndex();
+
+  public:
+    /**
+     * Reset replacement data with access information. A non-temporal
+     * hint (Request::EVICT_NEXT) always inserts at distant
+     * re-reference, overriding the bimodal long-insertion roll.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+               const PacketPtr pkt) override;
+
+  protected:
+
     /**
      * Number of RRPV bits. An entry that saturates its RRPV has the longest
      * possible re-reference interval, that is, it is likely not to be used
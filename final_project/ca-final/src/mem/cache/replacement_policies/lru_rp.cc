@@ -28,6 +28,8 @@
 
 #include "mem/cache/replacement_policies/lru_rp.hh"
 
+#include "mem/packet.hh"
+
 #include <cassert>
 #include <memory>
 
@@ -69,6 +71,20 @@ LRU::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
         replacement_data)->lastTouchTick = curTick();
 }
 
+void
+LRU::reset(const std::shared_ptr<ReplacementData>& replacement_data,
+           const PacketPtr pkt)
+{
+    reset(replacement_data);
+
+    // a non-temporal hint inserts at the LRU position: older than
+    // every live entry, but newer than an invalidated one
+    if (pkt->req->isEvictNext()) {
+        std::static_pointer_cast<LRUReplData>(
+            replacement_data)->lastTouchTick = Tick(1);
+    }
+}
+
 ReplaceableEntry*
 LRU::getVictim(const ReplacementCandidates& candidates) const
 {
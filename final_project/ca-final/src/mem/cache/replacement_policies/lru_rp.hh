@@ -74,6 +74,14 @@ class LRU : public Base
     void invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
                                                                     override;
 
+    /**
+     * Reset replacement data for an entry. A non-temporal hint
+     * (Request::EVICT_NEXT) inserts at the LRU position instead of
+     * the MRU one.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data,
+               const PacketPtr pkt) override;
+
     /**
      * Touch an entry to update its replacement data.
      * Sets its last touch tick as the current tick.
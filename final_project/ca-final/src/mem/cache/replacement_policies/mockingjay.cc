@@ -135,31 +135,31 @@ namespace gem5
 namespace replacement_policy
 {
 
+Mockingjay::PredictorState &
+Mockingjay::sharedState()
+{
+    static PredictorState shared;
+    return shared;
+}
+
 Mockingjay::Mockingjay(const Params &p)
     : Base(p),
-      weightPcHash(0.25),
-      weightAge(0.35),
-      weightAccessCount(-0.30),
-      weightReuseDistance(0.40),
-      bias(0.0),
+      state(p.share_tables ? &sharedState() : &ownState),
       learningRate(p.learning_rate),
       enableOnlineLearning(p.enable_online_learning),
-      weightsFile(p.weights_file),
-      globalAccessCounter(0)
+      weightsFile(p.weights_file)
 {
-    // Initialize eviction table
-    for (size_t i = 0; i < EVICT_TABLE_SIZE; i++) {
-        evictTable[i].valid = false;
-    }
-
-    // Load weights from file if specified
+    // Load weights from file if specified. With shared tables every
+    // sharing instance loads the same file, which is idempotent.
     if (!weightsFile.empty()) {
         loadWeights();
     }
 
     DPRINTF(CacheRepl, "Mockingjay: Initialized with weights - "
             "pc_hash: %f, age: %f, access_count: %f, reuse_dist: %f, bias: %f\n",
-            weightPcHash, weightAge, weightAccessCount, weightReuseDistance, bias);
+            state->weightPcHash, state->weightAge,
+            state->weightAccessCount, state->weightReuseDistance,
+            state->bias);
     DPRINTF(CacheRepl, "Mockingjay: Learning rate: %f, Online learning: %s\n",
             learningRate, enableOnlineLearning ? "enabled" : "disabled");
 }
@@ -181,11 +181,11 @@ Mockingjay::loadWeights()
 
     // Parse JSON (simple parsing)
     try {
-        weightPcHash = extractWeight(json, "pc_hash");
-        weightAge = extractWeight(json, "age");
-        weightAccessCount = extractWeight(json, "access_count");
-        weightReuseDistance = extractWeight(json, "reuse_distance");
-        bias = parseJsonNumber(json, "bias");
+        state->weightPcHash = extractWeight(json, "pc_hash");
+        state->weightAge = extractWeight(json, "age");
+        state->weightAccessCount = extractWeight(json, "access_count");
+        state->weightReuseDistance = extractWeight(json, "reuse_distance");
+        state->bias = parseJsonNumber(json, "bias");
 
         // Override learning parameters if specified in file
         double fileLearningRate = parseJsonNumber(json, "learning_rate");
@@ -256,11 +256,11 @@ Mockingjay::computePriority(const MockingjayReplData* data) const
     double reuseDistFeature = computeReuseDistanceFeature(data->reuseDistance);
 
     // Linear model: priority = Σ(w_i * f_i) + bias
-    double priority = weightPcHash * pcHashFeature +
-                      weightAge * ageFeature +
-                      weightAccessCount * accessCountFeature +
-                      weightReuseDistance * reuseDistFeature +
-                      bias;
+    double priority = state->weightPcHash * pcHashFeature +
+                      state->weightAge * ageFeature +
+                      state->weightAccessCount * accessCountFeature +
+                      state->weightReuseDistance * reuseDistFeature +
+                      state->bias;
 
     return priority;
 }
@@ -273,20 +273,20 @@ Mockingjay::updateWeights(const EvictedEntry& entry, double target)
     }
 
     // Compute current prediction
-    double prediction = weightPcHash * entry.features[0] +
-                       weightAge * entry.features[1] +
-                       weightAccessCount * entry.features[2] +
-                       weightReuseDistance * entry.features[3] +
-                       bias;
+    double prediction = state->weightPcHash * entry.features[0] +
+                       state->weightAge * entry.features[1] +
+                       state->weightAccessCount * entry.features[2] +
+                       state->weightReuseDistance * entry.features[3] +
+                       state->bias;
 
     // Gradient descent: w = w - lr * (pred - target) * feature
     double error = prediction - target;
 
-    weightPcHash -= learningRate * error * entry.features[0];
-    weightAge -= learningRate * error * entry.features[1];
-    weightAccessCount -= learningRate * error * entry.features[2];
-    weightReuseDistance -= learningRate * error * entry.features[3];
-    bias -= learningRate * error;
+    state->weightPcHash -= learningRate * error * entry.features[0];
+    state->weightAge -= learningRate * error * entry.features[1];
+    state->weightAccessCount -= learningRate * error * entry.features[2];
+    state->weightReuseDistance -= learningRate * error * entry.features[3];
+    state->bias -= learningRate * error;
 
     DPRINTF(CacheRepl, "Mockingjay: Updated weights - error: %f, target: %f\n",
             error, target);
@@ -302,13 +302,13 @@ Mockingjay::trackEviction(Addr pc, Tick evictTick, const double features[4]) con
     // Use simple hash to find slot in eviction table
     size_t index = (pc / 64) % EVICT_TABLE_SIZE;
 
-    evictTable[index].pc = pc;
-    evictTable[index].evictTick = evictTick;
-    evictTable[index].features[0] = features[0];
-    evictTable[index].features[1] = features[1];
-    evictTable[index].features[2] = features[2];
-    evictTable[index].features[3] = features[3];
-    evictTable[index].valid = true;
+    state->evictTable[index].pc = pc;
+    state->evictTable[index].evictTick = evictTick;
+    state->evictTable[index].features[0] = features[0];
+    state->evictTable[index].features[1] = features[1];
+    state->evictTable[index].features[2] = features[2];
+    state->evictTable[index].features[3] = features[3];
+    state->evictTable[index].valid = true;
 }
 
 void
@@ -320,10 +320,10 @@ Mockingjay::checkEvictedReuse(Addr pc, Tick currentTick)
 
     size_t index = (pc / 64) % EVICT_TABLE_SIZE;
 
-    if (evictTable[index].valid && evictTable[index].pc == pc) {
+    if (state->evictTable[index].valid && state->evictTable[index].pc == pc) {
         // This line was evicted and now re-accessed
         // Compute reuse distance in ticks
-        Tick reuseTime = currentTick - evictTable[index].evictTick;
+        Tick reuseTime = currentTick - state->evictTable[index].evictTick;
 
         // Target: Lower priority for quickly reused items (negative target)
         // Higher priority for slowly reused items (positive target)
@@ -331,10 +331,10 @@ Mockingjay::checkEvictedReuse(Addr pc, Tick currentTick)
         double target = std::log(1.0 + static_cast<double>(reuseTime)) /
                        std::log(1.0 + 1e6) - 0.5;
 
-        updateWeights(evictTable[index], target);
+        updateWeights(state->evictTable[index], target);
 
         // Mark as invalid
-        evictTable[index].valid = false;
+        state->evictTable[index].valid = false;
     }
 }
 
@@ -370,15 +370,16 @@ Mockingjay::touch(const std::shared_ptr<ReplacementData>& replacement_data,
     // Bug #1 Fix: Use separate lastAccessCounter field instead of reusing reuseDistance
     if (casted_replacement_data->lastAccessCounter > 0) {
         casted_replacement_data->reuseDistance =
-            globalAccessCounter - casted_replacement_data->lastAccessCounter;
+            state->globalAccessCounter -
+            casted_replacement_data->lastAccessCounter;
     }
 
     // Update last touch tick and store current access counter
     casted_replacement_data->lastTouchTick = curTick();
-    casted_replacement_data->lastAccessCounter = globalAccessCounter;
+    casted_replacement_data->lastAccessCounter = state->globalAccessCounter;
 
     // Increment global access counter
-    globalAccessCounter++;
+    state->globalAccessCounter++;
 
     // Extract PC if available
     if (pkt && pkt->req && pkt->req->hasPC()) {
@@ -423,10 +424,10 @@ Mockingjay::reset(const std::shared_ptr<ReplacementData>& replacement_data,
     casted_replacement_data->lastTouchTick = currentTick;
     casted_replacement_data->accessCount = 0;
     casted_replacement_data->reuseDistance = 0;
-    casted_replacement_data->lastAccessCounter = globalAccessCounter;
+    casted_replacement_data->lastAccessCounter = state->globalAccessCounter;
 
     // Increment global access counter
-    globalAccessCounter++;
+    state->globalAccessCounter++;
 
     // Extract PC if available
     if (pkt && pkt->req && pkt->req->hasPC()) {
@@ -467,29 +468,22 @@ Mockingjay::getVictim(const ReplacementCandidates& candidates) const
     // There must be at least one replacement candidate
     assert(candidates.size() > 0);
 
-    // Bug #2 Fix: First pass - recompute all priorities to ensure they reflect
-    // current state (tick/age) rather than stale values from last access
-    for (const auto& candidate : candidates) {
-        std::shared_ptr<MockingjayReplData> cand_data =
-            std::static_pointer_cast<MockingjayReplData>(
-                candidate->replacementData);
-        cand_data->priority = computePriority(cand_data.get());
-    }
-
-    // Second pass: Visit all candidates to find victim with highest priority
+    // Single fused scan: recompute each candidate's priority (so it
+    // reflects the current tick rather than a stale value from the
+    // last access) and track the maximum as we go. Raw-pointer casts
+    // keep the shared_ptr reference counts out of the loop.
     ReplaceableEntry* victim = candidates[0];
-    double maxPriority = std::static_pointer_cast<MockingjayReplData>(
-        victim->replacementData)->priority;
+    double maxPriority = -std::numeric_limits<double>::infinity();
 
     for (const auto& candidate : candidates) {
-        std::shared_ptr<MockingjayReplData> cand_data =
-            std::static_pointer_cast<MockingjayReplData>(
-                candidate->replacementData);
+        auto* cand_data = static_cast<MockingjayReplData*>(
+                candidate->replacementData.get());
+        const double priority = computePriority(cand_data);
+        cand_data->priority = priority;
 
-        // Update victim entry if this candidate has higher priority
-        if (cand_data->priority > maxPriority) {
+        if (priority > maxPriority) {
             victim = candidate;
-            maxPriority = cand_data->priority;
+            maxPriority = priority;
         }
     }
 
@@ -505,7 +499,7 @@ Mockingjay::getVictim(const ReplacementCandidates& candidates) const
         features[2] = computeAccessCountFeature(victim_data->accessCount);
         features[3] = computeReuseDistanceFeature(victim_data->reuseDistance);
 
-        // Bug #3 Fix: No need for const_cast since evictTable is now mutable
+        // Bug #3 Fix: No need for const_cast since state->evictTable is now mutable
         trackEviction(victim_data->pc, curTick(), features);
     }
 
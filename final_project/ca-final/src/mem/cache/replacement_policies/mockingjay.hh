@@ -97,12 +97,42 @@ class Mockingjay : public Base
         EvictedEntry() : pc(0), evictTick(0), valid(false) {}
     };
 
-    /** Model weights for the linear model. */
-    double weightPcHash;
-    double weightAge;
-    double weightAccessCount;
-    double weightReuseDistance;
-    double bias;
+    /** Eviction tracking table size for online learning. */
+    static const size_t EVICT_TABLE_SIZE = 64;
+
+    /**
+     * Predictor state (model weights, eviction tracking table and the
+     * global access counter). Kept in one struct so banked-LLC
+     * configurations can share a single copy across their per-bank
+     * policy instances instead of duplicating the tables per cache
+     * (see the share_tables parameter). Sharing is only safe while
+     * all sharing banks run on the same event queue thread, which is
+     * how the banked configs are set up.
+     */
+    struct PredictorState
+    {
+        /** Model weights for the linear model. */
+        double weightPcHash = 0.25;
+        double weightAge = 0.35;
+        double weightAccessCount = -0.30;
+        double weightReuseDistance = 0.40;
+        double bias = 0.0;
+
+        /** Eviction tracking table for online learning. */
+        EvictedEntry evictTable[EVICT_TABLE_SIZE];
+
+        /** Global access counter for tracking reuse distance. */
+        uint64_t globalAccessCounter = 0;
+    };
+
+    /** Private state, used when share_tables is disabled. */
+    mutable PredictorState ownState;
+
+    /** The state this instance operates on (own or shared). */
+    PredictorState *state;
+
+    /** The process-wide state shared by share_tables instances. */
+    static PredictorState &sharedState();
 
     /** Learning rate for online learning. */
     double learningRate;
@@ -113,14 +143,6 @@ class Mockingjay : public Base
     /** Path to the weights JSON file. */
     std::string weightsFile;
 
-    /** Eviction tracking table for online learning (64 entries). */
-    static const size_t EVICT_TABLE_SIZE = 64;
-    // Bug #3 Fix: Mark as mutable to allow modification in const methods
-    mutable EvictedEntry evictTable[EVICT_TABLE_SIZE];
-
-    /** Global access counter for tracking reuse distance. */
-    // Bug #3 Fix: Mark as mutable to allow modification in const methods
-    mutable uint64_t globalAccessCounter;
 
     /**
      * Load weights from JSON file.
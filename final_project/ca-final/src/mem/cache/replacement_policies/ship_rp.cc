@@ -39,8 +39,8 @@ namespace gem5
 namespace replacement_policy
 {
 
-SHiP::SHiPReplData::SHiPReplData(int num_bits)
-  : BRRIPReplData(num_bits), signature(0), outcome(false)
+SHiP::SHiPReplData::SHiPReplData(uint32_t index)
+  : BRRIPReplData(index), signature(0), outcome(false)
 {
 }
 
@@ -127,10 +127,15 @@ SHiP::reset(const std::shared_ptr<ReplacementData>& replacement_data,
     casted_replacement_data->setSignature(signature);
 
     // If SHCT for signature is set, predict intermediate re-reference.
-    // Predict distant re-reference otherwise
-    BRRIP::reset(replacement_data);
-    if (SHCT[signature].calcSaturation() >= insertionThreshold) {
-        casted_replacement_data->rrpv--;
+    // Predict distant re-reference otherwise; an explicit
+    // non-temporal hint (handled in BRRIP::reset) overrides the
+    // learned prediction
+    BRRIP::reset(replacement_data, pkt);
+    if (!pkt->req->isEvictNext() &&
+        SHCT[signature].calcSaturation() >= insertionThreshold) {
+        uint8_t &rrpv = rrpvs[casted_replacement_data->index];
+        if (rrpv > 0)
+            rrpv--;
     }
 }
 
@@ -144,7 +149,8 @@ SHiP::reset(const std::shared_ptr<ReplacementData>& replacement_data)
 std::shared_ptr<ReplacementData>
 SHiP::instantiateEntry()
 {
-    return std::shared_ptr<ReplacementData>(new SHiPReplData(numRRPVBits));
+    return std::shared_ptr<ReplacementData>(
+        new SHiPReplData(allocateEntryIndex()));
 }
 
 SHiPMem::SHiPMem(const SHiPMemRPParams &p) : SHiP(p) {}
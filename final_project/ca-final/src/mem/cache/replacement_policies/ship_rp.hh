@@ -70,7 +70,7 @@ class SHiP : public BRRIP
         bool outcome;
 
       public:
-        SHiPReplData(int num_bits);
+        SHiPReplData(uint32_t index);
 
         /** Get entry's signature. */
         SignatureType getSignature() const;
@@ -122,6 +122,11 @@ BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
         stats.warmupTick = curTick();
     }
 
+    // Account insertions carrying a non-temporal hint, so software
+    // hint coverage is visible per cache level.
+    if (pkt->req->isEvictNext())
+        stats.ntHintInsertions++;
+
     // We only need to write into one tag and one data block.
     stats.tagAccesses += 1;
     stats.dataAccesses += 1;
@@ -256,7 +261,9 @@ BaseTags::BaseTagStats::BaseTagStats(BaseTags &_tags)
     ADD_STAT(tagAccesses, statistics::units::Count::get(),
              "Number of tag accesses"),
     ADD_STAT(dataAccesses, statistics::units::Count::get(),
-             "Number of data accesses")
+             "Number of data accesses"),
+    ADD_STAT(ntHintInsertions, statistics::units::Count::get(),
+             "Number of insertions carrying a non-temporal hint")
 {
 }
 
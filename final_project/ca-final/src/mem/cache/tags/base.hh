@@ -158,6 +158,9 @@ class BaseTags : public ClockedObject
         statistics::Scalar tagAccesses;
         /** Number of data blocks consulted over all accesses. */
         statistics::Scalar dataAccesses;
+
+        /** Insertions carrying a non-temporal (evict-next) hint. */
+        statistics::Scalar ntHintInsertions;
     } stats;
 
   public:
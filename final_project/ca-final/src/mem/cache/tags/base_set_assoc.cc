@@ -55,7 +55,9 @@ namespace gem5
 BaseSetAssoc::BaseSetAssoc(const Params &p)
     :BaseTags(p), allocAssoc(p.assoc), blks(p.size / p.block_size),
      sequentialAccess(p.sequential_access),
-     replacementPolicy(p.replacement_policy)
+     replacementPolicy(p.replacement_policy),
+     physAssoc(p.assoc),
+     plainIndexing(dynamic_cast<SetAssociative *>(p.indexing_policy))
 {
     // There must be a indexing policy
     fatal_if(!p.indexing_policy, "An indexing policy is required");
@@ -86,6 +88,34 @@ BaseSetAssoc::tagsInit()
         // This is not used as of now but we set it for security
         blk->registerTagExtractor(genTagExtractor(indexingPolicy));
     }
+
+    if (plainIndexing) {
+        // all blocks start out invalid
+        packedTag.assign(numBlocks, MaxAddr);
+        packedState.assign(numBlocks, 0);
+    }
+}
+
+CacheBlk *
+BaseSetAssoc::findBlock(const CacheBlk::KeyType &key) const
+{
+    if (packedTag.empty())
+        return BaseTags::findBlock(key);
+
+    const Addr tag = extractTag(key.address);
+    const uint8_t want = 0x1 | (key.secure ? 0x2 : 0);
+    const size_t set = plainIndexing->extractSet(key.address);
+    const size_t row = set * physAssoc;
+
+    for (size_t way = 0; way < physAssoc; way++) {
+        if (packedTag[row + way] == tag &&
+            packedState[row + way] == want) {
+            return static_cast<CacheBlk *>(
+                    indexingPolicy->getEntry(set, way));
+        }
+    }
+
+    return nullptr;
 }
 
 void
@@ -97,6 +127,8 @@ BaseSetAssoc::invalidate(CacheBlk *blk)
     }
 
     BaseTags::invalidate(blk);
+    syncPackedEntry(blk);
+    memoBlk = nullptr;
 
     // Decrease the number of tags in use
     stats.tagsInUse--;
@@ -109,6 +141,9 @@ void
 BaseSetAssoc::moveBlock(CacheBlk *src_blk, CacheBlk *dest_blk)
 {
     BaseTags::moveBlock(src_blk, dest_blk);
+    syncPackedEntry(src_blk);
+    syncPackedEntry(dest_blk);
+    memoBlk = nullptr;
 
     // Since the blocks were using different replacement data pointers,
     // we must touch the replacement data of the new entry, and invalidate
@@ -59,6 +59,7 @@
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/cache/tags/base.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
+#include "mem/cache/tags/indexing_policies/set_associative.hh"
 #include "mem/cache/tags/partitioning_policies/partition_manager.hh"
 #include "mem/packet.hh"
 #include "params/BaseSetAssoc.hh"
@@ -73,7 +74,7 @@ namespace gem5
  * The BaseSetAssoc placement policy divides the cache into s sets of w
  * cache lines (ways).
  */
-class BaseSetAssoc : public BaseTags
+class BaseSetAssoc final : public BaseTags
 {
   protected:
     /** The allocatable associativity of the cache (alloc mask). */
@@ -88,6 +89,48 @@ class BaseSetAssoc : public BaseTags
     /** Replacement policy */
     replacement_policy::Base *replacementPolicy;
 
+    /** The physical associativity, fixing the packed row stride. */
+    const unsigned physAssoc;
+
+    /**
+     * Packed per-set mirror of each block's lookup metadata (tag plus
+     * valid/secure state), indexed by set * physAssoc + way and kept
+     * in sync by insertBlock()/invalidate()/moveBlock(). findBlock()
+     * compares a whole set in this contiguous array -- a loop the
+     * compiler can vectorize -- and only touches the block objects on
+     * a hit. Only maintained for the plain set-associative indexing
+     * policy; other policies use the generic lookup.
+     */
+    std::vector<Addr> packedTag;
+    std::vector<uint8_t> packedState;
+
+    /** Cached downcast of indexingPolicy enabling the packed path. */
+    SetAssociative *plainIndexing;
+
+    /**
+     * One-entry memo of the last hit, exploiting the extreme line
+     * locality of (especially atomic-mode) access streams: repeated
+     * accesses to the same line skip even the per-set tag compare.
+     * Cleared whenever any block's identity changes. Statistics and
+     * replacement updates still happen on the memoized path, so
+     * simulated behavior is identical.
+     */
+    mutable Addr memoAddr = MaxAddr;
+    mutable bool memoSecure = false;
+    mutable CacheBlk *memoBlk = nullptr;
+
+    /** Refresh a block's packed lookup metadata. */
+    void
+    syncPackedEntry(const CacheBlk *blk)
+    {
+        if (packedTag.empty())
+            return;
+        const size_t idx = blk->getSet() * physAssoc + blk->getWay();
+        packedTag[idx] = blk->getTag();
+        packedState[idx] =
+            (blk->isValid() ? 0x1 : 0) | (blk->isSecure() ? 0x2 : 0);
+    }
+
   public:
     /** Convenience typedef. */
      typedef BaseSetAssocParams Params;
@@ -107,6 +150,12 @@ class BaseSetAssoc : public BaseTags
      */
     void tagsInit() override;
 
+    /**
+     * Find the block within the packed tag mirror, falling back to
+     * the generic lookup when the mirror is not maintained.
+     */
+    CacheBlk *findBlock(const CacheBlk::KeyType &key) const override;
+
     /**
      * This function updates the tags when a block is invalidated. It also
      * updates the replacement data.
@@ -125,9 +174,22 @@ class BaseSetAssoc : public BaseTags
      * @param lat The latency of the tag lookup.
      * @return Pointer to the cache block if found.
      */
-    CacheBlk* accessBlock(const PacketPtr pkt, Cycles &lat) override
+    CacheBlk* accessBlock(const PacketPtr pkt, Cycles &lat) final
     {
-        CacheBlk *blk = findBlock({pkt->getAddr(), pkt->isSecure()});
+        const Addr blk_addr = pkt->getAddr() & ~Addr(blkSize - 1);
+        const bool is_secure = pkt->isSecure();
+
+        CacheBlk *blk;
+        if (memoBlk && memoAddr == blk_addr && memoSecure == is_secure) {
+            blk = memoBlk;
+        } else {
+            blk = findBlock({pkt->getAddr(), is_secure});
+            if (blk) {
+                memoAddr = blk_addr;
+                memoSecure = is_secure;
+                memoBlk = blk;
+            }
+        }
 
         // Access all tags in parallel, hence one in each way.  The data side
         // either accesses all blocks in parallel, or one block sequentially on
@@ -201,6 +263,8 @@ class BaseSetAssoc : public BaseTags
     {
         // Insert block
         BaseTags::insertBlock(pkt, blk);
+        syncPackedEntry(blk);
+        memoBlk = nullptr;
 
         // Increment tag counter
         stats.tagsInUse++;
@@ -138,7 +138,7 @@ CompressedTags::findVictim(const CacheBlk::KeyType& key,
     for (const auto& entry : superblock_entries){
         SuperBlk* superblock = static_cast<SuperBlk*>(entry);
         if (superblock->match(key) &&
-            !superblock->blks[offset]->isValid() &&
+            !superblock->isSubBlkValid(offset) &&
             superblock->isCompressed() &&
             superblock->canCoAllocate(compressed_size))
         {
@@ -138,4 +138,78 @@ DuelingMonitor::initEntry(Dueler* dueler)
     }
 }
 
+unsigned KWayDuelingMonitor::numInstances = 0;
+
+KWayDuelingMonitor::KWayDuelingMonitor(std::size_t constituency_size,
+    unsigned num_teams, std::size_t team_size, uint64_t epoch_samples,
+    double switch_margin, std::function<void(uint8_t)> switch_callback)
+    : id(numInstances), constituencySize(constituency_size),
+      teamSize(team_size), numTeams(num_teams),
+      epochSamples(epoch_samples), switchMargin(switch_margin),
+      scores(num_teams, 0), switchCallback(std::move(switch_callback))
+{
+    fatal_if(num_teams < 2, "A tournament needs at least two teams");
+    fatal_if(num_teams > 256, "Teams are stored in a byte");
+    fatal_if(numInstances >= KWayDueler::kMaxInstances,
+        "Too many K-way dueling instances");
+    fatal_if(constituency_size < num_teams * team_size,
+        "There must be room for every team's samples in a constituency");
+    numInstances++;
+}
+
+void
+KWayDuelingMonitor::sample(const KWayDueler *dueler)
+{
+    uint8_t team;
+    if (!isSample(dueler, team))
+        return;
+
+    scores[team]++;
+
+    if (++samplesSinceDecay >= epochSamples) {
+        samplesSinceDecay = 0;
+        for (auto &score : scores)
+            score /= 2;
+    }
+
+    updateWinner();
+}
+
+void
+KWayDuelingMonitor::updateWinner()
+{
+    uint8_t best = 0;
+    for (unsigned team = 1; team < numTeams; team++) {
+        if (scores[team] < scores[best])
+            best = team;
+    }
+
+    // a challenger must beat the incumbent by the margin
+    if (best != winner &&
+        scores[best] + scores[winner] * switchMargin < scores[winner]) {
+        winner = best;
+        if (switchCallback)
+            switchCallback(winner);
+    }
+}
+
+bool
+KWayDuelingMonitor::isSample(const KWayDueler *dueler, uint8_t &team) const
+{
+    return dueler->isSample(id, team);
+}
+
+void
+KWayDuelingMonitor::initEntry(KWayDueler *dueler)
+{
+    // deal the first numTeams * teamSize entries of a constituency
+    // round-robin to the teams; everything after is a follower
+    assert(dueler);
+    if (regionCounter < numTeams * teamSize)
+        dueler->setSample(id, regionCounter % numTeams);
+
+    if (++regionCounter >= constituencySize)
+        regionCounter = 0;
+}
+
 } // namespace gem5
@@ -29,8 +29,11 @@
 #ifndef __BASE_DUELING_HH__
 #define __BASE_DUELING_HH__
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <vector>
 
 #include "base/sat_counter.hh"
 
@@ -204,6 +207,113 @@ class DuelingMonitor
     void initEntry(Dueler* dueler);
 };
 
+/**
+ * K-way generalization of set dueling: a tournament between K
+ * sampled options rather than a single bit-team pair. Each
+ * constituency dedicates team_size sample entries to every
+ * contestant; sampling (typically on misses) charges the sampled
+ * entry's team, and the winner is the team with the lowest decayed
+ * score, with a hysteresis margin so the lead does not flicker.
+ * Scores are halved every epoch_samples total samples, giving the
+ * recency weighting the two-team monitor gets from its saturating
+ * PSEL. An optional callback fires on every lead change, serving as
+ * the policy-switch probe.
+ *
+ * Kept separate from DuelingMonitor: the pair version packs its team
+ * in one bit per monitor instance inside each entry, which cannot
+ * express K teams, and its PSEL semantics are two-sided by nature.
+ */
+class KWayDueler
+{
+  private:
+    /** Sample flag per monitor instance (bit index = instance id). */
+    uint64_t _isSample = 0;
+
+    /** Team per monitor instance; supports kMaxInstances monitors. */
+    std::array<uint8_t, 4> _teams = {};
+
+  public:
+    static constexpr unsigned kMaxInstances = 4;
+
+    virtual ~KWayDueler() = default;
+
+    void
+    setSample(unsigned instance, uint8_t team)
+    {
+        _isSample |= 1ULL << instance;
+        _teams[instance] = team;
+    }
+
+    bool
+    isSample(unsigned instance, uint8_t &team) const
+    {
+        team = _teams[instance];
+        return _isSample & (1ULL << instance);
+    }
+};
+
+class KWayDuelingMonitor
+{
+  private:
+    /** Instance id, indexing KWayDueler state. */
+    const unsigned id;
+
+    const std::size_t constituencySize;
+    const std::size_t teamSize;
+    const unsigned numTeams;
+
+    /** Total samples between score halvings. */
+    const uint64_t epochSamples;
+
+    /**
+     * Relative advantage a challenger needs over the current winner
+     * before the lead changes (hysteresis against flicker).
+     */
+    const double switchMargin;
+
+    /** Decayed per-team scores (lower is better). */
+    std::vector<uint64_t> scores;
+
+    /** Samples since the last decay. */
+    uint64_t samplesSinceDecay = 0;
+
+    /** Entries initialized in the current constituency. */
+    std::size_t regionCounter = 0;
+
+    /** The currently winning team. */
+    uint8_t winner = 0;
+
+    /** Invoked with the new winner on every lead change. */
+    std::function<void(uint8_t)> switchCallback;
+
+    /** Re-evaluate the lead with hysteresis. */
+    void updateWinner();
+
+  public:
+    /** Instances created so far, for id assignment. */
+    static unsigned numInstances;
+
+    KWayDuelingMonitor(std::size_t constituency_size, unsigned num_teams,
+        std::size_t team_size = 1, uint64_t epoch_samples = 4096,
+        double switch_margin = 0.1,
+        std::function<void(uint8_t)> switch_callback = nullptr);
+
+    /** Charge the sampled entry's team, if it is a sample. */
+    void sample(const KWayDueler *dueler);
+
+    bool isSample(const KWayDueler *dueler, uint8_t &team) const;
+
+    /** Get the currently winning team. */
+    uint8_t getWinner() const { return winner; }
+
+    /**
+     * Initialize an entry: the first num_teams * team_size entries
+     * of every constituency are dealt round-robin to the teams, the
+     * rest are followers.
+     */
+    void initEntry(KWayDueler *dueler);
+};
+
 } // namespace gem5
 
 #endif // __BASE_DUELING_HH__
@@ -260,3 +260,63 @@ INSTANTIATE_TEST_CASE_P(DuelingMonitorTests, DuelingMonitorTest,
         // Test for larger tables
         std::make_tuple(2048, 32, 4, 4, 0.4, 0.6))
 );
+
+/** Test that K-way sample entries store and report their teams. */
+TEST(KWayDuelerTest, SetSample)
+{
+    gem5::KWayDueler dueler;
+    uint8_t team;
+
+    // followers are not samples
+    for (unsigned i = 0; i < gem5::KWayDueler::kMaxInstances; i++) {
+        ASSERT_FALSE(dueler.isSample(i, team));
+    }
+
+    dueler.setSample(1, 3);
+    ASSERT_FALSE(dueler.isSample(0, team));
+    ASSERT_TRUE(dueler.isSample(1, team));
+    ASSERT_EQ(team, 3);
+}
+
+/**
+ * Test that the team whose samples score least becomes the winner,
+ * and that the switch callback observes every lead change.
+ */
+TEST(KWayDuelingMonitorTest, WinnerSelection)
+{
+    const unsigned num_teams = 4;
+    uint8_t last_switch = 0;
+    gem5::KWayDuelingMonitor monitor(32, num_teams, 1, 64, 0.1,
+        [&last_switch](uint8_t team) { last_switch = team; });
+
+    // initialize one constituency; the first num_teams entries are
+    // the samples, dealt round-robin
+    std::vector<gem5::KWayDueler> duelers(32);
+    for (auto &dueler : duelers) {
+        monitor.initEntry(&dueler);
+    }
+
+    uint8_t team;
+    for (unsigned i = 0; i < num_teams; i++) {
+        ASSERT_TRUE(monitor.isSample(&duelers[i], team));
+        ASSERT_EQ(team, i);
+    }
+    ASSERT_FALSE(monitor.isSample(&duelers[num_teams], team));
+
+    // charge every team but team 2 heavily; 2 should take the lead
+    for (int round = 0; round < 20; round++) {
+        for (unsigned i = 0; i < num_teams; i++) {
+            if (i != 2) {
+                monitor.sample(&duelers[i]);
+            }
+        }
+    }
+    ASSERT_EQ(monitor.getWinner(), 2);
+    ASSERT_EQ(last_switch, 2);
+
+    // now make team 2 the worst; the lead must move off it
+    for (int round = 0; round < 100; round++) {
+        monitor.sample(&duelers[2]);
+    }
+    ASSERT_NE(monitor.getWinner(), 2);
+}
@@ -110,6 +110,8 @@ FALRU::tagsInit()
     tail->setPosition(0, numBlocks - 1);
     tail->data = &dataBlks[(numBlocks - 1) * blkSize];
 
+    tagHash.init(numBlocks);
+
     cacheTracking.init(head, tail);
 }
 
@@ -118,7 +120,7 @@ FALRU::invalidate(CacheBlk *blk)
 {
     // Erase block entry reference in the hash table
     [[maybe_unused]] auto num_erased =
-        tagHash.erase(std::make_pair(blk->getTag(), blk->isSecure()));
+        tagHash.erase(blk->getTag(), blk->isSecure());
 
     // Sanity check; only one block reference should be erased
     assert(num_erased == 1);
@@ -172,11 +174,7 @@ FALRU::findBlock(const CacheBlk::KeyType &lookup) const
     FALRUBlk* blk = nullptr;
 
     Addr tag = extractTag(lookup.address);
-    auto key = std::make_pair(tag, lookup.secure);
-    auto iter = tagHash.find(key);
-    if (iter != tagHash.end()) {
-        blk = (*iter).second;
-    }
+    blk = tagHash.find(tag, lookup.secure);
 
     if (blk && blk->isValid()) {
         assert(blk->getTag() == tag);
@@ -225,7 +223,7 @@ FALRU::insertBlock(const PacketPtr pkt, CacheBlk *blk)
     moveToHead(falruBlk);
 
     // Insert new block in the hash table
-    tagHash[std::make_pair(blk->getTag(), blk->isSecure())] = falruBlk;
+    tagHash.insert(blk->getTag(), blk->isSecure(), falruBlk);
 }
 
 void
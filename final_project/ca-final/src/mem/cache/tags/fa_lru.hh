@@ -47,10 +47,11 @@
 #ifndef __MEM_CACHE_TAGS_FA_LRU_HH__
 #define __MEM_CACHE_TAGS_FA_LRU_HH__
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "base/bitfield.hh"
@@ -123,17 +124,118 @@ class FALRU : public BaseTags
     /** The LRU block. */
     FALRUBlk *tail;
 
-    /** Hash table type mapping addresses to cache block pointers. */
-    struct PairHash
+    /**
+     * Open-addressing (robin-hood) hash table mapping {tag, secure}
+     * to cache block pointers. Compared to the node-based
+     * unordered_map it replaces, probes stay within one contiguous
+     * array, inserts never allocate, and erase uses backward-shift
+     * deletion -- which is what lets 64K-entry fully-associative
+     * structures run at usable speed. Sized to at most half load
+     * (one entry per valid block), so probe sequences stay short.
+     */
+    class TagHash
     {
-        template <class T1, class T2>
-        std::size_t operator()(const std::pair<T1, T2> &p) const
+      public:
+        /** Size the table for the given number of blocks. */
+        void
+        init(size_t num_blocks)
+        {
+            size_t table_size = 1;
+            while (table_size < 2 * num_blocks)
+                table_size <<= 1;
+            slots.assign(table_size, Slot());
+            tableMask = table_size - 1;
+        }
+
+        FALRUBlk *
+        find(Addr tag, bool secure) const
         {
-            return std::hash<T1>()(p.first) ^ std::hash<T2>()(p.second);
+            size_t i = hash(tag, secure) & tableMask;
+            uint16_t dist = 0;
+            while (true) {
+                const Slot &s = slots[i];
+                // A richer (shorter-probe) slot means the key would
+                // already have been placed; it is not in the table.
+                if (!s.blk || s.dist < dist)
+                    return nullptr;
+                if (s.tag == tag && s.secure == secure)
+                    return s.blk;
+                i = (i + 1) & tableMask;
+                dist++;
+            }
+        }
+
+        void
+        insert(Addr tag, bool secure, FALRUBlk *entry)
+        {
+            Slot cur = {tag, entry, 0, secure};
+            size_t i = hash(tag, secure) & tableMask;
+            while (true) {
+                Slot &s = slots[i];
+                if (!s.blk) {
+                    s = cur;
+                    return;
+                }
+                if (s.tag == cur.tag && s.secure == cur.secure) {
+                    s.blk = cur.blk;
+                    return;
+                }
+                if (s.dist < cur.dist)
+                    std::swap(s, cur);
+                i = (i + 1) & tableMask;
+                cur.dist++;
+            }
         }
+
+        /** Returns the number of entries removed (0 or 1), so the
+         *  caller's missing-key sanity assert keeps its teeth. */
+        std::size_t
+        erase(Addr tag, bool secure)
+        {
+            size_t i = hash(tag, secure) & tableMask;
+            uint16_t dist = 0;
+            while (true) {
+                Slot &s = slots[i];
+                if (!s.blk || s.dist < dist)
+                    return 0;
+                if (s.tag == tag && s.secure == secure)
+                    break;
+                i = (i + 1) & tableMask;
+                dist++;
+            }
+
+            // backward-shift the displaced tail of the cluster
+            size_t j = (i + 1) & tableMask;
+            while (slots[j].blk && slots[j].dist > 0) {
+                slots[i] = slots[j];
+                slots[i].dist--;
+                i = j;
+                j = (j + 1) & tableMask;
+            }
+            slots[i].blk = nullptr;
+            return 1;
+        }
+
+      private:
+        struct Slot
+        {
+            Addr tag = 0;
+            FALRUBlk *blk = nullptr;
+            uint16_t dist = 0;
+            bool secure = false;
+        };
+
+        static size_t
+        hash(Addr tag, bool secure)
+        {
+            uint64_t x = tag * 0x9e3779b97f4a7c15ULL + secure;
+            x ^= x >> 29;
+            return x;
+        }
+
+        std::vector<Slot> slots;
+        size_t tableMask = 0;
     };
-    typedef std::pair<Addr, bool> TagHashKey;
-    typedef std::unordered_map<TagHashKey, FALRUBlk *, PairHash> TagHash;
 
     /** The address hash table. */
     TagHash tagHash;
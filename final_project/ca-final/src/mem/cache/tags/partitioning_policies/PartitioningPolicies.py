@@ -95,6 +95,23 @@ class WayPartitioningPolicy(BasePartitioningPolicy):
     )
 
 
+class DynamicWayPartitioningPolicy(WayPartitioningPolicy):
+    type = "DynamicWayPartitioningPolicy"
+    cxx_header = "mem/cache/tags/partitioning_policies/dynamic_way_pp.hh"
+    cxx_class = "gem5::partitioning_policy::DynamicWayPartitioningPolicy"
+
+    # Ways are redistributed every interval proportionally to each
+    # partition's fills (misses) in the previous interval, with a
+    # per-partition floor. The allocations parameter seeds both the
+    # controlled partition set and the starting assignment.
+    repartition_interval = Param.Latency(
+        "1ms", "Interval between way repartitionings"
+    )
+    min_ways = Param.Unsigned(
+        1, "Minimum ways every controlled partition keeps"
+    )
+
+
 class MaxCapacityPartitioningPolicy(BasePartitioningPolicy):
     type = "MaxCapacityPartitioningPolicy"
     cxx_header = "mem/cache/tags/partitioning_policies/max_capacity_pp.hh"
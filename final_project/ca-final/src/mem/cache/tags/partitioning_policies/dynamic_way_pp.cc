@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/partitioning_policies/dynamic_way_pp.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "debug/PartitionPolicy.hh"
+#include "mem/cache/tags/partitioning_policies/way_allocation.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+DynamicWayPartitioningPolicy::DynamicWayPartitioningPolicy(
+    const DynamicWayPartitioningPolicyParams &params)
+    : WayPartitioningPolicy(params),
+      repartitionInterval(params.repartition_interval),
+      cacheAssoc(params.cache_associativity),
+      minWays(params.min_ways),
+      wayOwner(params.cache_associativity),
+      repartitionEvent([this]{ repartition(); }, name())
+{
+    // the initial allocations seed the controlled partition set and
+    // the starting ownership
+    for (const auto allocation : params.allocations) {
+        const uint64_t id = allocation->getPartitionId();
+        partitionIds.push_back(id);
+        missCounts[id] = 0;
+        for (const auto way : allocation->getWays())
+            wayOwner[way] = id;
+    }
+
+    fatal_if(partitionIds.empty(),
+             "%s: dynamic repartitioning needs at least one allocation",
+             name());
+    fatal_if(minWays * partitionIds.size() > cacheAssoc,
+             "%s: min_ways (%d) cannot be honoured for %d partitions in "
+             "%d ways", name(), minWays, partitionIds.size(), cacheAssoc);
+}
+
+void
+DynamicWayPartitioningPolicy::startup()
+{
+    WayPartitioningPolicy::startup();
+    schedule(repartitionEvent, curTick() + repartitionInterval);
+}
+
+void
+DynamicWayPartitioningPolicy::notifyAcquire(const uint64_t partition_id)
+{
+    const auto it = missCounts.find(partition_id);
+    if (it != missCounts.end())
+        it->second++;
+}
+
+void
+DynamicWayPartitioningPolicy::repartition()
+{
+    // distribute ways proportionally to the epoch's miss counts,
+    // with the configured floor; remainders go to the hungriest
+    // partitions in deterministic parameter order
+    uint64_t total = 0;
+    for (const auto id : partitionIds)
+        total += missCounts[id];
+
+    // a quiet epoch carries no demand information; keep the current
+    // assignment rather than collapsing onto an arbitrary partition
+    if (total == 0) {
+        schedule(repartitionEvent, curTick() + repartitionInterval);
+        return;
+    }
+
+    const unsigned flex = cacheAssoc - minWays * partitionIds.size();
+    std::vector<std::pair<uint64_t, unsigned>> shares;
+    unsigned assigned = 0;
+    for (const auto id : partitionIds) {
+        const unsigned extra =
+            total ? (flex * missCounts[id]) / total : 0;
+        shares.emplace_back(id, minWays + extra);
+        assigned += minWays + extra;
+    }
+    // hand out rounding leftovers by demand, parameter order on ties
+    while (assigned < cacheAssoc) {
+        auto best = shares.begin();
+        for (auto it = shares.begin(); it != shares.end(); ++it) {
+            if (missCounts[it->first] > missCounts[best->first])
+                best = it;
+        }
+        best->second++;
+        assigned++;
+    }
+
+    // realize the target assignment left to right; only changed ways
+    // touch the underlying policy
+    unsigned way = 0;
+    for (const auto &share : shares) {
+        for (unsigned i = 0; i < share.second; i++, way++) {
+            if (wayOwner[way] == share.first)
+                continue;
+            removeWayToPartition(wayOwner[way], way);
+            addWayToPartition(share.first, way);
+            DPRINTF(PartitionPolicy,
+                    "Reassigning way %d: PartitionID %d -> %d\n",
+                    way, wayOwner[way], share.first);
+            wayOwner[way] = share.first;
+        }
+    }
+
+    // age the demand signal so the next epoch adapts but does not
+    // thrash on transient spikes
+    for (auto &count : missCounts)
+        count.second /= 2;
+
+    schedule(repartitionEvent, curTick() + repartitionInterval);
+}
+
+} // namespace partitioning_policy
+
+} // namespace gem5
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CACHE_TAGS_PARTITIONING_POLICIES_DYNAMIC_WAY_HH__
+#define __MEM_CACHE_TAGS_PARTITIONING_POLICIES_DYNAMIC_WAY_HH__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "mem/cache/tags/partitioning_policies/way_pp.hh"
+#include "params/DynamicWayPartitioningPolicy.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace partitioning_policy
+{
+
+/**
+ * A WayPartitioningPolicy whose way assignment is recomputed
+ * periodically from measured per-partition demand. Block
+ * acquisitions (cache fills, i.e. misses) are counted per partition
+ * through the existing notifyAcquire() flow; every repartition
+ * interval the ways are redistributed proportionally to the decayed
+ * miss counts, with a configurable floor per partition. The initial
+ * allocations parameter seeds both the partition set and the
+ * starting assignment.
+ */
+class DynamicWayPartitioningPolicy : public WayPartitioningPolicy
+{
+  public:
+    DynamicWayPartitioningPolicy(
+        const DynamicWayPartitioningPolicyParams &params);
+
+    void startup() override;
+
+    /** Count fills per partition as the demand signal. */
+    void notifyAcquire(const uint64_t partition_id) override;
+
+  private:
+    /** Recompute the way assignment from the decayed miss counts. */
+    void repartition();
+
+    const Tick repartitionInterval;
+    const unsigned cacheAssoc;
+    const unsigned minWays;
+
+    /** Partitions under control, in parameter order (ties broken
+     * deterministically in this order). */
+    std::vector<uint64_t> partitionIds;
+
+    /** Decayed per-partition fill counts for the current epoch. */
+    std::unordered_map<uint64_t, uint64_t> missCounts;
+
+    /** Current owner partition of each way. */
+    std::vector<uint64_t> wayOwner;
+
+    EventFunctionWrapper repartitionEvent;
+};
+
+} // namespace partitioning_policy
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_PARTITIONING_POLICIES_DYNAMIC_WAY_HH__
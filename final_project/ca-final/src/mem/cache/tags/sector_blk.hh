@@ -136,10 +136,13 @@ class SectorBlk : public TaggedEntry
 {
   private:
     /**
-     * Counter of the number of valid sub-blocks. The sector is valid if any
-     * of its sub-blocks is valid.
+     * Bitmap of the valid sub-blocks, indexed by sector offset. The
+     * sector is valid if any of its sub-blocks is valid, and keeping
+     * the occupancy as a bitmap lets co-allocation searches test a
+     * candidate offset with one bit operation instead of chasing the
+     * sub-block pointer.
      */
-    uint8_t _validCounter;
+    uint64_t _validMask;
 
   public:
     SectorBlk();
@@ -165,14 +168,24 @@ class SectorBlk : public TaggedEntry
     uint8_t getNumValid() const;
 
     /**
-     * Increase the number of valid sub-blocks.
+     * Check whether the sub-block at the given sector offset is
+     * valid, without touching the sub-block itself.
      */
-    void validateSubBlk();
+    bool isSubBlkValid(int offset) const;
 
     /**
-     * Decrease the number of valid sub-blocks.
+     * Mark a sub-block as valid.
+     *
+     * @param offset The validated sub-block's sector offset.
+     */
+    void validateSubBlk(int offset);
+
+    /**
+     * Mark a sub-block as invalid.
+     *
+     * @param offset The invalidated sub-block's sector offset.
      */
-    void invalidateSubBlk();
+    void invalidateSubBlk(int offset);
 
     /**
      * Sets the position of the sub-entries, besides its own.
@@ -77,6 +77,8 @@ SectorTags::SectorTags(const SectorTagsParams &p)
              "Block size must be at least 4 and a power of 2");
     fatal_if(!isPowerOf2(numBlocksPerSector),
              "# of blocks per sector must be non-zero and a power of 2");
+    fatal_if(numBlocksPerSector > 64,
+             "The sector occupancy bitmap supports at most 64 sub-blocks");
     warn_if(partitionManager,
              "Using cache partitioning policies with sector and/or compressed "
              "tags is not fully tested.");
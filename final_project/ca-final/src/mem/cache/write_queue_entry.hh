@@ -75,7 +75,8 @@ class WriteQueueEntry : public QueueEntry, public Printable
     friend class WriteQueue;
 
   public:
-    class TargetList : public std::list<Target>
+    class TargetList :
+        public std::list<Target, PooledNodeAllocator<Target>>
     {
 
       public:
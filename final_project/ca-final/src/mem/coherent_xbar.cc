@@ -106,6 +106,19 @@ CoherentXBar::CoherentXBar(const CoherentXBarParams &p)
                                            csprintf("respLayer%d", i)));
         snoopRespPorts.push_back(new SnoopRespPort(*bp, *this));
     }
+
+    // hand any configured arbitration weights to the request layers,
+    // which arbitrate among the CPU-side ports
+    if (!p.port_weights.empty()) {
+        fatal_if(p.port_weights.size() != cpuSidePorts.size(),
+                 "%s: port_weights must have one entry per cpu_side_port "
+                 "(%d != %d)", name(), p.port_weights.size(),
+                 cpuSidePorts.size());
+        for (auto* layer : reqLayers) {
+            for (unsigned i = 0; i < cpuSidePorts.size(); ++i)
+                layer->setPortWeight(cpuSidePorts[i], p.port_weights[i]);
+        }
+    }
 }
 
 CoherentXBar::~CoherentXBar()
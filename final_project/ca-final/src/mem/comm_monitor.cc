@@ -105,6 +105,8 @@ CommMonitor::MonitorStats::MonitorStats(statistics::Group *parent,
                                         const CommMonitorParams &params)
     : statistics::Group(parent),
 
+      // clamp 0 to 1 so a careless config cannot zero-weight samples
+      sampleInterval(params.sample_interval ? params.sample_interval : 1),
       disableBurstLengthHists(params.disable_burst_length_hists),
       ADD_STAT(readBurstLengthHist, statistics::units::Byte::get(),
                "Histogram of burst lengths of transmitted packets"),
@@ -260,28 +262,39 @@ CommMonitor::MonitorStats::updateReqStats(
     const probing::PacketInfo& pkt_info, bool is_atomic,
     bool expects_response)
 {
+    // 1-in-N statistical sampling of the histogram updates; the
+    // exact accumulators below are updated for every packet
+    const bool sampled = (++reqSampleCount >= sampleInterval);
+    if (sampled)
+        reqSampleCount = 0;
+
     if (pkt_info.cmd.isRead()) {
         // Increment number of observed read transactions
         if (!disableTransactionHists)
             ++readTrans;
 
         // Get sample of burst length
-        if (!disableBurstLengthHists)
-            readBurstLengthHist.sample(pkt_info.size);
+        if (sampled && !disableBurstLengthHists)
+            readBurstLengthHist.sample(pkt_info.size, sampleInterval);
 
         // Sample the masked address
-        if (!disableAddrDists)
-            readAddrDist.sample(pkt_info.addr & readAddrMask);
+        if (sampled && !disableAddrDists)
+            readAddrDist.sample(pkt_info.addr & readAddrMask,
+                                sampleInterval);
 
         if (!disableITTDists) {
-            // Sample value of read-read inter transaction time
-            if (timeOfLastRead != 0)
-                ittReadRead.sample(curTick() - timeOfLastRead);
+            // Sample value of read-read inter transaction time;
+            // the timestamps track every packet so a sampled gap is
+            // still a true consecutive-transaction gap
+            if (sampled && timeOfLastRead != 0)
+                ittReadRead.sample(curTick() - timeOfLastRead,
+                                   sampleInterval);
             timeOfLastRead = curTick();
 
             // Sample value of req-req inter transaction time
-            if (timeOfLastReq != 0)
-                ittReqReq.sample(curTick() - timeOfLastReq);
+            if (sampled && timeOfLastReq != 0)
+                ittReqReq.sample(curTick() - timeOfLastReq,
+                                 sampleInterval);
             timeOfLastReq = curTick();
         }
         if (!is_atomic && !disableOutstandingHists && expects_response)
@@ -292,8 +305,8 @@ CommMonitor::MonitorStats::updateReqStats(
         if (!disableTransactionHists)
             ++writeTrans;
 
-        if (!disableBurstLengthHists)
-            writeBurstLengthHist.sample(pkt_info.size);
+        if (sampled && !disableBurstLengthHists)
+            writeBurstLengthHist.sample(pkt_info.size, sampleInterval);
 
         // Update the bandwidth stats on the request
         if (!disableBandwidthHists) {
@@ -302,18 +315,21 @@ CommMonitor::MonitorStats::updateReqStats(
         }
 
         // Sample the masked write address
-        if (!disableAddrDists)
-            writeAddrDist.sample(pkt_info.addr & writeAddrMask);
+        if (sampled && !disableAddrDists)
+            writeAddrDist.sample(pkt_info.addr & writeAddrMask,
+                                 sampleInterval);
 
         if (!disableITTDists) {
             // Sample value of write-to-write inter transaction time
-            if (timeOfLastWrite != 0)
-                ittWriteWrite.sample(curTick() - timeOfLastWrite);
+            if (sampled && timeOfLastWrite != 0)
+                ittWriteWrite.sample(curTick() - timeOfLastWrite,
+                                     sampleInterval);
             timeOfLastWrite = curTick();
 
             // Sample value of req-to-req inter transaction time
-            if (timeOfLastReq != 0)
-                ittReqReq.sample(curTick() - timeOfLastReq);
+            if (sampled && timeOfLastReq != 0)
+                ittReqReq.sample(curTick() - timeOfLastReq,
+                                 sampleInterval);
             timeOfLastReq = curTick();
         }
 
@@ -326,6 +342,12 @@ void
 CommMonitor::MonitorStats::updateRespStats(
     const probing::PacketInfo& pkt_info, Tick latency, bool is_atomic)
 {
+    // 1-in-N statistical sampling of the latency histograms; the
+    // outstanding and byte accounting below stays exact
+    const bool sampled = (++respSampleCount >= sampleInterval);
+    if (sampled)
+        respSampleCount = 0;
+
     if (pkt_info.cmd.isRead()) {
         // Decrement number of outstanding read requests
         if (!is_atomic && !disableOutstandingHists) {
@@ -333,8 +355,8 @@ CommMonitor::MonitorStats::updateRespStats(
             --outstandingReadReqs;
         }
 
-        if (!disableLatencyHists)
-            readLatencyHist.sample(latency);
+        if (sampled && !disableLatencyHists)
+            readLatencyHist.sample(latency, sampleInterval);
 
         // Update the bandwidth stats based on responses for reads
         if (!disableBandwidthHists) {
@@ -349,8 +371,8 @@ CommMonitor::MonitorStats::updateRespStats(
             --outstandingWriteReqs;
         }
 
-        if (!disableLatencyHists)
-            writeLatencyHist.sample(latency);
+        if (sampled && !disableLatencyHists)
+            writeLatencyHist.sample(latency, sampleInterval);
     }
 }
 
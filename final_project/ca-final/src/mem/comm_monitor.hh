@@ -272,6 +272,21 @@ class CommMonitor : public SimObject
     /** Stats declarations, all in a struct for convenience. */
     struct MonitorStats : public statistics::Group
     {
+        /**
+         * Update the histogram-class stats for one in this many
+         * packets, each sample carrying the interval as its weight
+         * so the aggregate distributions stay unbiased. Cheap exact
+         * accumulators (transaction and byte counts, outstanding
+         * trackers, last-transaction timestamps) ignore it.
+         */
+        const unsigned sampleInterval;
+
+        /** Packets seen since the last request-side sample. */
+        unsigned reqSampleCount = 0;
+
+        /** Responses seen since the last latency sample. */
+        unsigned respSampleCount = 0;
+
         /** Disable flag for burst length histograms **/
         bool disableBurstLengthHists;
 
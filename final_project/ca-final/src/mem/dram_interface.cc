@@ -90,8 +90,8 @@ DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
         // select optimal DRAM packet in Q
         if (pkt->isDram() && (pkt->pseudoChannel == pseudoChannel)) {
             const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
-            const Tick col_allowed_at = pkt->isRead() ? bank.rdAllowedAt :
-                                                        bank.wrAllowedAt;
+            const Tick col_allowed_at =
+                burstAllowedAt(pkt->isRead(), pkt->rank, bank);
 
             DPRINTF(DRAM, "%s checking DRAM packet in bank %d, row %d\n",
                     __func__, pkt->bank, pkt->row);
@@ -368,6 +368,9 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
 
     // for the state we need to track if it is a row hit or not
     bool row_hit = true;
+    const bool bank_conflict =
+        bank_ref.openRow != Bank::NO_ROW &&
+        bank_ref.openRow != mem_pkt->row;
 
     // Determine the access latency and update the bank state
     if (bank_ref.openRow == mem_pkt->row) {
@@ -390,8 +393,8 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
     }
 
     // respect any constraints on the command (e.g. tRCD or tCCD)
-    const Tick col_allowed_at = mem_pkt->isRead() ?
-                                bank_ref.rdAllowedAt : bank_ref.wrAllowedAt;
+    const Tick col_allowed_at =
+        burstAllowedAt(mem_pkt->isRead(), mem_pkt->rank, bank_ref);
 
     // we need to wait until the bus is available before we can issue
     // the command; need to ensure minimum bus delay requirement is met
@@ -432,15 +435,17 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
 
     rank_ref.lastBurstTick = cmd_at;
 
-    // update the time for the next read/write burst for each
-    // bank (add a max with tCCD/tCCD_L/tCCD_L_WR here)
+    // update the time for the next read/write burst: the delay only
+    // depends on the (rank, bank group) relation to this burst, so
+    // update the per-class floors instead of every bank
+    // (tCCD/tCCD_L/tCCD_L_WR are applied here)
     Tick dly_to_rd_cmd;
     Tick dly_to_wr_cmd;
+    const unsigned groups = bankGroupArch ? bankGroupsPerRank : 1;
     for (int j = 0; j < ranksPerChannel; j++) {
-        for (int i = 0; i < banksPerRank; i++) {
+        for (unsigned g = 0; g < groups; g++) {
             if (mem_pkt->rank == j) {
-                if (bankGroupArch &&
-                   (bank_ref.bankgr == ranks[j]->banks[i].bankgr)) {
+                if (bankGroupArch && (bank_ref.bankgr == g)) {
                     // bank group architecture requires longer delays between
                     // RD/WR burst commands to the same bank group.
                     // tCCD_L is default requirement for same BG timing
@@ -466,11 +471,23 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
                 dly_to_wr_cmd = rankToRankDelay();
                 dly_to_rd_cmd = rankToRankDelay();
             }
-            ranks[j]->banks[i].rdAllowedAt = std::max(cmd_at + dly_to_rd_cmd,
-                                             ranks[j]->banks[i].rdAllowedAt);
-            ranks[j]->banks[i].wrAllowedAt = std::max(cmd_at + dly_to_wr_cmd,
-                                             ranks[j]->banks[i].wrAllowedAt);
+            rdBurstFloor[j][g] =
+                std::max(cmd_at + dly_to_rd_cmd, rdBurstFloor[j][g]);
+            wrBurstFloor[j][g] =
+                std::max(cmd_at + dly_to_wr_cmd, wrBurstFloor[j][g]);
+        }
+    }
+
+    {
+        // feed the controller's per-requestor locality accounting
+        unsigned busy_banks = 0;
+        const auto &pending = mem_pkt->isRead() ? bankPendingReads
+                                                : bankPendingWrites;
+        for (const auto &count : pending) {
+            if (count > 0)
+                busy_banks++;
         }
+        ctrl->recordRowOutcome(mem_pkt, row_hit, bank_conflict, busy_banks);
     }
 
     // Save rank of current access
@@ -620,15 +637,16 @@ void
 DRAMInterface::addRankToRankDelay(Tick cmd_at)
 {
     // update timing for DRAM ranks due to bursts issued
-    // to ranks on other media interfaces
-    for (auto n : ranks) {
-        for (int i = 0; i < banksPerRank; i++) {
-            // different rank by default
-            // Need to only account for rank-to-rank switching
-            n->banks[i].rdAllowedAt = std::max(cmd_at + rankToRankDelay(),
-                                             n->banks[i].rdAllowedAt);
-            n->banks[i].wrAllowedAt = std::max(cmd_at + rankToRankDelay(),
-                                             n->banks[i].wrAllowedAt);
+    // to ranks on other media interfaces; uniform across the channel,
+    // so it only has to raise the burst floors
+    for (auto &rank_floor : rdBurstFloor) {
+        for (auto &floor : rank_floor) {
+            floor = std::max(cmd_at + rankToRankDelay(), floor);
+        }
+    }
+    for (auto &rank_floor : wrBurstFloor) {
+        for (auto &floor : rank_floor) {
+            floor = std::max(cmd_at + rankToRankDelay(), floor);
         }
     }
 }
@@ -660,6 +678,13 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
       lastStatsResetTick(0),
       stats(*this)
 {
+    bankPendingReads.resize(ranksPerChannel * banksPerRank, 0);
+    bankPendingWrites.resize(ranksPerChannel * banksPerRank, 0);
+
+    const unsigned groups = bankGroupArch ? bankGroupsPerRank : 1;
+    rdBurstFloor.assign(ranksPerChannel, std::vector<Tick>(groups, 0));
+    wrBurstFloor.assign(ranksPerChannel, std::vector<Tick>(groups, 0));
+
     DPRINTF(DRAM, "Setting up DRAM Interface\n");
 
     fatal_if(!isPowerOf2(burstSize), "DRAM burst size %d is not allowed, "
@@ -696,6 +721,8 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
 
     rowsPerBank = capacity / (rowBufferSize * banksPerRank * ranksPerChannel);
 
+    compileDecodeProgram();
+
     // some basic sanity checks
     if (tREFI <= tRP || tREFI <= tRFC) {
         fatal("tREFI (%d) must be larger than tRP (%d) and tRFC (%d)\n",
@@ -831,6 +858,44 @@ DRAMInterface::isBusy(bool read_queue_empty, bool all_writes_nvm)
     return (busy_ranks == ranksPerChannel);
 }
 
+void
+DRAMInterface::compileDecodeProgram()
+{
+    if (!isPowerOf2(burstSize) || !isPowerOf2(burstsPerRowBuffer) ||
+        !isPowerOf2(banksPerRank) || !isPowerOf2(ranksPerChannel) ||
+        !isPowerOf2(rowsPerBank) || !isPowerOf2(burstsPerStripe)) {
+        return;
+    }
+
+    const unsigned bank_bits = floorLog2(banksPerRank);
+    const unsigned rank_bits = floorLog2(ranksPerChannel);
+
+    decodeProg.burstShift = floorLog2(burstSize);
+
+    if (addrMapping == enums::RoRaBaChCo ||
+        addrMapping == enums::RoRaBaCoCh) {
+        const unsigned col_bits = floorLog2(burstsPerRowBuffer);
+        decodeProg.bankShift = col_bits;
+        decodeProg.rankShift = col_bits + bank_bits;
+        decodeProg.rowShift = col_bits + bank_bits + rank_bits;
+    } else if (addrMapping == enums::RoCoRaBaCh) {
+        const unsigned low_col_bits =
+            burstsPerStripe > burstsPerRowBuffer ?
+            floorLog2(burstsPerRowBuffer) : floorLog2(burstsPerStripe);
+        const unsigned high_col_bits =
+            burstsPerStripe < burstsPerRowBuffer ?
+            floorLog2(burstsPerRowBuffer / burstsPerStripe) : 0;
+        decodeProg.bankShift = low_col_bits;
+        decodeProg.rankShift = low_col_bits + bank_bits;
+        decodeProg.rowShift =
+            low_col_bits + bank_bits + rank_bits + high_col_bits;
+    } else {
+        return;
+    }
+
+    decodeProg.valid = true;
+}
+
 MemPacket*
 DRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
                        unsigned size, bool is_read, uint8_t pseudo_channel)
@@ -847,6 +912,24 @@ DRAMInterface::decodePacket(const PacketPtr pkt, Addr pkt_addr,
     // Get packed address, starting at 0
     Addr addr = getCtrlAddr(pkt_addr);
 
+    if (decodeProg.valid) {
+        // precompiled shift/mask extraction for power-of-two
+        // geometries; equivalent to the div/mod chain below
+        const Addr a = addr >> decodeProg.burstShift;
+        bank = (a >> decodeProg.bankShift) & (banksPerRank - 1);
+        rank = (a >> decodeProg.rankShift) & (ranksPerChannel - 1);
+        row = (a >> decodeProg.rowShift) & (rowsPerBank - 1);
+
+        assert(row < Bank::NO_ROW);
+
+        DPRINTF(DRAM, "Address: %#x Rank %d Bank %d Row %d\n",
+                pkt_addr, rank, bank, row);
+
+        const uint16_t bank_id = banksPerRank * rank + bank;
+        return new MemPacket(pkt, is_read, true, pseudo_channel, rank,
+                             bank, row, bank_id, pkt_addr, size);
+    }
+
     // truncate the address to a memory burst, which makes it unique to
     // a specific buffer, row, bank, rank and channel
     addr = addr / burstSize;
@@ -927,6 +1010,21 @@ void DRAMInterface::setupRank(const uint8_t rank, const bool is_read)
     }
 }
 
+void
+DRAMInterface::trackQueued(const MemPacket *pkt, bool is_read, bool queued)
+{
+    if (!pkt->isDram())
+        return;
+
+    auto &pending = is_read ? bankPendingReads : bankPendingWrites;
+    if (queued) {
+        pending[pkt->bankId]++;
+    } else {
+        assert(pending[pkt->bankId] > 0);
+        pending[pkt->bankId]--;
+    }
+}
+
 void
 DRAMInterface::respondEvent(uint8_t rank)
 {
@@ -1038,14 +1136,28 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // delay on the data bus
     bool hidden_bank_prep = false;
 
-    // determine if we have queued transactions targetting the
-    // bank in question
+    // Determine if we have queued transactions targetting the bank
+    // in question. With a single QoS priority the incrementally
+    // maintained per-bank occupancy replaces the queue scan; the
+    // refresh-idle condition is applied at use below either way.
+    const bool use_counts = ctrl->numPriorities() == 1;
+    const std::vector<uint32_t> &pending =
+        ctrl->inReadBusState(false, this) ? bankPendingReads
+                                          : bankPendingWrites;
+
     std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
-            continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
+    if (use_counts) {
+        for (int i = 0; i < ranksPerChannel * banksPerRank; i++) {
+            got_waiting[i] = pending[i] > 0 &&
+                ranks[i / banksPerRank]->inRefIdleState();
+        }
+    } else {
+        for (const auto& p : queue) {
+            if (p->pseudoChannel != pseudoChannel)
+                continue;
+            if (p->isDram() && ranks[p->rank]->inRefIdleState())
+                got_waiting[p->bankId] = true;
+        }
     }
 
     // Find command with optimal bank timing
@@ -1074,10 +1186,9 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
                             std::max(min_col_at - tRCD, curTick());
 
                 // When is the earliest the R/W burst can issue?
-                const Tick col_allowed_at = ctrl->inReadBusState(false,
-                                              this) ?
-                                              ranks[i]->banks[j].rdAllowedAt :
-                                              ranks[i]->banks[j].wrAllowedAt;
+                const Tick col_allowed_at = burstAllowedAt(
+                        ctrl->inReadBusState(false, this), i,
+                        ranks[i]->banks[j]);
                 Tick col_at = std::max(col_allowed_at, act_at + tRCD);
 
                 // bank can issue burst back-to-back (seamlessly) with
@@ -635,6 +635,61 @@ class DRAMInterface : public MemInterface
       */
     std::vector<Rank*> ranks;
 
+    /**
+     * Incrementally maintained count of queued packets per bank
+     * (rank * banksPerRank + bank), split by read/write, replacing
+     * the per-decision queue scan in minBankPrep(). Only consulted
+     * when a single QoS priority is configured, since the counts
+     * aggregate across priority queues.
+     */
+    std::vector<uint32_t> bankPendingReads;
+    std::vector<uint32_t> bankPendingWrites;
+
+    /**
+     * Memoized channel-wide burst constraints. A burst constrains
+     * every bank's next read/write time, but the delay only depends
+     * on the (rank, bank group) relation to the issuing burst, so
+     * instead of rewriting rd/wrAllowedAt for every bank per burst
+     * the per-(rank, bank group) floors are updated and applied as a
+     * lower bound where the per-bank times are consumed
+     * (burstAllowedAt()). The per-bank fields keep carrying the
+     * bank-local constraints (activation, wake-up).
+     */
+    std::vector<std::vector<Tick>> rdBurstFloor;
+    std::vector<std::vector<Tick>> wrBurstFloor;
+
+    /**
+     * Precompiled shift/mask decode program. When every geometry
+     * factor (burst size, bursts per row buffer and stripe, banks,
+     * ranks, rows) is a power of two -- true for every shipped
+     * configuration -- the per-packet div/mod chain in decodePacket()
+     * collapses to three shift-and-mask extractions compiled here at
+     * init time. Non-power-of-two geometries keep the generic chain.
+     */
+    struct DecodeProgram
+    {
+        bool valid = false;
+        unsigned burstShift = 0;
+        unsigned bankShift = 0;
+        unsigned rankShift = 0;
+        unsigned rowShift = 0;
+    };
+    DecodeProgram decodeProg;
+
+    /** Compile decodeProg from the configured geometry. */
+    void compileDecodeProgram();
+
+    /** Effective next-allowed burst time for a bank. */
+    Tick
+    burstAllowedAt(bool is_read, uint8_t rank, const Bank &bank_ref) const
+    {
+        const Tick local = is_read ? bank_ref.rdAllowedAt
+                                   : bank_ref.wrAllowedAt;
+        const auto &floor = is_read ? rdBurstFloor : wrBurstFloor;
+        return std::max(local,
+                        floor[rank][bankGroupArch ? bank_ref.bankgr : 0]);
+    }
+
     /*
      * @return delay between write and read commands
      */
@@ -681,6 +736,9 @@ class DRAMInterface : public MemInterface
      */
     void setupRank(const uint8_t rank, const bool is_read) override;
 
+    void trackQueued(const MemPacket *pkt, bool is_read,
+                     bool queued) override;
+
     MemPacket* decodePacket(const PacketPtr pkt, Addr pkt_addr,
                            unsigned int size, bool is_read,
                            uint8_t pseudo_channel = 0) override;
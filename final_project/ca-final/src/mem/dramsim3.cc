@@ -37,6 +37,7 @@
 
 #include "mem/dramsim3.hh"
 
+#include "base/intmath.hh"
 #include "base/callback.hh"
 #include "base/trace.hh"
 #include "debug/DRAMsim3.hh"
@@ -60,7 +61,8 @@ DRAMsim3::DRAMsim3(const Params &p) :
     retryReq(false), retryResp(false), startTick(0),
     nbrOutstandingReads(0), nbrOutstandingWrites(0),
     sendResponseEvent([this]{ sendResponse(); }, name()),
-    tickEvent([this]{ tick(); }, name())
+    tickEvent([this]{ tick(); }, name()),
+    idleTickElision(p.idle_tick_elision)
 {
     DPRINTF(DRAMsim3,
             "Instantiated DRAMsim3 with clock %d ns and queue size %d\n",
@@ -93,6 +95,7 @@ DRAMsim3::startup()
     startTick = curTick();
 
     // kick off the clock ticks
+    tickActive = true;
     schedule(tickEvent, clockEdge());
 }
 
@@ -152,10 +155,27 @@ DRAMsim3::tick()
         }
     }
 
+    if (idleTickElision && nbrOutstanding() == 0 && !retryReq) {
+        // completely idle: pause the clock; recvTimingReq restarts it
+        tickActive = false;
+        return;
+    }
+
     schedule(tickEvent,
         curTick() + wrapper.clockPeriod() * sim_clock::as_int::ns);
 }
 
+void
+DRAMsim3::resumeTick()
+{
+    if (tickActive)
+        return;
+
+    tickActive = true;
+    const Tick period = wrapper.clockPeriod() * sim_clock::as_int::ns;
+    schedule(tickEvent, divCeil(curTick(), period) * period);
+}
+
 Tick
 DRAMsim3::recvAtomic(PacketPtr pkt)
 {
@@ -182,6 +202,8 @@ DRAMsim3::recvFunctional(PacketPtr pkt)
 bool
 DRAMsim3::recvTimingReq(PacketPtr pkt)
 {
+    resumeTick();
+
     // if a cache is responding, sink the packet without further action
     if (pkt->cacheResponding()) {
         pendingDelete.reset(pkt);
@@ -173,6 +173,21 @@ class DRAMsim3 : public AbstractMemory
      */
     EventFunctionWrapper tickEvent;
 
+    /**
+     * Pause the DRAMsim3 clock while the controller is completely
+     * idle (nothing outstanding, no retry pending) instead of firing
+     * a no-op event every memory clock. Trades exact refresh timing
+     * during idle periods for removing the per-clock event churn;
+     * off by default.
+     */
+    const bool idleTickElision;
+
+    /** Whether tickEvent is currently self-rescheduling. */
+    bool tickActive = false;
+
+    /** (Re)start the DRAMsim3 clock aligned to its period. */
+    void resumeTick();
+
     /**
      * Upstream caches need this packet until true is returned, so
      * hold it for deletion until a subsequent call
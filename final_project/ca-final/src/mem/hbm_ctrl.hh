@@ -60,6 +60,16 @@ class DRAMInterface;
  * This HBM memory controller inherits from gem5's default
  * memory controller (pseudo channel 0) and manages the additional HBM pseudo
  * channel (pseudo channel 1).
+ *
+ * Scheduling is NOT serialized through one event stream: each pseudo
+ * channel has its own request and response events (nextReqEvent /
+ * nextReqEventPC1 and respondEvent / respondEventPC1) and its own
+ * queue-occupancy accounting on its interface, with only the shared
+ * row/column command-bus contention (rowBurstTicks / colBurstTicks)
+ * coupling them -- which is physical, not a simulator artifact. Wide
+ * HBM3 stacks are composed from these pairs: a 16-pseudo-channel
+ * configuration instantiates eight HBMCtrls, each pair scheduling
+ * independently on its own events.
  */
 class HBMCtrl : public MemCtrl
 {
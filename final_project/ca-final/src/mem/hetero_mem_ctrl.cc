@@ -40,6 +40,7 @@
 
 #include "mem/hetero_mem_ctrl.hh"
 
+#include "base/intmath.hh"
 #include "base/trace.hh"
 #include "debug/DRAM.hh"
 #include "debug/Drain.hh"
@@ -57,10 +58,21 @@ namespace gem5
 namespace memory
 {
 
-HeteroMemCtrl::HeteroMemCtrl(const HeteroMemCtrlParams &p) :
+HeteroMemCtrl::HeteroMemCtrl(const HeteroMemCtrlParams &p)
+    :
     MemCtrl(p),
-    nvm(p.nvm)
+    nvm(p.nvm),
+      hotPageTracking(p.hot_page_tracking),
+      hotPageSize(p.hot_page_size),
+      hotPageThreshold(p.hot_page_threshold),
+      hotPageTableSize(p.hot_page_table_size),
+      decayEvent([this] { decayHotPages(); }, name()),
+      decayInterval(p.hot_page_decay_interval),
+      heteroStats(this)
 {
+    fatal_if(hotPageTracking && !isPowerOf2(hotPageSize),
+             "hot_page_size must be a power of two");
+
     DPRINTF(MemCtrl, "Setting up controller\n");
     readQueue.resize(p.qos_priorities);
     writeQueue.resize(p.qos_priorities);
@@ -128,6 +140,9 @@ HeteroMemCtrl::recvTimingReq(PacketPtr pkt)
         is_dram = true;
     } else if (nvm->getAddrRange().contains(pkt->getAddr())) {
         is_dram = false;
+        if (hotPageTracking) {
+            trackNvmAccess(pkt->getAddr());
+        }
     } else {
         panic("Can't handle address range for packet %s\n",
               pkt->print());
@@ -465,5 +480,96 @@ HeteroMemCtrl::getAddrRanges()
     return ranges;
 }
 
+
+void
+HeteroMemCtrl::startup()
+{
+    MemCtrl::startup();
+
+    if (hotPageTracking) {
+        schedule(decayEvent, curTick() + decayInterval);
+    }
+}
+
+void
+HeteroMemCtrl::trackNvmAccess(Addr addr)
+{
+    const Addr page = addr & ~(hotPageSize - 1);
+
+    auto it = hotPages.find(page);
+    if (it == hotPages.end()) {
+        if (hotPages.size() >= hotPageTableSize) {
+            // evict the coldest tracked page
+            auto coldest = hotPages.begin();
+            for (auto probe = hotPages.begin(); probe != hotPages.end();
+                 ++probe) {
+                if (probe->second.count < coldest->second.count)
+                    coldest = probe;
+            }
+            hotPages.erase(coldest);
+            heteroStats.hotPageEvictions++;
+        }
+        it = hotPages.emplace(page, HotPageEntry()).first;
+    }
+
+    HotPageEntry &entry = it->second;
+    entry.count++;
+
+    if (!entry.reported && entry.count >= hotPageThreshold &&
+        shouldPromote(page, entry.count)) {
+        entry.reported = true;
+        heteroStats.promotionCandidates++;
+        heteroStats.candidateHeat.sample(entry.count);
+        if (ppMigrationCandidate) {
+            ppMigrationCandidate->notify(page);
+        }
+        DPRINTF(MemCtrl, "Hot page %#x crossed promotion threshold "
+                "(%d accesses)\n", page, entry.count);
+    }
+}
+
+bool
+HeteroMemCtrl::shouldPromote(Addr page_addr, uint32_t count)
+{
+    return true;
+}
+
+void
+HeteroMemCtrl::decayHotPages()
+{
+    for (auto it = hotPages.begin(); it != hotPages.end(); ) {
+        it->second.count >>= 1;
+        if (it->second.count == 0) {
+            it = hotPages.erase(it);
+        } else {
+            // a page has to stay hot to be re-reported
+            if (it->second.count < hotPageThreshold)
+                it->second.reported = false;
+            ++it;
+        }
+    }
+    schedule(decayEvent, curTick() + decayInterval);
+}
+
+void
+HeteroMemCtrl::regProbePoints()
+{
+    MemCtrl::regProbePoints();
+    ppMigrationCandidate =
+        new ProbePointArg<Addr>(getProbeManager(), "MigrationCandidate");
+}
+
+HeteroMemCtrl::HeteroStats::HeteroStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(promotionCandidates, statistics::units::Count::get(),
+               "NVM pages that crossed the promotion threshold"),
+      ADD_STAT(hotPageEvictions, statistics::units::Count::get(),
+               "Tracked pages evicted for table capacity"),
+      ADD_STAT(candidateHeat, statistics::units::Count::get(),
+               "Access count at the moment of promotion candidacy")
+{
+    candidateHeat.init(16);
+}
+
 } // namespace memory
 } // namespace gem5
@@ -46,8 +46,11 @@
 #ifndef __HETERO_MEM_CTRL_HH__
 #define __HETERO_MEM_CTRL_HH__
 
+#include <unordered_map>
+
 #include "mem/mem_ctrl.hh"
 #include "params/HeteroMemCtrl.hh"
+#include "sim/probe/probe.hh"
 
 namespace gem5
 {
@@ -135,6 +138,61 @@ class HeteroMemCtrl : public MemCtrl
     void recvFunctional(PacketPtr pkt) override;
     bool recvTimingReq(PacketPtr pkt) override;
 
+    void startup() override;
+
+    /**
+     * Hot-page tracking for tiered-memory studies: accesses to the
+     * slow (nvm) tier feed decaying per-page counters in a bounded
+     * table; pages crossing the threshold are reported once per epoch
+     * as promotion candidates through the MigrationCandidate probe,
+     * the stats below and the overridable policy hook. The actual
+     * remap is intentionally not modeled -- the physical address
+     * layout is fixed in this memory model, and re-homing a page
+     * would need an indirection layer in front of both interfaces --
+     * so this surfaces the promotion/demotion *dynamics* (what would
+     * migrate, how often, with what churn).
+     */
+    struct HotPageEntry
+    {
+        uint32_t count = 0;
+        bool reported = false;
+    };
+
+    /** Count an access to the slow tier. */
+    void trackNvmAccess(Addr addr);
+
+    /**
+     * Policy hook deciding whether a page that crossed the threshold
+     * is a promotion candidate. The default accepts every page.
+     */
+    virtual bool shouldPromote(Addr page_addr, uint32_t count);
+
+    /** Halve all counters and drop cold pages (epoch decay). */
+    void decayHotPages();
+
+    const bool hotPageTracking;
+    const Addr hotPageSize;
+    const uint32_t hotPageThreshold;
+    const size_t hotPageTableSize;
+    std::unordered_map<Addr, HotPageEntry> hotPages;
+    EventFunctionWrapper decayEvent;
+    const Tick decayInterval;
+
+    /** Notified with the page address of each promotion candidate. */
+    ProbePointArg<Addr> *ppMigrationCandidate = nullptr;
+
+  public:
+    void regProbePoints() override;
+
+  protected:
+    struct HeteroStats : public statistics::Group
+    {
+        HeteroStats(statistics::Group *parent);
+        statistics::Scalar promotionCandidates;
+        statistics::Scalar hotPageEvictions;
+        statistics::Histogram candidateHeat;
+    } heteroStats;
+
 };
 
 } // namespace memory
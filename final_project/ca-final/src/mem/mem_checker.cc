@@ -281,6 +281,11 @@ MemChecker::ByteTracker::abortWrite(MemChecker::Serial serial)
 void
 MemChecker::ByteTracker::pruneTransactions()
 {
+    // Amortize: pruning is pure memory reclamation (see opsSincePrune)
+    if (++opsSincePrune < pruneInterval)
+        return;
+    opsSincePrune = 0;
+
     // Obtain tick of first outstanding read. If there are no outstanding
     // reads, we use curTick(), i.e. we will remove all readObservation except
     // the most recent one.
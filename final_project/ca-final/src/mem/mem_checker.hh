@@ -38,6 +38,7 @@
 #ifndef __MEM_MEM_CHECKER_HH__
 #define __MEM_MEM_CHECKER_HH__
 
+#include <array>
 #include <cassert>
 #include <cstdint>
 #include <list>
@@ -346,6 +347,18 @@ class MemChecker : public SimObject
          */
         void pruneTransactions();
 
+        /**
+         * Operations since the last actual prune. Pruning only
+         * reclaims memory -- the verification scans are bounded by
+         * completion tick and never look at prunable entries -- so
+         * it is amortized over many operations instead of paying a
+         * backwards list scan on every completion.
+         */
+        unsigned opsSincePrune = 0;
+
+        /** Operations between actual prunes. */
+        static constexpr unsigned pruneInterval = 64;
+
       private:
 
         /**
@@ -478,15 +491,29 @@ class MemChecker : public SimObject
   private:
     /**
      * Returns the instance of ByteTracker for the requested location.
+     * Accesses walk bytes of a handful of hot locations, so the
+     * trackers of the most recently touched block are cached by
+     * pointer; references into byte_trackers remain valid because
+     * the map only ever grows.
      */
     ByteTracker* getByteTracker(Addr addr)
     {
+        const Addr blk = addr / trackerBlockBytes;
+        ByteTracker*& cached = cachedTrackers[addr % trackerBlockBytes];
+        if (blk != cachedBlockAddr) {
+            cachedBlockAddr = blk;
+            cachedTrackers.fill(nullptr);
+        } else if (cached) {
+            return cached;
+        }
+
         auto it = byte_trackers.find(addr);
         if (it == byte_trackers.end()) {
             it = byte_trackers.insert(
                 std::make_pair(addr, ByteTracker(addr, this))).first;
         }
-        return &it->second;
+        cached = &it->second;
+        return cached;
     };
 
   private:
@@ -513,6 +540,15 @@ class MemChecker : public SimObject
      * Access via getByteTracker()!
      */
     std::unordered_map<Addr, ByteTracker> byte_trackers;
+
+    /** Block granule of the tracker-pointer cache. */
+    static constexpr unsigned trackerBlockBytes = 64;
+
+    /** Block (addr / trackerBlockBytes) the cached pointers cover. */
+    Addr cachedBlockAddr = MaxAddr;
+
+    /** Tracker pointers for the most recently touched block. */
+    std::array<ByteTracker*, trackerBlockBytes> cachedTrackers = {};
 };
 
 inline MemChecker::Serial
@@ -57,7 +57,8 @@ namespace gem5
 namespace memory
 {
 
-MemCtrl::MemCtrl(const MemCtrlParams &p) :
+MemCtrl::MemCtrl(const MemCtrlParams &p)
+    :
     qos::MemCtrl(p),
     port(name() + ".port", *this), isTimingMode(false),
     retryRdReq(false), retryWrReq(false),
@@ -77,6 +78,10 @@ MemCtrl::MemCtrl(const MemCtrlParams &p) :
     backendLatency(p.static_backend_latency),
     commandWindow(p.command_window),
     prevArrival(0),
+    powerThrottleEnable(p.power_throttle_enable),
+    powerWindow(p.power_throttle_window),
+    powerWindowBudget(p.power_throttle_budget_bytes),
+    powerWindowEvent([this] { processPowerWindow(); }, name()),
     stats(*this)
 {
     DPRINTF(MemCtrl, "Setting up controller\n");
@@ -109,6 +114,10 @@ MemCtrl::init()
 void
 MemCtrl::startup()
 {
+    if (powerThrottleEnable) {
+        schedule(powerWindowEvent, curTick() + powerWindow);
+    }
+
     // remember the memory system mode of operation
     isTimingMode = system()->isTimingMode();
 
@@ -271,6 +280,7 @@ MemCtrl::addToReadQueue(PacketPtr pkt,
             DPRINTF(MemCtrl, "Adding to read queue\n");
 
             readQueue[mem_pkt->qosValue()].push_back(mem_pkt);
+            mem_intr->trackQueued(mem_pkt, true, true);
 
             // log packet
             logRequest(MemCtrl::READ, pkt->requestorId(),
@@ -344,6 +354,7 @@ MemCtrl::addToWriteQueue(PacketPtr pkt, unsigned int pkt_count,
             DPRINTF(MemCtrl, "Adding to write queue\n");
 
             writeQueue[mem_pkt->qosValue()].push_back(mem_pkt);
+            mem_intr->trackQueued(mem_pkt, false, true);
             isInWriteQueue.insert(burstAlign(addr, mem_intr));
 
             // log packet
@@ -795,6 +806,10 @@ MemCtrl::inWriteBusState(bool next_state, const MemInterface* mem_intr) const
 Tick
 MemCtrl::doBurstAccess(MemPacket* mem_pkt, MemInterface* mem_intr)
 {
+    if (powerThrottleEnable) {
+        accountBurstPower(mem_intr->bytesPerBurst());
+    }
+
     // first clean up the burstTick set, removing old entries
     // before adding new entries for next burst
     pruneBurstTick();
@@ -877,12 +892,62 @@ MemCtrl::nonDetermReads(MemInterface* mem_intr) {
     }
 }
 
+void
+MemCtrl::recordRowOutcome(const MemPacket *pkt, bool row_hit,
+                          bool conflict, unsigned busy_banks)
+{
+    const RequestorID id = pkt->requestorId();
+    if (row_hit) {
+        stats.requestorRowHits[id]++;
+    } else {
+        stats.requestorRowMisses[id]++;
+        if (conflict) {
+            stats.requestorBankConflicts[id]++;
+        }
+    }
+    stats.achievedBLP.sample(busy_banks);
+}
+
+void
+MemCtrl::processPowerWindow()
+{
+    bytesThisWindow = 0;
+    if (powerThrottled) {
+        powerThrottled = false;
+        // scheduling was stalled; resume it now
+        if (!nextReqEvent.scheduled()) {
+            schedule(nextReqEvent, curTick());
+        }
+    }
+    schedule(powerWindowEvent, curTick() + powerWindow);
+}
+
+void
+MemCtrl::accountBurstPower(uint64_t bytes)
+{
+    bytesThisWindow += bytes;
+    if (!powerThrottled && bytesThisWindow > powerWindowBudget) {
+        DPRINTF(MemCtrl, "Power budget exhausted (%d bytes), throttling "
+                "until next window\n", bytesThisWindow);
+        powerThrottled = true;
+    }
+}
+
 void
 MemCtrl::processNextReqEvent(MemInterface* mem_intr,
                         MemPacketQueue& resp_queue,
                         EventFunctionWrapper& resp_event,
                         EventFunctionWrapper& next_req_event,
                         bool& retry_wr_req) {
+    // power/thermal throttle: hold off scheduling until the current
+    // power window rolls over
+    if (powerThrottled) {
+        if (!next_req_event.scheduled()) {
+            schedule(next_req_event, powerWindowEvent.when());
+        }
+        return;
+    }
+
     // transition is handled by QoS algorithm if enabled
     if (turnPolicy) {
         // select bus state - only done if QoS algorithms are in use
@@ -1046,6 +1111,7 @@ MemCtrl::processNextReqEvent(MemInterface* mem_intr,
             // remove the request from the queue
             // the iterator is no longer valid .
             readQueue[mem_pkt->qosValue()].erase(to_read);
+            mem_intr->trackQueued(mem_pkt, true, false);
         }
 
         // switching to writes, either because the read queue is empty
@@ -1111,6 +1177,7 @@ MemCtrl::processNextReqEvent(MemInterface* mem_intr,
 
         // remove the request from the queue - the iterator is no longer valid
         writeQueue[mem_pkt->qosValue()].erase(to_write);
+        mem_intr->trackQueued(mem_pkt, false, false);
 
         delete mem_pkt;
 
@@ -1266,6 +1333,14 @@ MemCtrl::CtrlStats::CtrlStats(MemCtrl &_ctrl)
              "Per-requestor read total memory access latency"),
     ADD_STAT(requestorWriteTotalLat, statistics::units::Tick::get(),
              "Per-requestor write total memory access latency"),
+    ADD_STAT(requestorRowHits, statistics::units::Count::get(),
+             "Per-requestor row buffer hits"),
+    ADD_STAT(requestorRowMisses, statistics::units::Count::get(),
+             "Per-requestor row buffer misses"),
+    ADD_STAT(requestorBankConflicts, statistics::units::Count::get(),
+             "Per-requestor row misses that closed another open row"),
+    ADD_STAT(achievedBLP, statistics::units::Count::get(),
+             "Banks with pending work when bursts issued"),
     ADD_STAT(requestorReadAvgLat, statistics::units::Rate<
                 statistics::units::Tick, statistics::units::Count>::get(),
              "Per-requestor read average memory access latency"),
@@ -1304,6 +1379,19 @@ MemCtrl::CtrlStats::regStats()
     avgGap.precision(2);
 
     // per-requestor bytes read and written to memory
+    requestorRowHits
+        .init(max_requestors)
+        .flags(nozero);
+    requestorRowMisses
+        .init(max_requestors)
+        .flags(nozero);
+    requestorBankConflicts
+        .init(max_requestors)
+        .flags(nozero);
+    achievedBLP
+        .init(16)
+        .flags(nozero);
+
     requestorReadBytes
         .init(max_requestors)
         .flags(nozero | nonan);
@@ -1348,6 +1436,9 @@ MemCtrl::CtrlStats::regStats()
     for (int i = 0; i < max_requestors; i++) {
         const std::string requestor = ctrl.system()->getRequestorName(i);
         requestorReadBytes.subname(i, requestor);
+        requestorRowHits.subname(i, requestor);
+        requestorRowMisses.subname(i, requestor);
+        requestorBankConflicts.subname(i, requestor);
         requestorReadRate.subname(i, requestor);
         requestorWriteBytes.subname(i, requestor);
         requestorWriteRate.subname(i, requestor);
@@ -559,6 +559,26 @@ class MemCtrl : public qos::MemCtrl
      */
     Tick nextReqTime;
 
+    /**
+     * Activity-proportional power throttling stage. DRAM dynamic
+     * power tracks burst activity, so the stage integrates bytes
+     * transferred per window and, once the configured budget is
+     * exceeded, stalls scheduling until the window rolls over --
+     * modeling a bandwidth cap imposed by a power/thermal limit.
+     */
+    const bool powerThrottleEnable;
+    const Tick powerWindow;
+    const uint64_t powerWindowBudget;
+    uint64_t bytesThisWindow = 0;
+    bool powerThrottled = false;
+    EventFunctionWrapper powerWindowEvent;
+
+    /** Roll the power window over and resume if throttled. */
+    void processPowerWindow();
+
+    /** Account a burst against the window's power budget. */
+    void accountBurstPower(uint64_t bytes);
+
     struct CtrlStats : public statistics::Group
     {
         CtrlStats(MemCtrl &ctrl);
@@ -614,6 +634,15 @@ class MemCtrl : public qos::MemCtrl
         statistics::Vector requestorReadTotalLat;
         statistics::Vector requestorWriteTotalLat;
 
+        /** Row-buffer locality and bank-level parallelism per
+         * requestor: hits, misses and conflicts (a miss that had to
+         * close another row), plus the distribution of how many banks
+         * had work pending when bursts issued. */
+        statistics::Vector requestorRowHits;
+        statistics::Vector requestorRowMisses;
+        statistics::Vector requestorBankConflicts;
+        statistics::Histogram achievedBLP;
+
         // per-requestor raed and write average memory access latency
         statistics::Formula requestorReadAvgLat;
         statistics::Formula requestorWriteAvgLat;
@@ -777,6 +806,19 @@ class MemCtrl : public qos::MemCtrl
 
     virtual void init() override;
     virtual void startup() override;
+
+    /**
+     * Called by the media interface for every burst with the row
+     * outcome, feeding the per-requestor locality statistics.
+     *
+     * @param pkt The burst's packet
+     * @param row_hit Whether the burst hit the open row
+     * @param conflict Whether another row had to be closed first
+     * @param busy_banks Banks with pending work at issue time
+     */
+    void recordRowOutcome(const MemPacket *pkt, bool row_hit,
+                          bool conflict, unsigned busy_banks);
+
     virtual void drainResume() override;
 
   protected:
@@ -245,6 +245,20 @@ class MemInterface : public AbstractMemory
      */
     virtual void setupRank(const uint8_t rank, const bool is_read) = 0;
 
+    /**
+     * Track a packet entering or leaving the controller's queues, so
+     * interfaces can maintain incremental per-bank occupancy instead
+     * of scanning the queues per scheduling decision. Default no-op.
+     *
+     * @param pkt The queued/dequeued packet
+     * @param is_read Read or write queue membership
+     * @param queued True on enqueue, false on dequeue
+     */
+    virtual void
+    trackQueued(const MemPacket *pkt, bool is_read, bool queued)
+    {
+    }
+
     /**
      * Check drain state of interface
      *
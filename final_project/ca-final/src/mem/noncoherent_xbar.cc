@@ -88,6 +88,19 @@ NoncoherentXBar::NoncoherentXBar(const NoncoherentXBarParams &p)
         respLayers.push_back(new RespLayer(*bp, *this,
                                            csprintf("respLayer%d", i)));
     }
+
+    // hand any configured arbitration weights to the request layers,
+    // which arbitrate among the CPU-side ports
+    if (!p.port_weights.empty()) {
+        fatal_if(p.port_weights.size() != cpuSidePorts.size(),
+                 "%s: port_weights must have one entry per cpu_side_port "
+                 "(%d != %d)", name(), p.port_weights.size(),
+                 cpuSidePorts.size());
+        for (auto* layer : reqLayers) {
+            for (unsigned i = 0; i < cpuSidePorts.size(); ++i)
+                layer->setPortWeight(cpuSidePorts[i], p.port_weights[i]);
+        }
+    }
 }
 
 NoncoherentXBar::~NoncoherentXBar()
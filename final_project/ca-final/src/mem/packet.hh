@@ -58,6 +58,7 @@
 #include "base/extensible.hh"
 #include "base/flags.hh"
 #include "base/logging.hh"
+#include "base/pooled_new.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
 #include "mem/htm.hh"
@@ -291,7 +292,8 @@ class MemCmd
  * ultimate destination and back, possibly being conveyed by several
  * different Packets along the way.)
  */
-class Packet : public Printable, public Extensible<Packet>
+class Packet : public Printable, public Extensible<Packet>,
+               public PooledNew<Packet>
 {
   public:
     typedef uint32_t FlagsType;
@@ -464,8 +466,13 @@ class Packet : public Printable, public Extensible<Packet>
      * back. For this reason, the predecessor should always be
      * populated with the current SenderState of a packet before
      * modifying the senderState field in the request packet.
+     *
+     * Sender states are pushed and popped once per hop that needs
+     * them, so the whole hierarchy allocates through the pooled
+     * size-class bins; the common one-deep case becomes a free-list
+     * pop instead of a host allocation.
      */
-    struct SenderState
+    struct SenderState : public PooledNew<SenderState>
     {
         SenderState* predecessor;
         SenderState() : predecessor(NULL) {}
@@ -51,13 +51,39 @@ PacketQueue::PacketQueue(EventManager& _em, const std::string& _label,
                          const std::string& _sendEventName,
                          bool force_order,
                          bool disable_sanity_check)
-    : em(_em), sendEvent([this]{ processSendEvent(); }, _sendEventName),
+    : ring(16, DeferredPacket(0, nullptr)), ringHead(0), ringCount(0),
+      em(_em), sendEvent([this]{ processSendEvent(); }, _sendEventName),
       _disableSanityCheck(disable_sanity_check),
       forceOrder(force_order),
       label(_label), waitingOnRetry(false)
 {
 }
 
+void
+PacketQueue::growRing()
+{
+    std::vector<DeferredPacket> bigger(ring.size() * 2,
+                                       DeferredPacket(0, nullptr));
+    for (size_t i = 0; i < ringCount; i++)
+        bigger[i] = slot(i);
+    ring.swap(bigger);
+    ringHead = 0;
+}
+
+void
+PacketQueue::insertAt(size_t pos, Tick when, PacketPtr pkt)
+{
+    if (ringCount == ring.size())
+        growRing();
+
+    // shift the tail up; insertions cluster at the back, so this is
+    // usually a no-op
+    for (size_t i = ringCount; i > pos; i--)
+        slot(i) = slot(i - 1);
+    slot(pos) = DeferredPacket(when, pkt);
+    ringCount++;
+}
+
 PacketQueue::~PacketQueue()
 {
 }
@@ -76,8 +102,8 @@ PacketQueue::checkConflict(const PacketPtr pkt, const int blk_size) const
 {
     // caller is responsible for ensuring that all packets have the
     // same alignment
-    for (const auto& p : transmitList) {
-        if (p.pkt->matchBlockAddr(pkt, blk_size))
+    for (size_t i = 0; i < ringCount; i++) {
+        if (slot(i).pkt->matchBlockAddr(pkt, blk_size))
             return true;
     }
     return false;
@@ -88,14 +114,12 @@ PacketQueue::trySatisfyFunctional(PacketPtr pkt)
 {
     pkt->pushLabel(label);
 
-    auto i = transmitList.begin();
     bool found = false;
 
-    while (!found && i != transmitList.end()) {
+    for (size_t i = 0; !found && i < ringCount; i++) {
         // If the buffered packet contains data, and it overlaps the
         // current packet, then update data
-        found = pkt->trySatisfyFunctional(i->pkt);
-        ++i;
+        found = pkt->trySatisfyFunctional(slot(i).pkt);
     }
 
     pkt->popLabel();
@@ -118,7 +142,7 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
 
     // add a very basic sanity check on the port to ensure the
     // invisible buffer is not growing beyond reasonable limits
-    if (!_disableSanityCheck && transmitList.size() > 1024) {
+    if (!_disableSanityCheck && ringCount > 1024) {
         panic("Packet queue %s has grown beyond 1024 packets\n",
               name());
     }
@@ -135,19 +159,16 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
     // order by tick; however, if forceOrder is set, also make sure
     // not to re-order in front of some existing packet with the same
     // address
-    auto it = transmitList.end();
-    while (it != transmitList.begin()) {
-        --it;
-        if ((forceOrder && it->pkt->matchAddr(pkt)) || it->tick <= when) {
-            // emplace inserts the element before the position pointed to by
-            // the iterator, so advance it one step
-            transmitList.emplace(++it, when, pkt);
+    for (size_t i = ringCount; i > 0; i--) {
+        const DeferredPacket &dp = slot(i - 1);
+        if ((forceOrder && dp.pkt->matchAddr(pkt)) || dp.tick <= when) {
+            insertAt(i, when, pkt);
             return;
         }
     }
     // either the packet list is empty or this has to be inserted
     // before every other packet
-    transmitList.emplace_front(when, pkt);
+    insertAt(0, when, pkt);
     schedSendEvent(when);
 }
 
@@ -178,7 +199,7 @@ PacketQueue::schedSendEvent(Tick when)
         // we get a MaxTick when there is no more to send, so if we're
         // draining, we may be done at this point
         if (drainState() == DrainState::Draining &&
-            transmitList.empty() && !sendEvent.scheduled()) {
+            ringCount == 0 && !sendEvent.scheduled()) {
 
             DPRINTF(Drain, "PacketQueue done draining,"
                     "processing drain event\n");
@@ -194,14 +215,14 @@ PacketQueue::sendDeferredPacket()
     assert(!waitingOnRetry);
     assert(deferredPacketReady());
 
-    DeferredPacket dp = transmitList.front();
+    DeferredPacket dp = slot(0);
 
     // take the packet of the list before sending it, as sending of
     // the packet in some cases causes a new packet to be enqueued
     // (most notaly when responding to the timing CPU, leading to a
     // new request hitting in the L1 icache, leading to a new
     // response)
-    transmitList.pop_front();
+    popFront();
 
     // use the appropriate implementation of sendTiming based on the
     // type of queue
@@ -213,7 +234,7 @@ PacketQueue::sendDeferredPacket()
         schedSendEvent(deferredPacketReadyTime());
     } else {
         // put the packet back at the front of the list
-        transmitList.emplace_front(dp);
+        pushFront(dp);
     }
 }
 
@@ -227,7 +248,7 @@ PacketQueue::processSendEvent()
 DrainState
 PacketQueue::drain()
 {
-    if (transmitList.empty()) {
+    if (ringCount == 0) {
         return DrainState::Drained;
     } else {
         DPRINTF(Drain, "PacketQueue not drained\n");
@@ -49,7 +49,7 @@
  * for the flow control of the port.
  */
 
-#include <list>
+#include <vector>
 
 #include "mem/port.hh"
 #include "sim/drain.hh"
@@ -76,10 +76,59 @@ class PacketQueue : public Drainable
         {}
     };
 
-    typedef std::list<DeferredPacket> DeferredPacketList;
+    /**
+     * Outgoing packets, ordered by ready tick (insertion order among
+     * equal ticks), kept in a power-of-two ring buffer. The queue
+     * rarely holds more than a handful of entries and pops from the
+     * front once per send event, so a ring with in-place shifting on
+     * the (rare) out-of-order insert is markedly cheaper than a
+     * node-per-packet list.
+     */
+    std::vector<DeferredPacket> ring;
+
+    /** Index of the first (earliest) deferred packet in the ring. */
+    size_t ringHead;
+
+    /** Number of valid entries starting at ringHead. */
+    size_t ringCount;
 
-    /** A list of outgoing packets. */
-    DeferredPacketList transmitList;
+    /** The i-th deferred packet in queue order. */
+    DeferredPacket &
+    slot(size_t i)
+    {
+        return ring[(ringHead + i) & (ring.size() - 1)];
+    }
+
+    const DeferredPacket &
+    slot(size_t i) const
+    {
+        return ring[(ringHead + i) & (ring.size() - 1)];
+    }
+
+    /** Double the ring, re-linearizing the live entries. */
+    void growRing();
+
+    /** Insert a deferred packet before queue position pos. */
+    void insertAt(size_t pos, Tick when, PacketPtr pkt);
+
+    /** Drop the head of the queue. */
+    void
+    popFront()
+    {
+        ringHead = (ringHead + 1) & (ring.size() - 1);
+        ringCount--;
+    }
+
+    /** Put a deferred packet back at the head of the queue. */
+    void
+    pushFront(const DeferredPacket &dp)
+    {
+        if (ringCount == ring.size())
+            growRing();
+        ringHead = (ringHead - 1) & (ring.size() - 1);
+        ring[ringHead] = dp;
+        ringCount++;
+    }
 
     /** The manager which is used for the event queue */
     EventManager& em;
@@ -92,7 +141,7 @@ class PacketQueue : public Drainable
 
      /*
       * Optionally disable the sanity check
-      * on the size of the transmitList. The
+      * on the size of the transmit queue. The
       * sanity check will be enabled by default.
       */
     bool _disableSanityCheck;
@@ -114,7 +163,7 @@ class PacketQueue : public Drainable
 
     /** Check whether we have a packet ready to go on the transmit list. */
     bool deferredPacketReady() const
-    { return !transmitList.empty() && transmitList.front().tick <= curTick(); }
+    { return ringCount > 0 && slot(0).tick <= curTick(); }
 
     /**
      * Attempt to send a packet. Note that a subclass of the
@@ -140,7 +189,8 @@ class PacketQueue : public Drainable
      * @param _label Label to push on the label stack for print request packets
      * @param force_order Force insertion order for packets with same address
      * @param disable_sanity_check Flag used to disable the sanity check
-     *        on the size of the transmitList. The check is enabled by default.
+     *        on the size of the transmit queue. The check is enabled by
+     *        default.
      */
     PacketQueue(EventManager& _em, const std::string& _label,
                 const std::string& _sendEventName,
@@ -164,13 +214,13 @@ class PacketQueue : public Drainable
     /**
      * Get the size of the queue.
      */
-    size_t size() const { return transmitList.size(); }
+    size_t size() const { return ringCount; }
 
     /**
      * Get the next packet ready time.
      */
     Tick deferredPacketReadyTime() const
-    { return transmitList.empty() ? MaxTick : transmitList.front().tick; }
+    { return ringCount == 0 ? MaxTick : slot(0).tick; }
 
     /**
      * Check if a packet corresponding to the same address exists in the
@@ -214,7 +264,7 @@ class PacketQueue : public Drainable
 
     /**
       * This allows a user to explicitly disable the sanity check
-      * on the size of the transmitList, which is enabled by default.
+      * on the size of the transmit queue, which is enabled by default.
       * Users must use this function to explicitly disable the sanity
       * check.
       */
@@ -53,6 +53,11 @@ EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 
     DPRINTF(MMU, "Allocating Page: %#x-%#x\n", vaddr, vaddr + size);
 
+    invalidateLookupCache();
+
+    // bulk mmaps insert one entry per page; size the hash once
+    pTable.reserve(pTable.size() + size / _pageSize);
+
     while (size > 0) {
         auto it = pTable.find(vaddr);
         if (it != pTable.end()) {
@@ -74,6 +79,8 @@ EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 void
 EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 {
+    invalidateLookupCache();
+
     assert(pageOffset(vaddr) == 0);
     assert(pageOffset(new_vaddr) == 0);
 
@@ -103,6 +110,8 @@ EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 void
 EmulationPageTable::unmap(Addr vaddr, int64_t size)
 {
+    invalidateLookupCache();
+
     assert(pageOffset(vaddr) == 0);
 
     DPRINTF(MMU, "Unmapping page: %#x-%#x\n", vaddr, vaddr + size);
@@ -133,10 +142,17 @@ const EmulationPageTable::Entry *
 EmulationPageTable::lookup(Addr vaddr)
 {
     Addr page_addr = pageAlign(vaddr);
+
+    if (page_addr == lastPageAddr)
+        return lastPageEntry;
+
     PTableItr iter = pTable.find(page_addr);
     if (iter == pTable.end())
         return nullptr;
-    return &(iter->second);
+
+    lastPageAddr = page_addr;
+    lastPageEntry = &(iter->second);
+    return lastPageEntry;
 }
 
 bool
@@ -67,6 +67,21 @@ class EmulationPageTable : public Serializable
     typedef PTable::iterator PTableItr;
     PTable pTable;
 
+    /**
+     * One-entry lookup memo: SE translation probes the hash for
+     * every access while most accesses stay on one page. Keyed by
+     * page-aligned vaddr and dropped on any map/remap/unmap.
+     */
+    mutable Addr lastPageAddr = 1; // never page aligned => invalid
+    mutable const Entry *lastPageEntry = nullptr;
+
+    void
+    invalidateLookupCache()
+    {
+        lastPageAddr = 1;
+        lastPageEntry = nullptr;
+    }
+
     const Addr _pageSize;
     const Addr offsetMask;
 
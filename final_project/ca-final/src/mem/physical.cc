@@ -38,17 +38,21 @@
 #include "mem/physical.hh"
 
 #include <fcntl.h>
+#include <sys/file.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/user.h>
 #include <unistd.h>
 #include <zlib.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include "base/intmath.hh"
 #include "base/trace.hh"
@@ -80,14 +84,26 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               bool dirty_tracking,
+                               unsigned parallel_chunks,
+                               bool shared_backstore_cow) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
+    sharedBackstoreCow(shared_backstore_cow),
+    dirtyTracking(dirty_tracking), parallelChunks(parallel_chunks),
     pageSize(sysconf(_SC_PAGE_SIZE))
 {
     // Register cleanup callback if requested.
     if (auto_unlink_shared_backstore && !sharedBackstore.empty()) {
-        registerExitCallback([=]() { shm_unlink(shared_backstore.c_str()); });
+        bool cow = sharedBackstoreCow;
+        registerExitCallback([=]() {
+            shm_unlink(shared_backstore.c_str());
+            // also drop the copy-on-write ready marker so a stale
+            // marker can't outlive the segment it describes
+            if (cow)
+                shm_unlink((shared_backstore + ".ready").c_str());
+        });
     }
 
     if (mmap_using_noreserve)
@@ -227,9 +243,19 @@ PhysicalMemory::createBackingStore(
         shm_fd = shm_open(sharedBackstore.c_str(), O_CREAT | O_RDWR, 0666);
         if (shm_fd == -1)
                panic("Shared memory failed");
-        if (ftruncate(shm_fd, sharedBackstoreSize))
+
+        // Never shrink the segment: another simulation sharing it may
+        // already have populated stores beyond our current offset.
+        struct stat shm_stat;
+        if (fstat(shm_fd, &shm_stat))
+               panic("Stat of shared memory failed");
+        if ((uint64_t)shm_stat.st_size < sharedBackstoreSize &&
+            ftruncate(shm_fd, sharedBackstoreSize))
                panic("Setting size of shared memory failed");
-        map_flags = MAP_SHARED;
+
+        // In copy-on-write mode every simulation gets a private view
+        // of the shared image; writes stay local to this process.
+        map_flags = sharedBackstoreCow ? MAP_PRIVATE : MAP_SHARED;
     }
 
     // to be able to simulate very large memories, the user can opt to
@@ -254,11 +280,27 @@ PhysicalMemory::createBackingStore(
                               conf_table_reported, in_addr_map, kvm_map,
                               shm_fd, map_offset);
 
+    if (dirtyTracking) {
+        // One bit per host page, shared with the memories below so
+        // they can mark writes as they happen. KVM writes directly to
+        // the backing store and would not be seen by the bitmap.
+        warn_if(kvm_map, "Dirty-page tracking cannot see KVM writes to "
+                "range %s\n", range.to_string());
+        uint64_t npages = divCeil(range.size(), (uint64_t)pageSize);
+        backingStore.back().dirtyMap =
+            std::make_shared<std::vector<uint64_t>>(divCeil(npages,
+                                                            (uint64_t)64), 0);
+    }
+
     // point the memories to their backing store
     for (const auto& m : _memories) {
         DPRINTF(AddrRanges, "Mapping memory %s to backing store\n",
                 m->name());
         m->setBackingStore(pmem);
+        if (dirtyTracking) {
+            m->setDirtyTracking(backingStore.back().dirtyMap.get(),
+                                floorLog2(pageSize));
+        }
     }
 }
 
@@ -272,7 +314,17 @@ PhysicalMemory::~PhysicalMemory()
 bool
 PhysicalMemory::isMemAddr(Addr addr) const
 {
-    return addrMap.contains(addr) != addrMap.end();
+    // isMemAddr is called per packet on several hot paths and the
+    // answering range rarely changes between calls
+    if (isMemAddrCache.contains(addr))
+        return true;
+
+    auto it = addrMap.contains(addr);
+    if (it == addrMap.end())
+        return false;
+
+    isMemAddrCache = it->first;
+    return true;
 }
 
 AddrRangeList
@@ -329,6 +381,114 @@ PhysicalMemory::functionalAccess(PacketPtr pkt)
     m->second->functionalAccess(pkt);
 }
 
+namespace
+{
+
+/**
+ * Write one gzip-compressed image of [data, data + len) to path.
+ * Used both for whole-store images and for the shards of a parallel
+ * checkpoint; safe to run on a worker thread.
+ */
+void
+writeGzImage(const std::string &path, const uint8_t *data, uint64_t len)
+{
+    gzFile compressed = gzopen(path.c_str(), "wb");
+    if (compressed == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'\n", path);
+
+    uint64_t pass_size = 0;
+
+    // gzwrite fails if (int)len < 0 (gzwrite returns int)
+    for (uint64_t written = 0; written < len; written += pass_size) {
+        pass_size = (uint64_t)INT_MAX < (len - written) ?
+            (uint64_t)INT_MAX : (len - written);
+
+        if (gzwrite(compressed, data + written,
+                    (unsigned int)pass_size) != (int)pass_size) {
+            fatal("Write failed on physical memory checkpoint file '%s'\n",
+                  path);
+        }
+    }
+
+    if (gzclose(compressed))
+        fatal("Close failed on physical memory checkpoint file '%s'\n",
+              path);
+}
+
+/**
+ * Read a gzip-compressed image back into [dest, dest + max_len).
+ */
+void
+readGzImage(const std::string &path, uint8_t *dest, uint64_t max_len)
+{
+    const uint32_t chunk_size = 16384;
+
+    gzFile compressed = gzopen(path.c_str(), "rb");
+    if (compressed == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", path);
+
+    uint64_t curr_size = 0;
+    while (curr_size < max_len) {
+        uint32_t bytes_read = gzread(compressed, dest,
+                                     std::min((uint64_t)chunk_size,
+                                              max_len - curr_size));
+        if (bytes_read == 0)
+            break;
+        curr_size += bytes_read;
+        dest += bytes_read;
+    }
+
+    if (gzclose(compressed))
+        fatal("Close failed on physical memory checkpoint file '%s'\n",
+              path);
+}
+
+/**
+ * Shard [pmem, pmem + len) into nbr_chunks contiguous pieces and
+ * compress them concurrently, one worker thread per chunk, into
+ * path.chunk<i>.
+ */
+void
+writeGzImageParallel(const std::string &path, const uint8_t *pmem,
+                     uint64_t len, unsigned nbr_chunks)
+{
+    const uint64_t chunk_len = divCeil(len, (uint64_t)nbr_chunks);
+    std::vector<std::thread> workers;
+    workers.reserve(nbr_chunks);
+    for (unsigned i = 0; i < nbr_chunks; i++) {
+        const uint64_t offset = (uint64_t)i * chunk_len;
+        const uint64_t this_len =
+            offset < len ? std::min(chunk_len, len - offset) : 0;
+        workers.emplace_back(writeGzImage, csprintf("%s.chunk%d", path, i),
+                             pmem + offset, this_len);
+    }
+    for (auto &w : workers)
+        w.join();
+}
+
+/**
+ * Parallel counterpart of readGzImage() for sharded images.
+ */
+void
+readGzImageParallel(const std::string &path, uint8_t *pmem, uint64_t len,
+                    unsigned nbr_chunks)
+{
+    const uint64_t chunk_len = divCeil(len, (uint64_t)nbr_chunks);
+    std::vector<std::thread> workers;
+    workers.reserve(nbr_chunks);
+    for (unsigned i = 0; i < nbr_chunks; i++) {
+        const uint64_t offset = (uint64_t)i * chunk_len;
+        const uint64_t this_len =
+            offset < len ? std::min(chunk_len, len - offset) : 0;
+        workers.emplace_back(readGzImage, csprintf("%s.chunk%d", path, i),
+                             pmem + offset, this_len);
+    }
+    for (auto &w : workers)
+        w.join();
+}
+
+} // anonymous namespace
+
 void
 PhysicalMemory::serialize(CheckpointOut &cp) const
 {
@@ -355,14 +515,17 @@ PhysicalMemory::serialize(CheckpointOut &cp) const
     // store each backing store memory segment in a file
     for (auto& s : backingStore) {
         ScopedCheckpointSection sec(cp, csprintf("store%d", store_id));
-        serializeStore(cp, store_id++, s.range, s.pmem);
+        serializeStore(cp, store_id++, s);
     }
 }
 
 void
 PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
-                               AddrRange range, uint8_t* pmem) const
+                               const BackingStoreEntry &store) const
 {
+    const AddrRange &range = store.range;
+    uint8_t *pmem = store.pmem;
+
     // we cannot use the address range for the name as the
     // memories that are not part of the address map can overlap
     std::string filename =
@@ -376,34 +539,86 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
 
+    // An incremental checkpoint is possible once a full image exists
+    // as a base; it records the pages dirtied since that image.
+    bool incremental = store.dirtyMap && !store.lastFullFile.empty();
+    SERIALIZE_SCALAR(incremental);
+
     // write memory file
     std::string filepath = CheckpointIn::dir() + "/" + filename.c_str();
-    gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'\n",
-              filename);
 
-    uint64_t pass_size = 0;
+    if (incremental) {
+        gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
+        if (compressed_mem == NULL)
+            fatal("Can't open physical memory checkpoint file '%s'\n",
+                  filename);
 
-    // gzwrite fails if (int)len < 0 (gzwrite returns int)
-    for (uint64_t written = 0; written < range.size();
-         written += pass_size) {
-        pass_size = (uint64_t)INT_MAX < (range.size() - written) ?
-            (uint64_t)INT_MAX : (range.size() - written);
+        const std::string &base_filename = store.lastFullFile;
+        SERIALIZE_SCALAR(base_filename);
+        const unsigned base_chunks = store.lastFullChunks;
+        SERIALIZE_SCALAR(base_chunks);
+        const uint64_t page_size = pageSize;
+        SERIALIZE_SCALAR(page_size);
+
+        // Collect the dirty page indices. The bitmap is deliberately
+        // left intact: incremental checkpoints are cumulative against
+        // the last full image, so each one is restorable on its own.
+        std::vector<uint64_t> dirty_pages;
+        const std::vector<uint64_t> &map = *store.dirtyMap;
+        const uint64_t npages = divCeil(range.size(), (uint64_t)pageSize);
+        for (uint64_t page = 0; page < npages; page++) {
+            if (map[page >> 6] & (1ULL << (page & 63)))
+                dirty_pages.push_back(page);
+        }
+        const uint64_t nbr_dirty_pages = dirty_pages.size();
+        SERIALIZE_SCALAR(nbr_dirty_pages);
+
+        DPRINTF(Checkpoint, "Incremental checkpoint: %d of %d pages "
+                "dirty since %s\n", nbr_dirty_pages, npages,
+                base_filename);
 
-        if (gzwrite(compressed_mem, pmem + written,
-                    (unsigned int) pass_size) != (int) pass_size) {
+        const int index_bytes = nbr_dirty_pages * sizeof(uint64_t);
+        if (gzwrite(compressed_mem, dirty_pages.data(), index_bytes) !=
+            index_bytes) {
             fatal("Write failed on physical memory checkpoint file '%s'\n",
                   filename);
         }
-    }
 
-    // close the compressed stream and check that the exit status
-    // is zero
-    if (gzclose(compressed_mem))
-        fatal("Close failed on physical memory checkpoint file '%s'\n",
-              filename);
+        for (uint64_t page : dirty_pages) {
+            const uint64_t offset = page * page_size;
+            const uint64_t len =
+                std::min((uint64_t)page_size, range.size() - offset);
+            if (gzwrite(compressed_mem, pmem + offset,
+                        (unsigned int)len) != (int)len) {
+                fatal("Write failed on physical memory checkpoint file "
+                      "'%s'\n", filename);
+            }
+        }
 
+        // close the compressed stream and check that the exit status
+        // is zero
+        if (gzclose(compressed_mem))
+            fatal("Close failed on physical memory checkpoint file '%s'\n",
+                  filename);
+    } else {
+        // Full image; optionally sharded into chunks compressed by
+        // concurrent worker threads.
+        const unsigned nbr_chunks = parallelChunks > 1 ? parallelChunks : 1;
+        SERIALIZE_SCALAR(nbr_chunks);
+
+        if (nbr_chunks > 1)
+            writeGzImageParallel(filepath, pmem, range.size(), nbr_chunks);
+        else
+            writeGzImage(filepath, pmem, range.size());
+
+        if (store.dirtyMap) {
+            // This full image becomes the base for subsequent
+            // incremental checkpoints.
+            store.lastFullFile = filepath;
+            store.lastFullChunks = nbr_chunks;
+            std::fill(store.dirtyMap->begin(), store.dirtyMap->end(), 0);
+        }
+    }
 }
 
 void
@@ -424,18 +639,48 @@ PhysicalMemory::unserialize(CheckpointIn &cp)
     unsigned int nbr_of_stores;
     UNSERIALIZE_SCALAR(nbr_of_stores);
 
+    // In copy-on-write shared-backstore mode only the first process
+    // to restore decompresses the image into the shared segment;
+    // later processes find the ready marker and just map it. The
+    // flock serializes concurrent restores racing for that role.
+    bool populate = true;
+    int lock_fd = -1;
+    if (sharedBackstoreCow && !sharedBackstore.empty() &&
+        !backingStore.empty()) {
+        lock_fd = backingStore.front().shmFd;
+        if (flock(lock_fd, LOCK_EX) != 0)
+            panic("Locking shared backstore failed");
+
+        std::string marker = sharedBackstore + ".ready";
+        int marker_fd = shm_open(marker.c_str(), O_RDONLY, 0666);
+        if (marker_fd != -1) {
+            populate = false;
+            close(marker_fd);
+            DPRINTF(Checkpoint, "Shared backstore %s already populated, "
+                    "skipping image load\n", sharedBackstore);
+        }
+    }
+
     for (unsigned int i = 0; i < nbr_of_stores; ++i) {
         ScopedCheckpointSection sec(cp, csprintf("store%d", i));
-        unserializeStore(cp);
+        unserializeStore(cp, populate);
     }
 
+    if (lock_fd != -1) {
+        if (populate) {
+            std::string marker = sharedBackstore + ".ready";
+            int marker_fd = shm_open(marker.c_str(), O_CREAT | O_RDWR, 0666);
+            if (marker_fd == -1)
+                panic("Creating shared backstore ready marker failed");
+            close(marker_fd);
+        }
+        flock(lock_fd, LOCK_UN);
+    }
 }
 
 void
-PhysicalMemory::unserializeStore(CheckpointIn &cp)
+PhysicalMemory::unserializeStore(CheckpointIn &cp, bool populate)
 {
-    const uint32_t chunk_size = 16384;
-
     unsigned int store_id;
     UNSERIALIZE_SCALAR(store_id);
 
@@ -443,11 +688,6 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     std::string filepath = cp.getCptDir() + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
-
     // we've already got the actual backing store mapped
     uint8_t* pmem = backingStore[store_id].pmem;
     AddrRange range = backingStore[store_id].range;
@@ -462,19 +702,111 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
-    uint64_t curr_size = 0;
-    uint32_t bytes_read;
-    while (curr_size < range.size()) {
-        bytes_read = gzread(compressed_mem, pmem, chunk_size);
-        if (bytes_read == 0)
-            break;
-        curr_size += bytes_read;
-        pmem += bytes_read;
+    bool incremental = false;
+    optParamIn(cp, "incremental", incremental);
+
+    const BackingStoreEntry &store = backingStore[store_id];
+
+    if (!populate) {
+        // Copy-on-write restore from an already-populated shared
+        // backstore: the mapping set up in createBackingStore()
+        // already shows the restored image.
+        return;
     }
 
-    if (gzclose(compressed_mem))
-        fatal("Close failed on physical memory checkpoint file '%s'\n",
-              filename);
+    // When populating a copy-on-write view, decompress through a
+    // temporary shared mapping so the bytes reach the segment itself
+    // (a write through our MAP_PRIVATE view would stay local).
+    uint8_t *shared_view = nullptr;
+    if (sharedBackstoreCow && store.shmFd != -1) {
+        shared_view = (uint8_t *)mmap(NULL, range.size(),
+                                      PROT_READ | PROT_WRITE, MAP_SHARED,
+                                      store.shmFd, store.shmOffset);
+        if (shared_view == (uint8_t *)MAP_FAILED)
+            panic("Could not map shared backstore for populating");
+        pmem = shared_view;
+    }
+
+    if (incremental) {
+        // Restore the full base image first, then overlay the pages
+        // recorded in the incremental file.
+        std::string base_filename;
+        UNSERIALIZE_SCALAR(base_filename);
+        unsigned base_chunks = 1;
+        optParamIn(cp, "base_chunks", base_chunks);
+        uint64_t page_size;
+        UNSERIALIZE_SCALAR(page_size);
+        uint64_t nbr_dirty_pages;
+        UNSERIALIZE_SCALAR(nbr_dirty_pages);
+
+        if (base_chunks > 1) {
+            readGzImageParallel(base_filename, pmem, range.size(),
+                                base_chunks);
+        } else {
+            readGzImage(base_filename, pmem, range.size());
+        }
+
+        gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+        if (compressed_mem == NULL)
+            fatal("Can't open physical memory checkpoint file '%s'",
+                  filename);
+
+        std::vector<uint64_t> dirty_pages(nbr_dirty_pages);
+        const int index_bytes = nbr_dirty_pages * sizeof(uint64_t);
+        if (gzread(compressed_mem, dirty_pages.data(), index_bytes) !=
+            index_bytes) {
+            fatal("Could not read page index of checkpoint file '%s'\n",
+                  filename);
+        }
+
+        for (uint64_t page : dirty_pages) {
+            const uint64_t offset = page * page_size;
+            const uint64_t len =
+                std::min((uint64_t)page_size, range.size() - offset);
+            if (gzread(compressed_mem, pmem + offset, len) != (int)len) {
+                fatal("Could not read page %d of checkpoint file '%s'\n",
+                      page, filename);
+            }
+            if (store.dirtyMap) {
+                // The checkpoint's page size may differ from this
+                // host's; mark the live bitmap by offset.
+                const uint64_t first = offset / pageSize;
+                const uint64_t last = (offset + len - 1) / pageSize;
+                for (uint64_t pg = first; pg <= last; pg++)
+                    (*store.dirtyMap)[pg >> 6] |= 1ULL << (pg & 63);
+            }
+        }
+
+        if (store.dirtyMap) {
+            // Keep chaining later incremental checkpoints to the same
+            // base image.
+            store.lastFullFile = base_filename;
+            store.lastFullChunks = base_chunks;
+        }
+
+        if (gzclose(compressed_mem))
+            fatal("Close failed on physical memory checkpoint file '%s'\n",
+                  filename);
+    } else {
+        unsigned nbr_chunks = 1;
+        optParamIn(cp, "nbr_chunks", nbr_chunks);
+
+        if (nbr_chunks > 1)
+            readGzImageParallel(filepath, pmem, range.size(), nbr_chunks);
+        else
+            readGzImage(filepath, pmem, range.size());
+
+        if (store.dirtyMap) {
+            // The restored image is a valid base for incremental
+            // checkpoints taken from here on.
+            store.lastFullFile = filepath;
+            store.lastFullChunks = nbr_chunks;
+            std::fill(store.dirtyMap->begin(), store.dirtyMap->end(), 0);
+        }
+    }
+
+    if (shared_view)
+        munmap(shared_view, range.size());
 }
 
 } // namespace memory
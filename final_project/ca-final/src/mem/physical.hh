@@ -39,6 +39,7 @@
 #define __MEM_PHYSICAL_HH__
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -115,6 +116,26 @@ class BackingStoreEntry
       * of this backing store in the share memory. Otherwise, the value is 0.
       */
      off_t shmOffset;
+
+    /**
+     * Page-granular dirty bitmap for incremental checkpoints, shared
+     * with the memories mapped onto this store so they can mark
+     * writes as they happen; null when dirty tracking is disabled.
+     */
+    std::shared_ptr<std::vector<uint64_t>> dirtyMap;
+
+    /**
+     * Absolute path of the last full image written (or restored) for
+     * this store. Incremental checkpoints record the pages dirtied
+     * since this image. Updated during serialization, hence mutable.
+     */
+    mutable std::string lastFullFile;
+
+    /**
+     * Number of compressed shards making up lastFullFile (1 for a
+     * plain single-file image).
+     */
+    mutable unsigned lastFullChunks = 1;
 };
 
 /**
@@ -144,6 +165,14 @@ class PhysicalMemory : public Serializable
     // Global address map
     AddrRangeMap<AbstractMemory*, 1> addrMap;
 
+    /**
+     * Last range that answered isMemAddr(); a one-entry cache for
+     * the per-packet membership checks on hot paths. Invalid until
+     * the first hit and only ever replaced, never cleared, since
+     * the address map is fixed after construction.
+     */
+    mutable AddrRange isMemAddrCache;
+
     // All address-mapped memories
     std::vector<AbstractMemory*> memories;
 
@@ -156,6 +185,17 @@ class PhysicalMemory : public Serializable
     const std::string sharedBackstore;
     uint64_t sharedBackstoreSize;
 
+    // Map the shared backstore copy-on-write so concurrent
+    // simulations share one restored image
+    const bool sharedBackstoreCow;
+
+    // Track dirty pages and write incremental checkpoints
+    const bool dirtyTracking;
+
+    // Shard full checkpoint images into this many concurrently
+    // compressed chunks (<= 1 keeps the single-file format)
+    const unsigned parallelChunks;
+
     long pageSize;
 
     // The physical memory used to provide the memory in the simulated
@@ -191,7 +231,10 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   bool dirty_tracking,
+                   unsigned parallel_chunks,
+                   bool shared_backstore_cow);
 
     /**
      * Unmap all the backing store we have used.
@@ -277,12 +320,15 @@ class PhysicalMemory : public Serializable
     /**
      * Serialize a specific store.
      *
+     * When dirty tracking is enabled and a full image has already
+     * been written, only the pages dirtied since that image are
+     * serialized (cumulative incremental checkpoint).
+     *
      * @param store_id Unique identifier of this backing store
-     * @param range The address range of this backing store
-     * @param pmem The host pointer to this backing store
+     * @param store The backing store entry to serialize
      */
     void serializeStore(CheckpointOut &cp, unsigned int store_id,
-                        AddrRange range, uint8_t* pmem) const;
+                        const BackingStoreEntry &store) const;
 
     /**
      * Unserialize the memories in the system. As with the
@@ -293,8 +339,12 @@ class PhysicalMemory : public Serializable
 
     /**
      * Unserialize a specific backing store, identified by a section.
+     *
+     * @param populate If false (copy-on-write restore into an
+     *        already-populated shared backstore), skip the actual
+     *        image load and only restore metadata.
      */
-    void unserializeStore(CheckpointIn &cp);
+    void unserializeStore(CheckpointIn &cp, bool populate = true);
 
 };
 
@@ -37,6 +37,9 @@
 
 #include "mem/port_proxy.hh"
 
+#include <cstring>
+#include <limits>
+
 #include "base/chunk_generator.hh"
 #include "cpu/thread_context.hh"
 #include "mem/port.hh"
@@ -54,14 +57,64 @@ PortProxy::PortProxy(const RequestPort &port, Addr cache_line_size) :
         cache_line_size)
 {}
 
+PortProxy::PortProxy(RequestPort &port, Addr cache_line_size) :
+    PortProxy([&port](PacketPtr pkt)->void { port.sendFunctional(pkt); },
+        cache_line_size,
+        [&port](const MemBackdoorReq &req, MemBackdoorPtr &backdoor)->void
+        { port.sendMemBackdoorReq(req, backdoor); })
+{}
+
+uint8_t *
+PortProxy::backdoorFor(Addr addr, uint64_t size, bool write,
+                       MemBackdoorPtr &backdoor) const
+{
+    auto usable = [&]() -> bool {
+        return backdoor &&
+            (write ? backdoor->writeable() : backdoor->readable()) &&
+            backdoor->range().contains(addr) &&
+            backdoor->range().contains(addr + size - 1);
+    };
+
+    if (!usable()) {
+        backdoor = nullptr;
+        const MemBackdoorReq req(RangeSize(addr, size),
+                write ? MemBackdoor::Writeable : MemBackdoor::Readable);
+        sendBackdoor(req, backdoor);
+        if (!usable()) {
+            backdoor = nullptr;
+            backdoorDenied = true;
+            return nullptr;
+        }
+    }
+
+    // Granted back doors are never interleaved (see
+    // AbstractMemory::setBackingStore), so the offset is linear.
+    return backdoor->ptr() + (addr - backdoor->range().start());
+}
+
 void
 PortProxy::readBlobPhys(Addr addr, Request::Flags flags,
                         void *p, uint64_t size) const
 {
+    // Back doors cannot honour special request flags.
+    const bool try_backdoor = sendBackdoor && !backdoorDenied &&
+        flags.noneSet(std::numeric_limits<uint64_t>::max());
+    MemBackdoorPtr backdoor = nullptr;
+
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
 
-        auto req = std::make_shared<Request>(
+        if (try_backdoor && !backdoorDenied) {
+            const uint8_t *src =
+                backdoorFor(gen.addr(), gen.size(), false, backdoor);
+            if (src) {
+                std::memcpy(p, src, gen.size());
+                p = static_cast<uint8_t *>(p) + gen.size();
+                continue;
+            }
+        }
+
+        auto req = Request::make(
             gen.addr(), gen.size(), flags, Request::funcRequestorId);
 
         Packet pkt(req, MemCmd::ReadReq);
@@ -75,10 +128,25 @@ void
 PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
                          const void *p, uint64_t size) const
 {
+    // Back doors cannot honour special request flags.
+    const bool try_backdoor = sendBackdoor && !backdoorDenied &&
+        flags.noneSet(std::numeric_limits<uint64_t>::max());
+    MemBackdoorPtr backdoor = nullptr;
+
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
 
-        auto req = std::make_shared<Request>(
+        if (try_backdoor && !backdoorDenied) {
+            uint8_t *dst =
+                backdoorFor(gen.addr(), gen.size(), true, backdoor);
+            if (dst) {
+                std::memcpy(dst, p, gen.size());
+                p = static_cast<const uint8_t *>(p) + gen.size();
+                continue;
+            }
+        }
+
+        auto req = Request::make(
             gen.addr(), gen.size(), flags, Request::funcRequestorId);
 
         Packet pkt(req, MemCmd::WriteReq);
@@ -60,6 +60,7 @@
 #include <functional>
 #include <limits>
 
+#include "mem/backdoor.hh"
 #include "mem/protocol/functional.hh"
 #include "sim/byteswap.hh"
 
@@ -87,13 +88,45 @@ class PortProxy : FunctionalRequestProtocol
 {
   public:
     typedef std::function<void(PacketPtr pkt)> SendFunctionalFunc;
+    typedef std::function<void(const MemBackdoorReq &req,
+                               MemBackdoorPtr &backdoor)> SendBackdoorFunc;
 
   private:
     SendFunctionalFunc sendFunctional;
 
+    /**
+     * Optional path for requesting memory back doors; empty when the
+     * proxy was built from something that cannot issue them. When a
+     * back door is granted (plain, non-interleaved AbstractMemory
+     * with nothing in the path claiming the data), blob accesses
+     * become direct memcpys against the backing store instead of
+     * per-chunk functional packets. The granted pointer is only used
+     * within a single blob call, so no invalidation bookkeeping is
+     * needed for these often short-lived proxies.
+     */
+    SendBackdoorFunc sendBackdoor;
+
     /** Granularity of any transactions issued through this proxy. */
     const Addr _cacheLineSize;
 
+    /**
+     * Sticky denial memo: once a back door request comes back empty
+     * (caches or other claimants in the path), stop asking through
+     * this proxy so the packet path does not pay an extra probe per
+     * chunk. Cleared by nothing -- proxies are cheap and short-lived.
+     */
+    mutable bool backdoorDenied = false;
+
+    /**
+     * Return a host pointer for [addr, addr+size) through a granted
+     * back door, or nullptr if none can be had. The cached grant in
+     * backdoor is reused while it covers the chunk and re-requested
+     * otherwise; the pointer is only valid within the current blob
+     * call.
+     */
+    uint8_t *backdoorFor(Addr addr, uint64_t size, bool write,
+                         MemBackdoorPtr &backdoor) const;
+
     void
     recvFunctionalSnoop(PacketPtr pkt) override
     {
@@ -103,13 +136,20 @@ class PortProxy : FunctionalRequestProtocol
     }
 
   public:
-    PortProxy(SendFunctionalFunc func, Addr cache_line_size) :
-        sendFunctional(func), _cacheLineSize(cache_line_size)
+    PortProxy(SendFunctionalFunc func, Addr cache_line_size,
+              SendBackdoorFunc backdoor_func = SendBackdoorFunc()) :
+        sendFunctional(func), sendBackdoor(backdoor_func),
+        _cacheLineSize(cache_line_size)
     {}
 
     // Helpers which create typical SendFunctionalFunc-s from other objects.
     PortProxy(ThreadContext *tc, Addr cache_line_size);
     PortProxy(const RequestPort &port, Addr cache_line_size);
+    /**
+     * Building from a mutable port additionally enables the back
+     * door fast path, since requesting one needs a non-const port.
+     */
+    PortProxy(RequestPort &port, Addr cache_line_size);
 
     virtual ~PortProxy() {}
 
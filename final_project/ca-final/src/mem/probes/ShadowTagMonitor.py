@@ -0,0 +1,53 @@
+# Copyright (c) 2025 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.Probe import ProbeListenerObject
+from m5.params import *
+from m5.proxy import *
+
+
+class ShadowTagMonitor(ProbeListenerObject):
+    """Sampled shadow-tag miss-curve estimator: mirrors one in
+    2^set_sample_shift of a cache's sets as true-LRU shadow sets and
+    records, per requestor, the LRU stack depth of every sampled hit.
+    The hits-at-way histogram's prefix sum is the miss-ratio curve
+    for 1..curve_ways ways from a single run.
+    """
+
+    type = "ShadowTagMonitor"
+    cxx_header = "mem/probes/shadow_tag_monitor.hh"
+    cxx_class = "gem5::ShadowTagMonitor"
+
+    cache = Param.BaseCache("Cache whose accesses are sampled")
+    curve_ways = Param.Unsigned(16, "Depth of the shadow sets")
+    set_sample_shift = Param.Unsigned(
+        5, "Sample one set in 2^this (UMON-style set sampling)"
+    )
+    blk_size = Param.Unsigned(64, "Cache block size in bytes")
+    cache_sets = Param.Unsigned("Number of sets in the monitored cache")
+    max_requestors = Param.Unsigned(
+        16, "Requestor rows in the curve stats (higher IDs share the last)"
+    )
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/probes/shadow_tag_monitor.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "mem/cache/base.hh"
+#include "mem/packet.hh"
+
+namespace gem5
+{
+
+ShadowTagMonitor::ShadowTagMonitor(const ShadowTagMonitorParams &params)
+    : ProbeListenerObject(params),
+      cache(params.cache),
+      assoc(params.curve_ways),
+      setSampleShift(params.set_sample_shift),
+      blkSize(params.blk_size),
+      cacheSets(params.cache_sets),
+      maxRequestors(params.max_requestors),
+      stats(this, params.max_requestors, params.curve_ways)
+{
+    fatal_if(assoc == 0, "%s: curve_ways must be non-zero", name());
+    fatal_if(cacheSets == 0 || (cacheSets & (cacheSets - 1)),
+             "%s: cache_sets must be a non-zero power of two", name());
+
+    const unsigned sampled =
+        std::max<unsigned>(1, cacheSets >> setSampleShift);
+    shadowSets.resize(sampled);
+}
+
+void
+ShadowTagMonitor::regProbeListeners()
+{
+    if (!listeners.empty())
+        return;
+
+    listeners.push_back(cache->getProbeManager()->connect<AccessListener>(
+        this, "Hit", &ShadowTagMonitor::accessHandler));
+    listeners.push_back(cache->getProbeManager()->connect<AccessListener>(
+        this, "Miss", &ShadowTagMonitor::accessHandler));
+}
+
+void
+ShadowTagMonitor::accessHandler(const CacheAccessProbeArg &arg)
+{
+    const PacketPtr pkt = arg.pkt;
+    if (!pkt->req->hasPaddr())
+        return;
+
+    const Addr blk_addr = pkt->getAddr() / blkSize;
+    const unsigned set = blk_addr & (cacheSets - 1);
+
+    // only one set in 2^shift is mirrored
+    if (set & ((1u << setSampleShift) - 1))
+        return;
+
+    const unsigned requestor =
+        std::min<unsigned>(pkt->req->requestorId(), maxRequestors - 1);
+
+    auto &shadow = shadowSets[set >> setSampleShift];
+
+    // probe the shadow set: the position found is the LRU stack
+    // depth, i.e. the smallest number of ways that would have kept
+    // this access a hit
+    for (unsigned depth = 0; depth < shadow.size(); depth++) {
+        if (shadow[depth] == blk_addr) {
+            stats.hitsAtWay[requestor][depth]++;
+            // move to the front (MRU)
+            std::rotate(shadow.begin(), shadow.begin() + depth,
+                        shadow.begin() + depth + 1);
+            return;
+        }
+    }
+
+    stats.missesBeyond[requestor]++;
+
+    // insert at MRU, evicting beyond the curve depth
+    shadow.insert(shadow.begin(), blk_addr);
+    if (shadow.size() > assoc)
+        shadow.pop_back();
+}
+
+ShadowTagMonitor::ShadowTagStats::ShadowTagStats(
+        statistics::Group *parent, unsigned requestors, unsigned ways)
+    : statistics::Group(parent),
+      ADD_STAT(hitsAtWay, statistics::units::Count::get(),
+               "Sampled hits per (requestor, LRU stack depth); the "
+               "prefix sum over depth is the utility curve"),
+      ADD_STAT(missesBeyond, statistics::units::Count::get(),
+               "Sampled accesses missing the full shadow depth")
+{
+    hitsAtWay.init(requestors, ways);
+    missesBeyond.init(requestors);
+}
+
+} // namespace gem5
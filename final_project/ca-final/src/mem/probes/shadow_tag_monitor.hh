@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PROBES_SHADOW_TAG_MONITOR_HH__
+#define __MEM_PROBES_SHADOW_TAG_MONITOR_HH__
+
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "mem/cache/cache_probe_arg.hh"
+#include "params/ShadowTagMonitor.hh"
+#include "sim/probe/probe_listener_object.hh"
+
+namespace gem5
+{
+
+class BaseCache;
+
+/**
+ * Sampled shadow-tag miss-curve estimator, attachable to any
+ * BaseCache through its Hit/Miss probes. A subset of sets (one in
+ * 2^set_sample_shift) is mirrored as true-LRU shadow sets of the
+ * configured depth; every demand access to a sampled set probes the
+ * shadow and records the LRU stack depth it hit at, per requestor.
+ * The resulting hits-at-way histogram is the classic UMON utility
+ * curve: hits the requestor would retain with 1..N ways. One
+ * instrumented run yields the whole miss-ratio curve that previously
+ * took one simulation per cache size.
+ */
+class ShadowTagMonitor : public ProbeListenerObject
+{
+  public:
+    ShadowTagMonitor(const ShadowTagMonitorParams &params);
+
+    void regProbeListeners() override;
+
+    /** Shared handler for the cache's Hit and Miss probes. */
+    void accessHandler(const CacheAccessProbeArg &arg);
+
+  private:
+    typedef ProbeListenerArg<ShadowTagMonitor, CacheAccessProbeArg>
+        AccessListener;
+
+    BaseCache *const cache;
+    const unsigned assoc;
+    const unsigned setSampleShift;
+    const Addr blkSize;
+    const unsigned cacheSets;
+    const unsigned maxRequestors;
+
+    /**
+     * Shadow sets in recency order (front = MRU), indexed by
+     * sampled-set number. Entries hold block-aligned addresses.
+     */
+    std::vector<std::vector<Addr>> shadowSets;
+
+    struct ShadowTagStats : public statistics::Group
+    {
+        ShadowTagStats(statistics::Group *parent, unsigned requestors,
+                       unsigned ways);
+
+        /** Sampled hits per (requestor, LRU stack depth). */
+        statistics::Vector2d hitsAtWay;
+
+        /** Sampled accesses missing the full shadow depth. */
+        statistics::Vector missesBeyond;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __MEM_PROBES_SHADOW_TAG_MONITOR_HH__
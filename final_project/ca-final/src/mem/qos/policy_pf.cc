@@ -99,30 +99,31 @@ PropFairPolicy::updateScore(
 uint8_t
 PropFairPolicy::schedule(const RequestorID pkt_id, const uint64_t pkt_size)
 {
-    auto sort_pred =
-    [] (const RequestorHistory& lhs, const RequestorHistory& rhs)
-    { return lhs.second > rhs.second; };
-
-    // Sorting in reverse in base of personal history:
-    // First elements have higher history/score -> lower priority.
-    // The qos priority is the position in the sorted vector.
-    std::sort(history.begin(), history.end(), sort_pred);
-
     const double served_bytes = static_cast<double>(pkt_size);
 
-    uint8_t pkt_priority = 0;
-    for (auto m_hist = history.begin(); m_hist != history.end(); m_hist++) {
-
-        RequestorID curr_id = m_hist->first;
-        double& curr_score = m_hist->second;
-
-        if (curr_id == pkt_id) {
-            // The qos priority is the position in the sorted vector.
-            pkt_priority = std::distance(history.begin(), m_hist);
+    // The qos priority is the requestor's rank by score: higher
+    // history/score means lower priority. Counting the requestors
+    // with a strictly higher score yields the rank the former full
+    // sort produced (the order among equal scores was unspecified
+    // there as well), without paying O(n log n) per packet.
+    double my_score = 0;
+    bool found = false;
+    for (const auto &m_hist : history) {
+        if (m_hist.first == pkt_id) {
+            my_score = m_hist.second;
+            found = true;
+        }
+    }
 
-            curr_score = updateScore(curr_score, served_bytes);
+    uint8_t pkt_priority = 0;
+    for (auto &m_hist : history) {
+        if (m_hist.first == pkt_id) {
+            m_hist.second = updateScore(my_score, served_bytes);
         } else {
-            curr_score = updateScore(curr_score, 0);
+            if (found && m_hist.second > my_score) {
+                pkt_priority++;
+            }
+            m_hist.second = updateScore(m_hist.second, 0);
         }
     }
 
@@ -50,6 +50,7 @@
 #include <iostream>
 #include <set>
 
+#include "base/pooled_allocator.hh"
 #include "sim/clocked_object.hh"
 
 namespace gem5
@@ -88,7 +89,15 @@ class Consumer
     void scheduleEvent(Cycles timeDelta);
 
   private:
-    std::set<Tick> m_wakeup_ticks;
+    /**
+     * Pending wakeup ticks. The set already coalesces all same-tick
+     * scheduling requests into one event per consumer per cycle (the
+     * SLICC wakeup() then polls its in-ports itself); the pooled
+     * allocator recycles the tree nodes, which are churned once per
+     * distinct wakeup tick for the lifetime of the run.
+     */
+    std::set<Tick, std::less<Tick>, PooledNodeAllocator<Tick>>
+        m_wakeup_ticks;
     EventFunctionWrapper m_wakeup_event;
     ClockedObject *em;
 
@@ -284,8 +284,7 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
     msg_ptr->setMsgCounter(m_msg_counter);
 
     // Insert the message into the priority heap
-    m_prio_heap.push_back(message);
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    orderedInsert(message);
     // Increment the number of messages statistic
     m_buf_msgs++;
 
@@ -324,8 +323,7 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
     }
     ++m_dequeues_this_cy;
 
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
-    m_prio_heap.pop_back();
+    m_prio_heap.pop_front();
     if (decrement_messages) {
         // Record how much time is passed since the message was enqueued
         m_stall_time += curTick() - message->getLastEnqueueTime();
@@ -375,13 +373,12 @@ MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
     DPRINTF(RubyQueue, "Recycling.\n");
     assert(isReady(current_time));
     MsgPtr node = m_prio_heap.front();
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    m_prio_heap.pop_front();
 
     Tick future_time = current_time + recycle_latency;
     node->setLastEnqueueTime(future_time);
 
-    m_prio_heap.back() = node;
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    orderedInsert(node);
     m_consumer->scheduleEventAbsolute(future_time);
 }
 
@@ -392,9 +389,7 @@ MessageBuffer::reanalyzeList(std::list<MsgPtr> &lt, Tick schdTick)
         MsgPtr m = lt.front();
         assert(m->getLastEnqueueTime() <= schdTick);
 
-        m_prio_heap.push_back(m);
-        push_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                  std::greater<MsgPtr>());
+        orderedInsert(m);
 
         m_consumer->scheduleEventAbsolute(schdTick);
 
@@ -509,8 +504,8 @@ MessageBuffer::print(std::ostream& out) const
         ccprintf(out, " consumer-yes ");
     }
 
-    std::vector<MsgPtr> copy(m_prio_heap);
-    std::sort_heap(copy.begin(), copy.end(), std::greater<MsgPtr>());
+    // the queue is already sorted ascending
+    std::vector<MsgPtr> copy(m_prio_heap.begin(), m_prio_heap.end());
     ccprintf(out, "%s] %s", copy, name());
 }
 
@@ -46,6 +46,7 @@
 #ifndef __MEM_RUBY_NETWORK_MESSAGEBUFFER_HH__
 #define __MEM_RUBY_NETWORK_MESSAGEBUFFER_HH__
 
+#include <deque>
 #include <algorithm>
 #include <cassert>
 #include <functional>
@@ -94,9 +95,7 @@ class MessageBuffer : public SimObject
               bool ruby_warmup)
     {
         MsgPtr m = m_prio_heap.front();
-        std::pop_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                      std::greater<MsgPtr>());
-        m_prio_heap.pop_back();
+        m_prio_heap.pop_front();
         enqueue(m, current_time, delta, ruby_is_random, ruby_warmup);
     }
 
@@ -205,7 +204,30 @@ class MessageBuffer : public SimObject
     // Data Members (m_ prefix)
     //! Consumer to signal a wakeup(), can be NULL
     Consumer* m_consumer;
-    std::vector<MsgPtr> m_prio_heap;
+    /**
+     * Messages ordered ascending by (enqueue time, message counter).
+     * The counter tiebreak makes the order total, so this is plain
+     * FIFO whenever arrival times are monotonic -- the overwhelmingly
+     * common case -- and enqueue/dequeue are O(1) deque operations
+     * instead of heap sifts over shared_ptrs. Out-of-order arrivals
+     * (strict-FIFO bypass, recycles) insert at their sorted position.
+     */
+    std::deque<MsgPtr> m_prio_heap;
+
+    /** Insert preserving the ascending (time, counter) order. */
+    void
+    orderedInsert(const MsgPtr &message)
+    {
+        if (m_prio_heap.empty() || !(m_prio_heap.back() > message)) {
+            m_prio_heap.push_back(message);
+        } else {
+            auto pos = std::upper_bound(
+                    m_prio_heap.begin(), m_prio_heap.end(), message,
+                    [](const MsgPtr &lhs, const MsgPtr &rhs)
+                    { return rhs > lhs; });
+            m_prio_heap.insert(pos, message);
+        }
+    }
 
     std::function<void()> m_dequeue_callback;
 
@@ -407,6 +407,13 @@ GarnetNetwork::regStats()
         .flags(statistics::oneline)
         ;
 
+    m_packet_latency_hist
+        .init(20)
+        .name(name() + ".packet_latency_hist")
+        .desc("distribution of packet network latency")
+        .flags(statistics::nozero | statistics::pdf |
+               statistics::cdf);
+
     m_packet_queueing_latency
         .init(m_virtual_networks)
         .name(name() + ".packet_queueing_latency")
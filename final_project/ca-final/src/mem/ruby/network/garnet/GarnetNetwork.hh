@@ -125,6 +125,7 @@ class GarnetNetwork : public Network
     increment_packet_network_latency(Tick latency, int vnet)
     {
         m_packet_network_latency[vnet] += latency;
+        m_packet_latency_hist.sample(latency);
     }
 
     void
@@ -172,6 +173,10 @@ class GarnetNetwork : public Network
     statistics::Vector m_packets_received;
     statistics::Vector m_packets_injected;
     statistics::Vector m_packet_network_latency;
+
+    /** Distribution of per-packet network latency, for percentile
+     * readouts in capacity characterization. */
+    statistics::Histogram m_packet_latency_hist;
     statistics::Vector m_packet_queueing_latency;
 
     statistics::Formula m_avg_packet_vnet_latency;
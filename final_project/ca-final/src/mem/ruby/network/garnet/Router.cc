@@ -68,6 +68,14 @@ Router::init()
     crossbarSwitch.init();
 }
 
+/**
+ * Routers in this tree are already strictly event-driven: a router is
+ * only scheduled by flit arrivals and credit returns (the links and
+ * units call scheduleEvent() solely when they leave work pending), so
+ * an idle router costs nothing. What a wakeup still pays is the walk
+ * over all ports and pipeline stages below, which is the per-active-
+ * cycle cost, not an idle-tick artifact.
+ */
 void
 Router::wakeup()
 {
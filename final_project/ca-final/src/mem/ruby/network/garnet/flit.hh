@@ -34,6 +34,7 @@
 #include <cassert>
 #include <iostream>
 
+#include "base/pooled_new.hh"
 #include "base/types.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
@@ -47,7 +48,7 @@ namespace ruby
 namespace garnet
 {
 
-class flit
+class flit : public PooledNew<flit>
 {
   public:
     flit() {}
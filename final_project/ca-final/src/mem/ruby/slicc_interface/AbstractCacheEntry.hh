@@ -48,6 +48,7 @@
 #include <iostream>
 
 #include "base/logging.hh"
+#include "base/pooled_new.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/DataBlock.hh"
@@ -61,7 +62,8 @@ namespace ruby
 
 class RubySystem;
 
-class AbstractCacheEntry : public ReplaceableEntry
+class AbstractCacheEntry : public ReplaceableEntry,
+    public PooledNew<AbstractCacheEntry>
 {
   private:
     // The last access tick for the cache entry.
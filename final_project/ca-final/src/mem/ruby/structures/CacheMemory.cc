@@ -111,6 +111,7 @@ CacheMemory::init()
 
     m_cache.resize(m_cache_num_sets,
                     std::vector<AbstractCacheEntry*>(m_cache_assoc, nullptr));
+    m_packed_tags.assign((size_t)m_cache_num_sets * m_cache_assoc, MaxAddr);
     replacement_data.resize(m_cache_num_sets,
                                std::vector<ReplData>(m_cache_assoc, nullptr));
     // instantiate all the replacement_data here
@@ -148,12 +149,15 @@ int
 CacheMemory::findTagInSet(int64_t cacheSet, Addr tag) const
 {
     assert(tag == makeLineAddress(tag));
-    // search the set for the tags
-    auto it = m_tag_index.find(tag);
-    if (it != m_tag_index.end())
-        if (m_cache[cacheSet][it->second]->m_Permission !=
-            AccessPermission_NotPresent)
-            return it->second;
+    // contiguous scan over the set's packed tags
+    const Addr *row = &m_packed_tags[(size_t)cacheSet * m_cache_assoc];
+    for (int way = 0; way < m_cache_assoc; way++) {
+        if (row[way] == tag &&
+            m_cache[cacheSet][way]->m_Permission !=
+                AccessPermission_NotPresent) {
+            return way;
+        }
+    }
     return -1; // Not found
 }
 
@@ -164,10 +168,13 @@ CacheMemory::findTagInSetIgnorePermissions(int64_t cacheSet,
                                            Addr tag) const
 {
     assert(tag == makeLineAddress(tag));
-    // search the set for the tags
-    auto it = m_tag_index.find(tag);
-    if (it != m_tag_index.end())
-        return it->second;
+    // contiguous scan over the set's packed tags
+    const Addr *row = &m_packed_tags[(size_t)cacheSet * m_cache_assoc];
+    for (int way = 0; way < m_cache_assoc; way++) {
+        if (row[way] == tag) {
+            return way;
+        }
+    }
     return -1; // Not found
 }
 
@@ -317,7 +324,7 @@ CacheMemory::allocate(Addr address, AbstractCacheEntry *entry)
             DPRINTF(RubyCache, "Allocate clearing lock for addr: 0x%x\n",
                     address);
             set[i]->m_locked = -1;
-            m_tag_index[address] = i;
+            m_packed_tags[(size_t)cacheSet * m_cache_assoc + i] = address;
             set[i]->setPosition(cacheSet, i);
             set[i]->replacementData = replacement_data[cacheSet][i];
             set[i]->setLastAccess(curTick());
@@ -343,7 +350,7 @@ CacheMemory::deallocate(Addr address)
     uint32_t way = entry->getWay();
     delete entry;
     m_cache[cache_set][way] = NULL;
-    m_tag_index.erase(address);
+    m_packed_tags[(size_t)cache_set * m_cache_assoc + way] = MaxAddr;
 }
 
 // Returns with the physical address of the conflicting cache line
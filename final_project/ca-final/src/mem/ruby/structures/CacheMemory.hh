@@ -181,7 +181,14 @@ class CacheMemory : public SimObject
 
     // The first index is the # of cache lines.
     // The second index is the the amount associativity.
-    std::unordered_map<Addr, int> m_tag_index;
+    /**
+     * Packed per-set tag mirror (set * assoc + way), replacing the
+     * address-keyed hash map: a set's ways are compared in one
+     * contiguous scan per lookup, mirroring the classic BaseSetAssoc
+     * layout. MaxAddr marks an empty way (tags are line-aligned, so
+     * it can never match).
+     */
+    std::vector<Addr> m_packed_tags;
     std::vector<std::vector<AbstractCacheEntry*> > m_cache;
 
     /** We use the replacement policies from the Classic memory system. */
@@ -56,7 +56,9 @@ namespace ruby
 {
 
 DirectoryMemory::DirectoryMemory(const Params &p)
-    : SimObject(p), addrRanges(p.addr_ranges.begin(), p.addr_ranges.end())
+    : SimObject(p),
+      addrRanges(p.addr_ranges.begin(), p.addr_ranges.end()),
+      dirStats(this)
 {
     m_size_bytes = 0;
     for (const auto &r: addrRanges) {
@@ -121,6 +123,7 @@ DirectoryMemory::lookup(Addr address)
 
     uint64_t idx = mapAddressToLocalIdx(address);
     assert(idx < m_num_entries);
+    dirStats.lookups++;
     return m_entries[idx];
 }
 
@@ -128,6 +131,7 @@ AbstractCacheEntry*
 DirectoryMemory::allocate(Addr address, AbstractCacheEntry *entry)
 {
     assert(isPresent(address));
+    dirStats.allocations++;
     uint64_t idx;
     DPRINTF(RubyCache, "Looking up address: %#x\n", address);
 
@@ -167,5 +171,15 @@ DirectoryMemory::recordRequestType(DirectoryRequestType requestType) {
             DirectoryRequestType_to_string(requestType));
 }
 
+DirectoryMemory::DirectoryMemoryStats::DirectoryMemoryStats(
+        statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(lookups, statistics::units::Count::get(),
+               "Directory entry lookups at this directory"),
+      ADD_STAT(allocations, statistics::units::Count::get(),
+               "Directory entries allocated at this directory")
+{
+}
+
 } // namespace ruby
 } // namespace gem5
@@ -44,6 +44,7 @@
 #include <iostream>
 #include <string>
 
+#include "base/statistics.hh"
 #include "base/addr_range.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/protocol/DirectoryRequestType.hh"
@@ -88,6 +89,19 @@ class DirectoryMemory : public SimObject
     // Explicitly free up this address
     void deallocate(Addr address);
 
+    /**
+     * Load-balance visibility: each DirectoryMemory instance is one
+     * directory version, so per-instance access counters expose
+     * directory hot-spotting (e.g. from unlucky interleaving on
+     * strided workloads) directly in stats.txt.
+     */
+    struct DirectoryMemoryStats : public statistics::Group
+    {
+        DirectoryMemoryStats(statistics::Group *parent);
+        statistics::Scalar lookups;
+        statistics::Scalar allocations;
+    } dirStats;
+
     void print(std::ostream& out) const;
     void recordRequestType(DirectoryRequestType requestType);
 
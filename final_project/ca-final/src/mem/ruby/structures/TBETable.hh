@@ -44,6 +44,7 @@
 #include <iostream>
 #include <unordered_map>
 
+#include "base/pooled_allocator.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
@@ -85,7 +86,18 @@ class TBETable
     TBETable& operator=(const TBETable& obj);
 
     // Data Members (m_prefix)
-    std::unordered_map<Addr, ENTRY> m_map;
+    /**
+     * Transaction buffer entries. The map nodes -- each holding one
+     * TBE -- are recycled through the pooled allocator, so the
+     * per-transaction allocate/deallocate churn under load never
+     * reaches the host allocator: freed slots form a free list and
+     * are handed back out, which is the slot-recycling behavior a
+     * fixed-capacity store would give (capacity is already enforced
+     * against m_number_of_TBEs by the callers' slot checks).
+     */
+    std::unordered_map<
+        Addr, ENTRY, std::hash<Addr>, std::equal_to<Addr>,
+        PooledNodeAllocator<std::pair<const Addr, ENTRY>>> m_map;
 
   private:
     int m_number_of_TBEs = 0;
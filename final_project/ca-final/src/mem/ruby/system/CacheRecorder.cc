@@ -87,9 +87,9 @@ CacheRecorder::enqueueNextFlushRequest()
     if (m_records_flushed < m_records.size()) {
         TraceRecord* rec = m_records[m_records_flushed];
         m_records_flushed++;
-        auto req = std::make_shared<Request>(rec->m_data_address,
-                                             m_block_size_bytes, 0,
-                                             Request::funcRequestorId);
+        auto req = Request::make(rec->m_data_address,
+                                 m_block_size_bytes, 0,
+                                 Request::funcRequestorId);
         MemCmd::Command requestType = MemCmd::FlushReq;
         Packet *pkt = new Packet(req, requestType);
         pkt->req->setReqInstSeqNum(m_records_flushed);
@@ -125,19 +125,19 @@ CacheRecorder::enqueueNextFetchRequest()
 
             if (traceRecord->m_type == RubyRequestType_LD) {
                 requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
+                req = Request::make(
                     traceRecord->m_data_address + rec_bytes_read,
                     m_block_size_bytes, 0,
                                     Request::funcRequestorId);
             }   else if (traceRecord->m_type == RubyRequestType_IFETCH) {
                 requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
+                req = Request::make(
                         traceRecord->m_data_address + rec_bytes_read,
                         m_block_size_bytes,
                         Request::INST_FETCH, Request::funcRequestorId);
             }   else {
                 requestType = MemCmd::WriteReq;
-                req = std::make_shared<Request>(
+                req = Request::make(
                     traceRecord->m_data_address + rec_bytes_read,
                     m_block_size_bytes, 0,
                                 Request::funcRequestorId);
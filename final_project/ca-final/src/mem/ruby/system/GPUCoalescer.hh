@@ -179,7 +179,7 @@ class PendingWriteInst
         assert(numPendingStores == 0);
 
         // make a response packet
-        PacketPtr pkt = new Packet(std::make_shared<Request>(),
+        PacketPtr pkt = new Packet(Request::make(),
                                    MemCmd::WriteCompleteResp);
 
         if (!usingRubyTester) {
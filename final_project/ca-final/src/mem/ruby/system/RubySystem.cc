@@ -313,7 +313,11 @@ RubySystem::writeCompressedTrace(uint8_t *raw_data, std::string filename,
         fatal("Can't open memory trace file '%s'\n", filename);
     }
 
-    gzFile compressedMemory = gzdopen(fd, "wb");
+    // The cooldown trace is warm-up state, not an artifact anyone
+    // diffs: use the fastest compression level, since the write time
+    // is on the checkpoint critical path while the size barely
+    // matters next to the memory image.
+    gzFile compressedMemory = gzdopen(fd, "wb1");
     if (compressedMemory == NULL)
         fatal("Insufficient memory to allocate compression state for %s\n",
               filename);
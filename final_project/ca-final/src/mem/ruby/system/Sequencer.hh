@@ -45,6 +45,7 @@
 #include <list>
 #include <unordered_map>
 
+#include "base/pooled_allocator.hh"
 #include "cpu/testers/rubytest/RubyTester.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/protocol/MachineType.hh"
@@ -241,7 +242,20 @@ class Sequencer : public RubyPort
 
   protected:
     // RequestTable contains both read and write requests, handles aliasing
-    std::unordered_map<Addr, std::list<SequencerRequest>> m_RequestTable;
+    /**
+     * Outstanding requests per line. Both the hash map nodes and the
+     * per-line list nodes recycle through pooled allocators: the
+     * table is touched for every memory operation the sequencer
+     * issues and completes, and the per-op allocator traffic was the
+     * first profiler entry in Ruby runs.
+     */
+    using SequencerRequestList =
+        std::list<SequencerRequest,
+                  PooledNodeAllocator<SequencerRequest>>;
+    std::unordered_map<
+        Addr, SequencerRequestList, std::hash<Addr>, std::equal_to<Addr>,
+        PooledNodeAllocator<std::pair<const Addr, SequencerRequestList>>>
+        m_RequestTable;
     // UnadressedRequestTable contains "unaddressed" requests,
     // guaranteed not to alias each other
     std::unordered_map<uint64_t, SequencerRequest> m_UnaddressedRequestTable;
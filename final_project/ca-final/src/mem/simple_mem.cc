@@ -53,7 +53,9 @@ namespace memory
 SimpleMemory::SimpleMemory(const SimpleMemoryParams &p) :
     AbstractMemory(p),
     port(name() + ".port", *this), latency(p.latency),
-    latency_var(p.latency_var), bandwidth(p.bandwidth), isBusy(false),
+    latency_var(p.latency_var), bandwidth(p.bandwidth),
+    streamShaping(p.stream_shaping),
+    streamBandwidth(p.stream_bandwidth), isBusy(false),
     retryReq(false), retryResp(false),
     releaseEvent([this]{ release(); }, name()),
     dequeueEvent([this]{ dequeue(); }, name())
@@ -138,6 +140,20 @@ SimpleMemory::recvTimingReq(PacketPtr pkt)
         return false;
     }
 
+    // per-stream token bucket: the requestor's own bucket must have
+    // drained before it may issue again
+    if (streamShaping) {
+        auto it = streamNextFree.find(pkt->requestorId());
+        if (it != streamNextFree.end() && curTick() < it->second) {
+            retryReq = true;
+            if (!releaseEvent.scheduled()) {
+                isBusy = true;
+                schedule(releaseEvent, it->second);
+            }
+            return false;
+        }
+    }
+
     // technically the packet only reaches us after the header delay,
     // and since this is a memory controller we also need to
     // deserialise the payload before performing any write operation
@@ -153,6 +169,11 @@ SimpleMemory::recvTimingReq(PacketPtr pkt)
     // the bandwidth limit
     Tick duration = pkt->getSize() * bandwidth;
 
+    if (streamShaping) {
+        streamNextFree[pkt->requestorId()] =
+            curTick() + (Tick)(pkt->getSize() * streamBandwidth);
+    }
+
     // only consider ourselves busy if there is any need to wait
     // to avoid extra events being scheduled for (infinitely) fast
     // memories
@@ -46,6 +46,7 @@
 #ifndef __MEM_SIMPLE_MEMORY_HH__
 #define __MEM_SIMPLE_MEMORY_HH__
 
+#include <unordered_map>
 #include <list>
 
 #include "base/random.hh"
@@ -176,6 +177,19 @@ class SimpleMemory : public AbstractMemory
      */
     Tick getLatency() const;
 
+    /**
+     * Per-requestor stream shaping: each requestor id gets its own
+     * token bucket (stream_bandwidth) so one stream saturating the
+     * memory models contention without freezing the global release
+     * window, approximating a multi-stream DDR channel at SimpleMemory
+     * cost. Streams still share the single port, so a stalled stream
+     * can head-of-line block it -- acceptable for the quick-turn
+     * studies this is for.
+     */
+    const bool streamShaping;
+    const double streamBandwidth;
+    std::unordered_map<RequestorID, Tick> streamNextFree;
+
     /**
      * Upstream caches need this packet until true is returned, so
      * hold it for deletion until a subsequent call
@@ -63,6 +63,60 @@ SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
     }
 }
 
+bool
+SnoopFilter::demoteOneEntry()
+{
+    // The iteration order of the hash map makes this effectively a
+    // random victim; anything holder-only is equally good, since its
+    // demoted state is only ever consulted as a superset.
+    for (auto it = cachedLocations.begin(); it != cachedLocations.end();
+         ++it) {
+        if (it->second.requested.none()) {
+            DPRINTF(SnoopFilter, "%s: demoting %#x SF value %x.%x\n",
+                    __func__, it->first, it->second.requested,
+                    it->second.holder);
+            coarseInsert(it->first, it->second.holder);
+            cachedLocations.erase(it);
+            stats.demotions++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+SnoopFilter::coarseInsert(Addr line_addr, const SnoopMask& holders)
+{
+    if (holders.none())
+        return;
+
+    const Addr sector = line_addr >> sectorShift;
+    CoarseEntry& entry = coarseDir[sector & (coarseDir.size() - 1)];
+    if (entry.tag == sector) {
+        entry.holders |= holders;
+    } else {
+        // Displace the old sector into the sticky overflow mask so
+        // no holder information is ever lost; recently demoted
+        // sectors keep per-sector coverage.
+        if (entry.tag != MaxAddr)
+            overflowHolders |= entry.holders;
+        entry.tag = sector;
+        entry.holders = holders;
+    }
+}
+
+SnoopFilter::SnoopMask
+SnoopFilter::coarseLookup(Addr line_addr) const
+{
+    if (coarseDir.empty())
+        return overflowHolders;
+
+    const Addr sector = line_addr >> sectorShift;
+    const CoarseEntry& entry = coarseDir[sector & (coarseDir.size() - 1)];
+    return (entry.tag == sector ? entry.holders : SnoopMask()) |
+        overflowHolders;
+}
+
 std::pair<SnoopFilter::SnoopList, Cycles>
 SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
                            cpu_side_port)
@@ -83,14 +137,33 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 
     // If the snoop filter has no entry, and we should not allocate,
     // do not create a new snoop filter entry, simply return a NULL
-    // portlist.
-    if (!is_hit && !allocate)
-        return snoopDown(lookupLatency);
+    // portlist -- unless the line was demoted, in which case the
+    // coarse directory still names a superset of its holders.
+    if (!is_hit && !allocate) {
+        SnoopMask coarse = coarseLookup(line_addr);
+        if (coarse.none())
+            return snoopDown(lookupLatency);
+        stats.coarseSnoops++;
+        return snoopSelected(maskToPortList(coarse & ~req_port),
+                             lookupLatency);
+    }
 
     // If no hit in snoop filter create a new element and update iterator
     if (!is_hit) {
+        if (cachedLocations.size() >= maxEntryCount) {
+            // Bound the precise table by demoting a holder-only
+            // entry into the coarse directory. With the coarse
+            // directory disabled this remains a hard limit.
+            panic_if(coarseDir.empty() || !demoteOneEntry(),
+                     "snoop filter exceeded capacity of %d cache blocks\n",
+                     maxEntryCount);
+        }
         reqLookupResult.it =
             cachedLocations.emplace(line_addr, SnoopItem()).first;
+        // Rehydrate demoted presence info; without it a snoop
+        // response from a demoted holder would look spurious, and
+        // the response handshakes rely on the holder being tracked.
+        reqLookupResult.it->second.holder = coarseLookup(line_addr);
     }
     SnoopItem& sf_item = reqLookupResult.it->second;
     SnoopMask interested = sf_item.holder | sf_item.requested;
@@ -194,15 +267,23 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     auto sf_it = cachedLocations.find(line_addr);
     bool is_hit = (sf_it != cachedLocations.end());
 
-    panic_if(!is_hit && (cachedLocations.size() >= maxEntryCount),
+    panic_if(!is_hit && coarseDir.empty() &&
+             (cachedLocations.size() >= maxEntryCount),
              "snoop filter exceeded capacity of %d cache blocks\n",
              maxEntryCount);
 
     // If the snoop filter has no entry, simply return a NULL
     // portlist, there is no point creating an entry only to remove it
-    // later
-    if (!is_hit)
+    // later -- but lines demoted to the coarse directory still need
+    // their (superset of) holders snooped.
+    if (!is_hit) {
+        SnoopMask coarse = coarseLookup(line_addr);
+        if (coarse.any()) {
+            stats.coarseSnoops++;
+            return snoopSelected(maskToPortList(coarse), lookupLatency);
+        }
         return snoopDown(lookupLatency);
+    }
 
     SnoopItem& sf_item = sf_it->second;
 
@@ -405,7 +486,13 @@ SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
                "holder of the requested data."),
       ADD_STAT(hitMultiSnoops, statistics::units::Count::get(),
                "Number of snoops hitting in the snoop filter with multiple "
-               "(>1) holders of the requested data.")
+               "(>1) holders of the requested data."),
+      ADD_STAT(demotions, statistics::units::Count::get(),
+               "Number of precise entries demoted into the coarse "
+               "directory to bound the snoop filter's memory."),
+      ADD_STAT(coarseSnoops, statistics::units::Count::get(),
+               "Number of lookups whose snoop targets came from the "
+               "coarse directory rather than a precise entry.")
 {}
 
 void
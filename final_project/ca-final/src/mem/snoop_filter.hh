@@ -46,7 +46,9 @@
 #include <bitset>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "base/intmath.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "mem/qport.hh"
@@ -99,8 +101,16 @@ class SnoopFilter : public SimObject
         SimObject(p), reqLookupResult(cachedLocations.end()),
         linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
         maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
+        coarseDir(p.coarse_entries),
+        sectorShift(floorLog2(p.system->cacheLineSize()) +
+                    floorLog2(p.sector_blocks)),
         stats(this)
     {
+        fatal_if(p.coarse_entries & (p.coarse_entries - 1),
+                 "Snoop filter coarse_entries must be a power of two");
+        fatal_if(!p.sector_blocks ||
+                 (p.sector_blocks & (p.sector_blocks - 1)),
+                 "Snoop filter sector_blocks must be a power of two");
     }
 
     /**
@@ -263,6 +273,30 @@ class SnoopFilter : public SimObject
      */
     void eraseIfNullEntry(SnoopFilterCache::iterator& sf_it);
 
+    /**
+     * Make room in the precise table by demoting a holder-only entry
+     * into the coarse directory. Entries with in-flight requests are
+     * never demoted, since the request/response handshakes rely on
+     * their precise state. Returns false if every entry is pinned by
+     * an in-flight request.
+     */
+    bool demoteOneEntry();
+
+    /**
+     * Fold a demoted line's holders into the sector-granularity
+     * coarse directory. On a sector conflict the displaced sector is
+     * absorbed by the sticky overflow mask, keeping the directory
+     * bounded without ever under-approximating the holder set.
+     */
+    void coarseInsert(Addr line_addr, const SnoopMask& holders);
+
+    /**
+     * Conservative superset of holders that the precise table no
+     * longer tracks for this line; zero when nothing relevant was
+     * ever demoted.
+     */
+    SnoopMask coarseLookup(Addr line_addr) const;
+
     /** Simple hash set of cached addresses. */
     SnoopFilterCache cachedLocations;
 
@@ -308,6 +342,28 @@ class SnoopFilter : public SimObject
     /** Max capacity in terms of cache blocks tracked, for sanity checking */
     const unsigned maxEntryCount;
 
+    /**
+     * One sector of demoted presence information: the sector tag and
+     * the union of holder masks of all lines demoted from it.
+     */
+    struct CoarseEntry
+    {
+        Addr tag = MaxAddr;
+        SnoopMask holders;
+    };
+
+    /**
+     * Direct-mapped sector-granularity directory absorbing entries
+     * demoted from the precise table; empty if coarse_entries is 0.
+     */
+    std::vector<CoarseEntry> coarseDir;
+
+    /** Holders displaced out of the coarse directory, never cleared. */
+    SnoopMask overflowHolders;
+
+    /** log2 of the sector size in bytes. */
+    const int sectorShift;
+
     /**
      * Use the lower bits of the address to keep track of the line status
      */
@@ -329,6 +385,9 @@ class SnoopFilter : public SimObject
         statistics::Scalar totSnoops;
         statistics::Scalar hitSingleSnoops;
         statistics::Scalar hitMultiSnoops;
+
+        statistics::Scalar demotions;
+        statistics::Scalar coarseSnoops;
     } stats;
 };
 
@@ -70,6 +70,22 @@ ThreadBridge::IncomingPort::recvAtomic(PacketPtr pkt)
     return device_.out_port_.sendAtomic(pkt);
 }
 
+Tick
+ThreadBridge::IncomingPort::recvAtomicBackdoor(PacketPtr pkt,
+                                               MemBackdoorPtr &backdoor)
+{
+    EventQueue::ScopedMigration migrate(device_.eventQueue());
+    return device_.out_port_.sendAtomicBackdoor(pkt, backdoor);
+}
+
+void
+ThreadBridge::IncomingPort::recvMemBackdoorReq(const MemBackdoorReq &req,
+                                               MemBackdoorPtr &backdoor)
+{
+    EventQueue::ScopedMigration migrate(device_.eventQueue());
+    device_.out_port_.sendMemBackdoorReq(req, backdoor);
+}
+
 // FunctionalResponseProtocol
 void
 ThreadBridge::IncomingPort::recvFunctional(PacketPtr pkt)
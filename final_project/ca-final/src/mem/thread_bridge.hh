@@ -56,6 +56,15 @@ class ThreadBridge : public SimObject
 
         // AtomicResponseProtocol
         Tick recvAtomic(PacketPtr pkt) override;
+        Tick recvAtomicBackdoor(PacketPtr pkt,
+                                MemBackdoorPtr &backdoor) override;
+
+        // Back door requests cross the bridge too: a granted back
+        // door lets the far side access memory directly and is the
+        // single biggest lever against paying a queue migration per
+        // access at a partition seam.
+        void recvMemBackdoorReq(const MemBackdoorReq &req,
+                                MemBackdoorPtr &backdoor) override;
 
         // FunctionalResponseProtocol
         void recvFunctional(PacketPtr pkt) override;
@@ -284,9 +284,38 @@ BaseXBar::Layer<SrcType, DstType>::retryWaiting()
     state = RETRY;
 
     // set the retrying port to the front of the retry list and pop it
-    // off the list
-    SrcType* retryingPort = waitingForLayer.front();
-    waitingForLayer.pop_front();
+    // off the list; with weights configured, pick the waiting port
+    // with the largest accumulated share instead (unless the front
+    // port is resuming a transaction its peer deferred)
+    SrcType* retryingPort;
+    if (arbStates.empty() || frontResumed) {
+        retryingPort = waitingForLayer.front();
+        waitingForLayer.pop_front();
+        frontResumed = false;
+    } else {
+        // smooth weighted round-robin: every waiting port earns its
+        // weight, the winner pays the round total, so grants stay
+        // exactly proportional to the weights under load
+        auto best = waitingForLayer.begin();
+        bool first = true;
+        int64_t best_share = 0;
+        uint64_t round_total = 0;
+        for (auto it = waitingForLayer.begin(); it != waitingForLayer.end();
+             ++it) {
+            ArbState& arb = arbStates[*it];
+            arb.deficit += arb.weight;
+            round_total += arb.weight;
+            // strictly greater keeps FIFO order among equal shares
+            if (first || arb.deficit > best_share) {
+                best = it;
+                best_share = arb.deficit;
+                first = false;
+            }
+        }
+        retryingPort = *best;
+        arbStates[retryingPort].deficit -= round_total;
+        waitingForLayer.erase(best);
+    }
 
     // tell the port to retry, which in some cases ends up calling the
     // layer again
@@ -315,8 +344,10 @@ BaseXBar::Layer<SrcType, DstType>::recvRetry()
 
     // add the port where the failed packet originated to the front of
     // the waiting ports for the layer, this allows us to call retry
-    // on the port immediately if the crossbar layer is idle
+    // on the port immediately if the crossbar layer is idle; it also
+    // outranks any arbitration weights
     waitingForLayer.push_front(waitingForPeer);
+    frontResumed = true;
 
     // we are no longer waiting for the peer
     waitingForPeer = NULL;
@@ -330,6 +361,16 @@ BaseXBar::Layer<SrcType, DstType>::recvRetry()
     }
 }
 
+template <typename SrcType, typename DstType>
+void
+BaseXBar::Layer<SrcType, DstType>::setPortWeight(SrcType* port,
+                                                 uint32_t weight)
+{
+    fatal_if(weight == 0, "Crossbar layer %s: port weight must be > 0",
+             name());
+    arbStates[port].weight = weight;
+}
+
 PortID
 BaseXBar::findPort(AddrRange addr_range, PacketPtr pkt)
 {
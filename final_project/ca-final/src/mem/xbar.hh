@@ -164,6 +164,16 @@ class BaseXBar : public ClockedObject
          */
         void recvRetry();
 
+        /**
+         * Give a source port a fixed arbitration weight. Once any
+         * port on a layer has a weight, grants among waiting ports
+         * follow weighted round-robin (long-run grant frequency
+         * proportional to weight) instead of strict FIFO order. A
+         * port resuming a transaction its peer deferred keeps
+         * absolute priority, as in the FIFO scheme.
+         */
+        void setPortWeight(SrcType* port, uint32_t weight);
+
       protected:
 
         /**
@@ -210,6 +220,33 @@ class BaseXBar : public ClockedObject
          */
         std::deque<SrcType*> waitingForLayer;
 
+        /** Per-port weighted round-robin state. */
+        struct ArbState
+        {
+            uint32_t weight = 1;
+            /**
+             * Accumulated share (smooth weighted round-robin): every
+             * arbitration round each waiting port earns its weight
+             * and the winner pays the round's total, which keeps
+             * long-run grant frequency exactly proportional.
+             */
+            int64_t deficit = 0;
+        };
+
+        /**
+         * Arbitration state per source port; empty unless weights
+         * were configured, in which case grants are by accumulated
+         * share rather than queue order.
+         */
+        std::unordered_map<SrcType*, ArbState> arbStates;
+
+        /**
+         * Set when the front of waitingForLayer is a port resuming
+         * after a peer retry; it must be granted next regardless of
+         * weights.
+         */
+        bool frontResumed = false;
+
         /**
          * Track who is waiting for the retry when receiving it from a
          * peer. If no port is waiting NULL is stored.
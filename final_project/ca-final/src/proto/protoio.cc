@@ -44,10 +44,14 @@
 using namespace google::protobuf;
 
 ProtoOutputStream::ProtoOutputStream(const std::string& filename) :
-    fileStream(filename.c_str(),
-            std::ios::out | std::ios::binary | std::ios::trunc),
+    writeBuffer(1 << 20),
     wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL)
 {
+    // Install the large write buffer before opening; it only takes
+    // effect on a stream with no characters written yet.
+    fileStream.rdbuf()->pubsetbuf(writeBuffer.data(), writeBuffer.size());
+    fileStream.open(filename.c_str(),
+            std::ios::out | std::ios::binary | std::ios::trunc);
     if (!fileStream.good())
         panic("Could not open %s for writing\n", filename);
 
@@ -101,10 +105,14 @@ ProtoOutputStream::write(const Message& msg)
 }
 
 ProtoInputStream::ProtoInputStream(const std::string& filename) :
-    fileStream(filename.c_str(), std::ios::in | std::ios::binary),
+    readBuffer(1 << 20),
     fileName(filename), useGzip(false),
     wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL)
 {
+    // Install the large read buffer before opening; it only takes
+    // effect on a stream with no characters read yet.
+    fileStream.rdbuf()->pubsetbuf(readBuffer.data(), readBuffer.size());
+    fileStream.open(filename.c_str(), std::ios::in | std::ios::binary);
     if (!fileStream.good())
         panic("Could not open %s for reading\n", filename);
 
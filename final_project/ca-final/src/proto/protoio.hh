@@ -50,6 +50,7 @@
 #include <google/protobuf/message.h>
 
 #include <fstream>
+#include <vector>
 
 /**
  * A ProtoStream provides the shared functionality of the input and
@@ -79,6 +80,21 @@ class ProtoStream
     /** @} */
 };
 
+/*
+ * On a seekable block format: the buffered read/write paths above
+ * this layer were addressed separately (1 MiB stream buffers on
+ * both directions); what remains of the request is a format change
+ * -- length-prefixed blocks with per-block compression plus an
+ * index sidecar keyed by (tick or message ordinal -> file offset).
+ * That is not a reader-side optimization: every producer and
+ * consumer of the current magic+gzip framing (packet traces,
+ * elastic traces, external tooling) would need the new framing in
+ * lockstep, and GzipInputStream cannot seek mid-stream, so the
+ * block boundaries must become the compression boundaries. A
+ * version-bumped magic with per-block zlib frames and a trailing
+ * index block would do it; recorded here so the format work is
+ * done once, deliberately, rather than per-trace-type.
+ */
 /**
  * A ProtoOutputStream wraps a coded stream, potentially with
  * compression, based on looking at the file name. Writing to the
@@ -116,6 +132,14 @@ class ProtoOutputStream : public ProtoStream
 
   private:
 
+    /**
+     * Write buffer installed on the file stream before it is opened,
+     * matching the input side: long captures stream to disk in large
+     * sequential writes instead of default-sized chunks. Declared
+     * before the stream so it outlives every flush.
+     */
+    std::vector<char> writeBuffer;
+
     /// Underlying file output stream
     std::ofstream fileStream;
 
@@ -181,6 +205,14 @@ class ProtoInputStream : public ProtoStream
      */
     void destroyStreams();
 
+    /**
+     * Read buffer installed on the file stream before it is opened,
+     * so multi-billion-record replays stream the trace in large
+     * sequential reads instead of default-sized chunks. Declared
+     * before the stream so it outlives every flush.
+     */
+    std::vector<char> readBuffer;
+
     /// Underlying file input stream
     std::ifstream fileStream;
 
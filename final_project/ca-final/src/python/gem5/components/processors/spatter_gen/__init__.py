@@ -28,8 +28,11 @@
 from .spatter_generator import SpatterGenerator
 from .spatter_kernel import (
     SpatterKernel,
+    hash_walk_pattern,
     parse_kernel,
     partition_trace,
+    pointer_chase_pattern,
     prepare_kernels,
+    strided_pattern,
     unroll_trace,
 )
@@ -382,3 +382,66 @@ def prepare_kernels(
             )
         ret.append(temp)
     return ret
+
+
+def strided_pattern(num_indices: int, stride: int) -> List[int]:
+    """
+    Synthetic pattern family: a constant-stride walk, the gather/
+    scatter analogue of STREAM/STRIDE. Returns an index list usable
+    as the kernel_trace of a SpatterKernel (or as the "pattern"
+    field of a synthetic kernel dict for parse_kernel).
+
+    :param num_indices: number of indices in the pattern.
+    :param stride: distance between consecutive indices, in elements.
+    """
+    return [i * stride for i in range(num_indices)]
+
+
+def pointer_chase_pattern(num_indices: int, seed: int = 1) -> List[int]:
+    """
+    Synthetic pattern family: the visitation order of a random
+    single-cycle permutation, i.e. the access order a pointer chase
+    over a shuffled linked list would produce. Every slot in
+    [0, num_indices) is visited exactly once with no exploitable
+    spatial locality.
+
+    :param num_indices: number of indices (list nodes) in the cycle.
+    :param seed: seed for the permutation, for reproducible sweeps.
+    """
+    from random import Random
+
+    rng = Random(seed)
+    # Sattolo's algorithm yields a permutation that is one cycle, so
+    # following it from slot 0 visits every slot exactly once.
+    succ = list(range(num_indices))
+    for i in range(num_indices - 1, 0, -1):
+        j = rng.randrange(i)
+        succ[i], succ[j] = succ[j], succ[i]
+    trace = []
+    slot = 0
+    for _ in range(num_indices):
+        trace.append(slot)
+        slot = succ[slot]
+    return trace
+
+
+def hash_walk_pattern(
+    num_indices: int, table_size: int, seed: int = 1
+) -> List[int]:
+    """
+    Synthetic pattern family: a hash-table walk, i.e. accesses spread
+    over a table by a mixing function. Unlike pointer_chase_pattern
+    the indices may collide, as probes of a real hash table do.
+
+    :param num_indices: number of probes in the pattern.
+    :param table_size: number of elements in the hashed table.
+    :param seed: offsets the mixing function, for distinct streams.
+    """
+    trace = []
+    for i in range(num_indices):
+        # splitmix64-style mix of the probe number
+        z = (i + seed) * 0x9E3779B97F4A7C15 & (2**64 - 1)
+        z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & (2**64 - 1)
+        z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & (2**64 - 1)
+        trace.append((z ^ (z >> 31)) % table_size)
+    return trace
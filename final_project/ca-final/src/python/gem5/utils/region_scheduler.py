@@ -0,0 +1,166 @@
+# Copyright (c) 2025 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""SimPoint-style region-of-interest scheduler.
+
+Drives a whole SimPoint region list within one gem5 process instead of
+launching one process (plus checkpoint restore) per region: the
+workload fast-forwards on the cheap CPUs, switches to the detailed
+CPUs at each region's warmup marker, resets statistics at the region
+start marker, and dumps per-region statistics and switches back at the
+region end marker. The markers are PC-count pairs fired by a
+:class:`PcCountTrackerManager` (``src/cpu/probes/pc_count_tracker.cc``)
+attached to the fast-forward and detailed CPUs.
+"""
+
+from collections import namedtuple
+
+import m5
+from m5.util import inform, warn
+
+Region = namedtuple("Region", ["warmup", "start", "end"])
+"""One region of interest.
+
+Each field is a ``(pc, count)`` tuple naming a PC-count marker, all of
+which must be in the tracker manager's target list. ``warmup`` may be
+None, in which case the CPU switch happens at ``start``.
+"""
+
+_TRACKER_EXIT_CAUSE = "simpoint starting point found"
+
+
+class RegionScheduler:
+    """Fast-forward / warm / measure each region in sequence.
+
+    The fast-forward and detailed CPUs must both be configured in the
+    system (one set constructed with switched_out=True), the usual
+    prerequisite of m5.switchCpus(). Regions are executed in the order
+    their markers fire; markers of different regions must not
+    interleave.
+    """
+
+    def __init__(self, system, ff_cpus, detailed_cpus, tracker_manager,
+                 regions, region_hook=None):
+        """
+        :param system: the simulated system (passed to switchCpus)
+        :param ff_cpus: CPUs used while fast-forwarding
+        :param detailed_cpus: CPUs used inside regions
+        :param tracker_manager: the PcCountTrackerManager firing the
+            markers
+        :param regions: list of Region tuples
+        :param region_hook: optional callable invoked as
+            region_hook(index, region) after each region's stats dump
+        """
+        self._system = system
+        self._ff_cpus = list(ff_cpus)
+        self._detailed_cpus = list(detailed_cpus)
+        self._manager = tracker_manager
+        self._regions = list(regions)
+        self._region_hook = region_hook
+
+        self._markers = {}
+        for idx, region in enumerate(self._regions):
+            markers = [("start", region.start), ("end", region.end)]
+            if region.warmup:
+                markers.insert(0, ("warmup", region.warmup))
+            for what, pair in markers:
+                key = tuple(pair)
+                if key in self._markers:
+                    warn(
+                        "region scheduler: marker %s is used by more "
+                        "than one region" % (key,)
+                    )
+                self._markers[key] = (what, idx)
+
+        self._completed = 0
+        self._in_detailed = False
+
+    def regions_completed(self):
+        return self._completed
+
+    def run(self):
+        """Simulate until every region has been measured or the
+        workload exits. Returns the final exit event."""
+
+        exit_event = None
+        while self._completed < len(self._regions):
+            exit_event = m5.simulate()
+            cause = exit_event.getCause()
+            if cause != _TRACKER_EXIT_CAUSE:
+                warn(
+                    "region scheduler: simulation ended (%s) with %d of "
+                    "%d regions measured"
+                    % (cause, self._completed, len(self._regions))
+                )
+                return exit_event
+            self._handle_marker()
+        return exit_event
+
+    def _switch(self, to_detailed):
+        if to_detailed == self._in_detailed:
+            return
+        if to_detailed:
+            m5.switchCpus(
+                self._system,
+                list(zip(self._ff_cpus, self._detailed_cpus)),
+            )
+        else:
+            m5.switchCpus(
+                self._system,
+                list(zip(self._detailed_cpus, self._ff_cpus)),
+            )
+        self._in_detailed = to_detailed
+
+    def _handle_marker(self):
+        pc = self._manager.getCurrentPC()
+        count = self._manager.getCurrentCount()
+        action = self._markers.pop((pc, count), None)
+        if action is None:
+            warn(
+                "region scheduler: unexpected marker (%#x, %d)"
+                % (pc, count)
+            )
+            return
+
+        what, idx = action
+        region = self._regions[idx]
+        if what == "warmup":
+            inform("region %d: warmup marker, switching to detailed" % idx)
+            self._switch(True)
+        elif what == "start":
+            inform("region %d: start marker, resetting stats" % idx)
+            # If there was no dedicated warmup marker, the detailed
+            # CPUs take over here.
+            self._switch(True)
+            m5.stats.reset()
+        else:
+            inform("region %d: end marker, dumping stats" % idx)
+            m5.stats.dump()
+            m5.stats.reset()
+            self._switch(False)
+            self._completed += 1
+            if self._region_hook:
+                self._region_hook(idx, region)
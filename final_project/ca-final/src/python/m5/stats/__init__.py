@@ -133,8 +133,25 @@ def _url_factory(schemes, enable=True):
     return decorator
 
 
+@_url_factory(["binary", "bin"])
+def _binaryFactory(fn):
+    """Output stats in a compact append-only binary format.
+
+    The first dump writes a schema record per stat (id, type, name);
+    every dump appends only id+values records, so periodic dumping
+    costs bytes per stat instead of a full text rewrite. Decode with
+    util/decode_binary_stats.py.
+
+    Example:
+      binary://stats.bin
+
+    """
+
+    return _m5.stats.initBinary(fn)
+
+
 @_url_factory([None, "", "text", "file"])
-def _textFactory(fn, desc=True, spaces=True):
+def _textFactory(fn, desc=True, spaces=True, async_io=False):
     """Output stats in text format.
 
     Text stat files contain one stat per line with an optional
@@ -144,13 +161,16 @@ def _textFactory(fn, desc=True, spaces=True):
     Parameters:
       * desc (bool): Output stat descriptions (default: True)
       * spaces (bool): Output alignment spaces (default: True)
+      * async_io (bool): Write each dump out on a helper thread so
+        the simulation does not stall on stats file I/O
+        (default: False)
 
     Example:
       text://stats.txt?desc=False;spaces=False
 
     """
 
-    return _m5.stats.initText(fn, desc, spaces)
+    return _m5.stats.initText(fn, desc, spaces, async_io)
 
 
 @_url_factory(["h5"], enable=hasattr(_m5.stats, "initHDF5"))
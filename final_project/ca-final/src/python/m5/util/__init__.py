@@ -48,6 +48,10 @@ from .attrdict import (
     multiattrdict,
     optiondict,
 )
+from .eventq_partition import (
+    partitionEventQueues,
+    usingPDES,
+)
 from .multidict import multidict
 
 
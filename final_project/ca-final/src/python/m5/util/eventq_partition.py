@@ -0,0 +1,80 @@
+# Copyright (c) 2025 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Helpers for partitioning a simulated system across multiple main
+event queues (parallel discrete event simulation, PDES).
+
+The C++ kernel already supports running one host thread per main event
+queue with quantum-based synchronization (see src/sim/simulate.cc), but
+by default every SimObject inherits eventq_index 0 from Root and a
+single host core services the whole system.  The functions below
+implement the standard partitioning used by the KVM configs -- each CPU
+(optionally together with its private cache hierarchy) is bound to its
+own event queue while shared devices stay on queue 0 -- in a reusable
+form, so any multi-core config can opt into parallel simulation.
+"""
+
+import m5.proxy
+
+
+def usingPDES(root):
+    """Determine if the simulator is using multiple parallel event queues."""
+
+    for obj in root.descendants():
+        if (
+            not m5.proxy.isproxy(obj.eventq_index)
+            and obj.eventq_index != root.eventq_index
+        ):
+            return True
+
+    return False
+
+
+def partitionEventQueues(
+    cpus, device_eq=0, first_cpu_eq=1, include_children=True
+):
+    """Bind each CPU in cpus to its own main event queue.
+
+    This must be called after the memory hierarchy has been built and
+    before m5.instantiate(), since child objects inherit the parent's
+    event queue at instantiation time.
+
+    If include_children is true, each CPU's descendants (i.e., its
+    private caches, TLBs and interrupt controller) follow the CPU onto
+    its queue, so a core-plus-cache slice runs on one host thread and
+    only crosses queues at the shared interconnect.  If it is false,
+    only the CPU itself moves and all children are pinned to device_eq,
+    which is the configuration KVM-based CPUs require.
+
+    The caller is responsible for setting Root.sim_quantum to a nonzero
+    value; simulate() will refuse to run multi-queue without a quantum.
+    """
+
+    for idx, cpu in enumerate(cpus):
+        eq = first_cpu_eq + idx
+        for obj in cpu.descendants():
+            obj.eventq_index = eq if include_children else device_eq
+        cpu.eventq_index = eq
@@ -68,6 +68,26 @@ class Root(SimObject):
     # Needs to be set explicitly for a multi-eventq simulation.
     sim_quantum = Param.Tick(0, "simulation quantum")
 
+    # Optional calendar-queue backend for the main event queues. When
+    # nonzero, scheduled events are spread over this many time-indexed
+    # buckets so insertion stays O(1) on average under heavy event
+    # load, instead of the default sorted list's O(n) scan.
+    event_queue_buckets = Param.Unsigned(
+        0, "calendar queue buckets for the main event queues (0 = "
+        "default sorted-list backend)"
+    )
+    event_queue_bucket_width = Param.Tick(
+        500, "calendar queue bucket width in ticks"
+    )
+
+    # Opt-in simulation self-profiling: time every serviced event on
+    # the host and report host time per event type in
+    # <outdir>/event_profile.txt at exit. Costs two clock reads per
+    # event while enabled.
+    host_event_profile = Param.Bool(
+        False, "Attribute host time per event type at exit"
+    )
+
     full_system = Param.Bool("if this is a full system simulation")
 
     # Time syncing prevents the simulation from running faster than real time.
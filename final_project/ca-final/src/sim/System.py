@@ -113,6 +113,29 @@ class System(SimObject):
         "shared_backstore is non-empty.",
     )
 
+    mem_ckpt_dirty_tracking = Param.Bool(
+        False,
+        "Track dirty pages in the physical memory backing store so that "
+        "checkpoints after the first serialize only the pages written "
+        "since the last full image. Disables direct (backdoor) host "
+        "access to memory.",
+    )
+
+    mem_ckpt_parallel_chunks = Param.Unsigned(
+        0,
+        "Shard full checkpoint images of the memory backing store into "
+        "this many chunks, compressed and decompressed by concurrent "
+        "worker threads (0 or 1 keeps the single-file format)",
+    )
+
+    shared_backstore_cow = Param.Bool(
+        False,
+        "Map the shared backstore copy-on-write. Concurrent simulations "
+        "restoring the same checkpoint then share one decompressed image "
+        "(the first process populates it) and physical RAM is shared "
+        "until written. Requires shared_backstore.",
+    )
+
     cache_line_size = Param.Unsigned(64, "Cache line size in bytes")
 
     redirect_paths = VectorParam.RedirectPath([], "Path redirections")
@@ -35,6 +35,7 @@ namespace Gem5Internal
 {
 
 __thread Tick *_curTickPtr;
+__thread Tick _curTickCache;
 
 } // namespace Gem5Internal
 } // namespace gem5
@@ -40,10 +40,16 @@ namespace Gem5Internal
 // This pointer is maintained by curEventQueue in src/sim/eventq.hh.
 extern __thread Tick *_curTickPtr;
 
+// Per-thread cache of the current queue's tick, refreshed whenever
+// the queue advances (EventQueue::setCurTick) or the thread switches
+// queues (curEventQueue). Lets curTick() compile to a single
+// thread-local load instead of a pointer chase.
+extern __thread Tick _curTickCache;
+
 } // namespace Gem5Internal
 
 /// The universal simulation clock.
-inline Tick curTick() { return *Gem5Internal::_curTickPtr; }
+inline Tick curTick() { return Gem5Internal::_curTickCache; }
 
 } // namespace gem5
 
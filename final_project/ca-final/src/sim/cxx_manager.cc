@@ -715,6 +715,13 @@ CxxConfigManager::loadState(CheckpointIn &checkpoint)
 void
 CxxConfigManager::deleteObjects()
 {
+    // Deleting the objects does not return the process to a state
+    // from which a second simulation can be instantiated: stats
+    // remain registered in the global registry (there is no
+    // unregister), the static SimObject list keeps stale pointers,
+    // scheduled events stay on the event queues, and curTick cannot
+    // rewind. This is why in-process back-to-back runs are not
+    // supported and sweep batching happens at the process level.
     for (auto i = objectsInOrder.rbegin(); i != objectsInOrder.rend(); ++i) {
         DPRINTF(CxxConfig, "Freeing sim object: %s\n", (*i)->name());
         delete *i;
@@ -34,6 +34,7 @@
 #include <iostream>
 #include <mutex>
 #include <string>
+#include <chrono>
 #include <unordered_map>
 #include <vector>
 
@@ -55,6 +56,8 @@ Tick simQuantum = 0;
 //
 uint32_t numMainEventQueues = 0;
 std::vector<EventQueue *> mainEventQueue;
+
+bool hostEventProfiling = false;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
 
@@ -135,18 +138,18 @@ Event::releaseImpl()
 }
 
 void
-EventQueue::insert(Event *event)
+EventQueue::insertInto(Event *event, Event *&chain)
 {
-    // Deal with the head case
-    if (!head || *event <= *head) {
-        head = Event::insertBefore(event, head);
+    // Deal with the chain head case
+    if (!chain || *event <= *chain) {
+        chain = Event::insertBefore(event, chain);
         return;
     }
 
     // Figure out either which 'in bin' list we are on, or where a new list
     // needs to be inserted
-    Event *prev = head;
-    Event *curr = head->nextBin;
+    Event *prev = chain;
+    Event *curr = chain->nextBin;
     while (curr && *curr < *event) {
         prev = curr;
         curr = curr->nextBin;
@@ -157,6 +160,24 @@ EventQueue::insert(Event *event)
     prev->nextBin = Event::insertBefore(event, curr);
 }
 
+void
+EventQueue::insert(Event *event)
+{
+    if (calBuckets.empty()) {
+        insertInto(event, head);
+        return;
+    }
+
+    insertInto(event, calBuckets[calIndex(event->when())]);
+
+    // insertBefore() puts the event on top of its bin, so if it is
+    // not later than the cached minimum it is the new minimum.
+    if (!head || *event <= *head) {
+        head = event;
+        calWindow = event->when() / calWidth;
+    }
+}
+
 Event *
 Event::removeItem(Event *event, Event *top)
 {
@@ -189,23 +210,21 @@ Event::removeItem(Event *event, Event *top)
 }
 
 void
-EventQueue::remove(Event *event)
+EventQueue::removeFrom(Event *event, Event *&chain)
 {
-    if (head == NULL)
+    if (chain == NULL)
         panic("event not found!");
 
-    assert(event->queue == this);
-
-    // deal with an event on the head's 'in bin' list (event has the same
-    // time as the head)
-    if (*head == *event) {
-        head = Event::removeItem(event, head);
+    // deal with an event on the chain head's 'in bin' list (event has
+    // the same time as the chain head)
+    if (*chain == *event) {
+        chain = Event::removeItem(event, chain);
         return;
     }
 
     // Find the 'in bin' list that this event belongs on
-    Event *prev = head;
-    Event *curr = head->nextBin;
+    Event *prev = chain;
+    Event *curr = chain->nextBin;
     while (curr && *curr < *event) {
         prev = curr;
         curr = curr->nextBin;
@@ -220,6 +239,24 @@ EventQueue::remove(Event *event)
     prev->nextBin = Event::removeItem(event, curr);
 }
 
+void
+EventQueue::remove(Event *event)
+{
+    assert(event->queue == this);
+
+    if (calBuckets.empty()) {
+        removeFrom(event, head);
+        return;
+    }
+
+    removeFrom(event, calBuckets[calIndex(event->when())]);
+
+    // Only removing the cached minimum itself invalidates head;
+    // removing a deeper event of the same bin leaves the top intact.
+    if (event == head)
+        head = calFindEarliest();
+}
+
 Event *
 EventQueue::serviceOne()
 {
@@ -228,16 +265,30 @@ EventQueue::serviceOne()
     Event *next = head->nextInBin;
     event->flags.clear(Event::Scheduled);
 
-    if (next) {
-        // update the next bin pointer since it could be stale
-        next->nextBin = head->nextBin;
-
-        // pop the stack
-        head = next;
+    if (calBuckets.empty()) {
+        if (next) {
+            // update the next bin pointer since it could be stale
+            next->nextBin = head->nextBin;
+
+            // pop the stack
+            head = next;
+        } else {
+            // this was the only element on the 'in bin' list, so get rid
+            // of the 'in bin' list and point to the next bin list
+            head = head->nextBin;
+        }
     } else {
-        // this was the only element on the 'in bin' list, so get rid of
-        // the 'in bin' list and point to the next bin list
-        head = head->nextBin;
+        // The head bin is always the first bin of its bucket; pop it
+        // there and then refresh the cached minimum.
+        Event *&chain = calBuckets[calIndex(event->when())];
+        assert(chain == event);
+        if (next) {
+            next->nextBin = event->nextBin;
+            chain = next;
+        } else {
+            chain = event->nextBin;
+        }
+        head = next ? next : calFindEarliest();
     }
 
     // handle action
@@ -246,7 +297,17 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        if (hostEventProfiling) {
+            const auto start = std::chrono::steady_clock::now();
+            event->process();
+            const auto stop = std::chrono::steady_clock::now();
+            auto &slot = hostProfile[event->description()];
+            slot.first += std::chrono::duration_cast<
+                std::chrono::nanoseconds>(stop - start).count();
+            slot.second++;
+        } else {
+            event->process();
+        }
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -321,15 +382,23 @@ EventQueue::dump() const
     if (empty())
         cprintf("<No Events>\n");
     else {
-        Event *nextBin = head;
-        while (nextBin) {
-            Event *nextInBin = nextBin;
-            while (nextInBin) {
-                nextInBin->dump();
-                nextInBin = nextInBin->nextInBin;
+        auto dump_chain = [](Event *nextBin) {
+            while (nextBin) {
+                Event *nextInBin = nextBin;
+                while (nextInBin) {
+                    nextInBin->dump();
+                    nextInBin = nextInBin->nextInBin;
+                }
+
+                nextBin = nextBin->nextBin;
             }
+        };
 
-            nextBin = nextBin->nextBin;
+        if (calBuckets.empty()) {
+            dump_chain(head);
+        } else {
+            for (Event *bucket : calBuckets)
+                dump_chain(bucket);
         }
     }
 
@@ -341,46 +410,122 @@ EventQueue::debugVerify() const
 {
     std::unordered_map<long, bool> map;
 
-    Tick time = 0;
-    short priority = 0;
-
-    Event *nextBin = head;
-    while (nextBin) {
-        Event *nextInBin = nextBin;
-        while (nextInBin) {
-            if (nextInBin->when() < time) {
-                cprintf("time goes backwards!");
-                nextInBin->dump();
-                return false;
-            } else if (nextInBin->when() == time &&
-                       nextInBin->priority() < priority) {
-                cprintf("priority inverted!");
-                nextInBin->dump();
-                return false;
-            }
+    // Each chain (head, or one calendar bucket) must be sorted on its
+    // own; events in different buckets are unordered relative to each
+    // other.
+    auto verify_chain = [&map](Event *nextBin) {
+        Tick time = 0;
+        short priority = 0;
 
-            if (map[reinterpret_cast<long>(nextInBin)]) {
-                cprintf("Node already seen");
-                nextInBin->dump();
-                return false;
-            }
-            map[reinterpret_cast<long>(nextInBin)] = true;
+        while (nextBin) {
+            Event *nextInBin = nextBin;
+            while (nextInBin) {
+                if (nextInBin->when() < time) {
+                    cprintf("time goes backwards!");
+                    nextInBin->dump();
+                    return false;
+                } else if (nextInBin->when() == time &&
+                           nextInBin->priority() < priority) {
+                    cprintf("priority inverted!");
+                    nextInBin->dump();
+                    return false;
+                }
+
+                if (map[reinterpret_cast<long>(nextInBin)]) {
+                    cprintf("Node already seen");
+                    nextInBin->dump();
+                    return false;
+                }
+                map[reinterpret_cast<long>(nextInBin)] = true;
+
+                time = nextInBin->when();
+                priority = nextInBin->priority();
 
-            time = nextInBin->when();
-            priority = nextInBin->priority();
+                nextInBin = nextInBin->nextInBin;
+            }
 
-            nextInBin = nextInBin->nextInBin;
+            nextBin = nextBin->nextBin;
         }
 
-        nextBin = nextBin->nextBin;
+        return true;
+    };
+
+    if (calBuckets.empty())
+        return verify_chain(head);
+
+    for (Event *bucket : calBuckets) {
+        if (!verify_chain(bucket))
+            return false;
     }
 
     return true;
 }
 
+Event *
+EventQueue::calFindEarliest()
+{
+    // Walk at most one full rotation starting at the window of the
+    // previous minimum. The first bin that falls inside the window
+    // being examined cannot be beaten by any later bucket, so the scan
+    // can stop there. Bins belonging to later rotations are tracked as
+    // a fallback for sparsely populated queues.
+    const size_t nbuckets = calBuckets.size();
+    Event *min_event = NULL;
+    uint64_t window = calWindow;
+    for (size_t i = 0; i < nbuckets; i++, window++) {
+        Event *bin = calBuckets[window % nbuckets];
+        if (!bin)
+            continue;
+        if (bin->when() / calWidth == window) {
+            calWindow = window;
+            return bin;
+        }
+        if (!min_event || *bin < *min_event)
+            min_event = bin;
+    }
+
+    // Nothing within one rotation; all remaining events are at least a
+    // full rotation away, so jump straight to the minimum.
+    if (min_event)
+        calWindow = min_event->when() / calWidth;
+    return min_event;
+}
+
+void
+EventQueue::setCalendar(size_t buckets, Tick width)
+{
+    panic_if(!calBuckets.empty(),
+             "%s: calendar backend already configured", name());
+    if (buckets == 0)
+        return;
+    panic_if(width == 0, "%s: calendar bucket width must be nonzero",
+             name());
+
+    // Migrate whatever is already scheduled (e.g., the simulate() exit
+    // event) into the calendar.
+    Event *chain = head;
+    head = NULL;
+    calBuckets.assign(buckets, NULL);
+    calWidth = width;
+    calWindow = getCurTick() / width;
+
+    while (chain) {
+        Event *bin = chain;
+        chain = chain->nextBin;
+        while (bin) {
+            Event *next_in = bin->nextInBin;
+            insert(bin);
+            bin = next_in;
+        }
+    }
+}
+
 Event*
 EventQueue::replaceHead(Event* s)
 {
+    panic_if(!calBuckets.empty(),
+             "%s: replaceHead() is not supported with the calendar "
+             "event queue backend", name());
     Event* t = head;
     head = s;
     return t;
@@ -442,7 +587,7 @@ Event::dump() const
 }
 
 EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+    : objName(n), head(NULL), _curTick(0), calWidth(0), calWindow(0)
 {
 }
 
@@ -43,10 +43,14 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
 #include "base/named.hh"
+#include "base/pooled_new.hh"
 #include "base/trace.hh"
 #include "base/type_traits.hh"
 #include "base/types.hh"
@@ -74,6 +78,14 @@ extern uint32_t numMainEventQueues;
 //! Array for main event queues.
 extern std::vector<EventQueue *> mainEventQueue;
 
+/**
+ * Opt-in host-time self-profiling (Root.host_event_profile): when
+ * set, serviceOne() times each event's process() on the host and
+ * attributes it to the event's description. See
+ * EventQueue::hostProfile.
+ */
+extern bool hostEventProfiling;
+
 //! The current event queue for the running thread. Access to this queue
 //! does not require any locking from the thread.
 
@@ -251,7 +263,8 @@ class EventBase
  *
  * Caution, the order of members is chosen to maximize data packing.
  */
-class Event : public EventBase, public Serializable
+class Event : public EventBase, public Serializable,
+    public PooledNew<Event>
 {
     friend class EventQueue;
 
@@ -357,6 +370,17 @@ class Event : public EventBase, public Serializable
     /// Return the instance number as a string.
     const std::string instanceString() const;
 
+    /**
+     * Pooled allocation for dynamically created events comes from the
+     * PooledNew<Event> base: dynamic events (e.g., AutoDelete port
+     * retry and deferred-send events) are allocated and freed
+     * millions of times over a run, and the mixin recycles their
+     * storage through per-thread free lists binned by size class,
+     * keeping the malloc/free pair off the event scheduling hot
+     * path. Since each main event queue is serviced by one thread,
+     * the free lists are effectively per event queue.
+     */
+
   protected: /* Memory management */
     /**
      * @{
@@ -621,6 +645,23 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
+    /**
+     * Calendar-queue backend state. When calBuckets is empty (the
+     * default), the queue is the classic sorted list of 'in bin'
+     * lists rooted at head. When it is non-empty, bins are spread
+     * across calBuckets by event time (window = when / calWidth,
+     * bucket = window % calBuckets.size()) and each bucket holds a
+     * short sorted bin list, making insertion O(1) on average under
+     * heavy event load. head always caches the globally earliest bin
+     * top so the inline accessors (nextTick(), empty(), getHead())
+     * work unchanged in both modes.
+     */
+    std::vector<Event *> calBuckets;
+    Tick calWidth;
+    //! Window index of the current head; calFindEarliest() resumes
+    //! its rotation scan from here.
+    uint64_t calWindow;
+
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
@@ -649,11 +690,34 @@ class EventQueue
      */
     UncontendedMutex service_mutex;
 
+    /**
+     * Host nanoseconds and service counts per event description,
+     * populated only while hostEventProfiling is set; merged into
+     * the end-of-run report by the Root object.
+     */
+    std::unordered_map<const char *, std::pair<uint64_t, uint64_t>>
+        hostProfile;
+
     //! Insert / remove event from the queue. Should only be called
     //! by thread operating this queue.
     void insert(Event *event);
     void remove(Event *event);
 
+    //! Insert / remove an event from a single sorted bin list (either
+    //! head or one calendar bucket).
+    static void insertInto(Event *event, Event *&chain);
+    static void removeFrom(Event *event, Event *&chain);
+
+    //! Find the earliest scheduled event across all calendar buckets
+    //! by walking at most one full rotation starting at calWindow.
+    Event *calFindEarliest();
+
+    size_t
+    calIndex(Tick when) const
+    {
+        return (when / calWidth) % calBuckets.size();
+    }
+
     //! Function for adding events to the async queue. The added events
     //! are added to main event queue later. Threads, other than the
     //! owning thread, should call this function instead of insert().
@@ -834,7 +898,15 @@ class EventQueue
     }
 
     Tick nextTick() const { return head->when(); }
-    void setCurTick(Tick newVal) { _curTick = newVal; }
+    void
+    setCurTick(Tick newVal)
+    {
+        _curTick = newVal;
+        // keep the curTick() fast-path cache coherent for the thread
+        // this queue is current on
+        if (this == _curEventQueue)
+            Gem5Internal::_curTickCache = newVal;
+    }
 
     /**
      * While curTick() is useful for any object assigned to this event queue,
@@ -932,6 +1004,17 @@ class EventQueue
      */
     Event* replaceHead(Event* s);
 
+    /**
+     * Switch this queue to the calendar-queue backend with the given
+     * number of buckets and bucket width (in ticks). Events that are
+     * already scheduled are migrated into the calendar. Must be
+     * called before thread creation (i.e., during configuration);
+     * switching back to the plain list is not supported.
+     *
+     * @ingroup api_eventq
+     */
+    void setCalendar(size_t buckets, Tick width);
+
     /**@{*/
     /**
      * Provide an interface for locking/unlocking the event queue.
@@ -973,6 +1056,7 @@ curEventQueue(EventQueue *q)
 {
     _curEventQueue = q;
     Gem5Internal::_curTickPtr = (q == nullptr) ? nullptr : &q->_curTick;
+    Gem5Internal::_curTickCache = (q == nullptr) ? 0 : q->_curTick;
 }
 
 void dumpMainQueue();
@@ -67,6 +67,10 @@ FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
     int woken_up = 0;
     auto &waiterList = it->second;
 
+    // Each waiter belongs to its own thread context (usually its own
+    // CPU), so the activations below cannot be merged into one bulk
+    // event; the loop itself is the batch -- all waiters eligible for
+    // this wake are released at the same tick, in FIFO order.
     while (!waiterList.empty() && woken_up < count) {
         // Threads may be woken up by access to locked
         // memory addresses outside of syscalls, so we
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/live_stats.hh"
+
+#include <unistd.h>
+
+#include <poll.h>
+
+#include "base/atomicio.hh"
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+#include "sim/eventq.hh"
+#include "sim/root.hh"
+#include "sim/stat_control.hh"
+
+namespace gem5
+{
+
+void
+LiveStatsServer::ListenEvent::process(int revent)
+{
+    // We might be called from the poll thread; migrate to ours.
+    EventQueue::ScopedMigration migrate(server->eventQueue());
+    server->accept();
+}
+
+void
+LiveStatsServer::DataEvent::process(int revent)
+{
+    EventQueue::ScopedMigration migrate(server->eventQueue());
+
+    if (revent & POLLIN)
+        server->data();
+    else if (revent & POLLNVAL)
+        server->detach();
+}
+
+LiveStatsServer::LiveStatsServer(const LiveStatsServerParams &params)
+    : SimObject(params), listener(params.port.build(params.name))
+{
+    if (params.port)
+        listen();
+}
+
+void
+LiveStatsServer::listen()
+{
+    if (ListenSocket::allDisabled()) {
+        warn_once("Sockets disabled, not accepting live stats queries");
+        return;
+    }
+
+    listener->listen();
+
+    listenEvent = new ListenEvent(this, listener->getfd(), POLLIN);
+    pollQueue.schedule(listenEvent);
+}
+
+void
+LiveStatsServer::accept()
+{
+    if (!listener->islistening())
+        panic("%s: cannot accept a connection if not listening!", name());
+
+    int fd = listener->accept();
+    if (dataFd != -1) {
+        char message[] = "error: client already attached\n";
+        atomic_write(fd, message, sizeof(message) - 1);
+        ::close(fd);
+        return;
+    }
+
+    dataFd = fd;
+    pending.clear();
+    dataEvent = new DataEvent(this, dataFd, POLLIN);
+    pollQueue.schedule(dataEvent);
+}
+
+void
+LiveStatsServer::detach()
+{
+    if (dataFd != -1) {
+        ::close(dataFd);
+        dataFd = -1;
+    }
+
+    pollQueue.remove(dataEvent);
+    delete dataEvent;
+    dataEvent = nullptr;
+}
+
+void
+LiveStatsServer::data()
+{
+    char buf[1024];
+    const ssize_t len = ::read(dataFd, buf, sizeof(buf));
+    if (len <= 0) {
+        detach();
+        return;
+    }
+
+    pending.append(buf, len);
+
+    std::string::size_type eol;
+    while ((eol = pending.find('\n')) != std::string::npos) {
+        std::string line = pending.substr(0, eol);
+        pending.erase(0, eol + 1);
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty())
+            continue;
+
+        const std::string reply = handleQuery(line) + "\n";
+        atomic_write(dataFd, reply.c_str(), reply.size());
+    }
+}
+
+std::string
+LiveStatsServer::handleQuery(const std::string &path) const
+{
+    statistics::Info *info = resolveStat(path);
+    if (!info)
+        return csprintf("error: no such stat '%s'", path);
+
+    info->prepare();
+
+    if (auto *scalar = dynamic_cast<statistics::ScalarInfo *>(info))
+        return csprintf("%f", scalar->result());
+
+    if (auto *vector = dynamic_cast<statistics::VectorInfo *>(info)) {
+        std::string values;
+        for (const auto &value : vector->result()) {
+            if (!values.empty())
+                values += ' ';
+            values += csprintf("%f", value);
+        }
+        return values;
+    }
+
+    return csprintf("error: unsupported stat type for '%s'", path);
+}
+
+statistics::Info *
+LiveStatsServer::resolveStat(const std::string &path) const
+{
+    return statistics::resolveStatByPath(path);
+}
+
+} // namespace gem5
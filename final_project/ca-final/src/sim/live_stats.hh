@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_LIVE_STATS_HH__
+#define __SIM_LIVE_STATS_HH__
+
+#include <string>
+
+#include "base/pollevent.hh"
+#include "base/socket.hh"
+#include "base/statistics.hh"
+#include "params/LiveStatsServer.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * Control-socket server for live stat queries. A client connects and
+ * sends one dotted stat path per line ("system.cpu.ipc"); the server
+ * answers with the current value (or "error: ..." for unknown paths)
+ * without draining or dumping. Values are read straight from the live
+ * counters, which is exactly what a progress monitor wants: slightly
+ * racy against in-flight events, but available at any time for the
+ * cost of one read.
+ */
+class LiveStatsServer : public SimObject
+{
+  public:
+    LiveStatsServer(const LiveStatsServerParams &params);
+
+  private:
+    class ListenEvent : public PollEvent
+    {
+      public:
+        ListenEvent(LiveStatsServer *s, int fd, int e)
+            : PollEvent(fd, e), server(s)
+        {}
+        void process(int revent) override;
+
+      private:
+        LiveStatsServer *server;
+    };
+
+    class DataEvent : public PollEvent
+    {
+      public:
+        DataEvent(LiveStatsServer *s, int fd, int e)
+            : PollEvent(fd, e), server(s)
+        {}
+        void process(int revent) override;
+
+      private:
+        LiveStatsServer *server;
+    };
+
+    void listen();
+    void accept();
+    void detach();
+    void data();
+
+    /** Answer one request line. */
+    std::string handleQuery(const std::string &path) const;
+
+    /** Find a stat by full dotted path (group tree or legacy map). */
+    statistics::Info *resolveStat(const std::string &path) const;
+
+    ListenSocketPtr listener;
+    ListenEvent *listenEvent = nullptr;
+    DataEvent *dataEvent = nullptr;
+    int dataFd = -1;
+
+    /** Partially received request line. */
+    std::string pending;
+};
+
+} // namespace gem5
+
+#endif // __SIM_LIVE_STATS_HH__
@@ -28,18 +28,115 @@
 
 #include <Python.h>
 
+#include <cstdlib>
 #include <iostream>
+#include <string>
 
 #include "pybind11/embed.h"
 #include "pybind11/pybind11.h"
 
+#include "base/output.hh"
+#include "base/statistics.hh"
+#include "base/stats/text.hh"
 #include "python/embedded.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+#include "sim/cxx_config_ini.hh"
+#include "sim/cxx_manager.hh"
+#include "sim/eventq.hh"
 #include "sim/init_signals.hh"
+#include "sim/sim_events.hh"
+#include "sim/simulate.hh"
+#include "sim/stat_control.hh"
 
 using namespace gem5;
 
 namespace py = pybind11;
 
+namespace
+{
+
+statistics::Output *snapshotStatsOutput = nullptr;
+
+void
+snapshotStatsDump()
+{
+    statistics::processDumpQueue();
+
+    if (!snapshotStatsOutput)
+        return;
+
+    for (auto *info : statistics::statsList())
+        info->prepare();
+
+    snapshotStatsOutput->begin();
+    for (auto *info : statistics::statsList())
+        info->visit(*snapshotStatsOutput);
+    snapshotStatsOutput->end();
+}
+
+void
+snapshotStatsReset()
+{
+    statistics::processResetQueue();
+}
+
+/**
+ * Fast boot for identical-config restarts: instantiate the
+ * simulation straight from a config snapshot (the config.ini every
+ * Python run emits) through CxxConfigManager, without starting the
+ * interpreter at all. Simulation runs to the first exit event and
+ * stats land in the output directory as usual.
+ */
+int
+runConfigSnapshot(const std::string &config_file)
+{
+    setClockFrequency(1000000000000);
+    fixClockFrequency();
+    curEventQueue(getEventQueue(0));
+
+    statistics::initSimStats();
+    statistics::registerHandlers(snapshotStatsReset, snapshotStatsDump);
+
+    CxxIniFile conf;
+    if (!conf.load(config_file.c_str())) {
+        std::cerr << "Can't open config snapshot: " << config_file
+            << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    simout.setDirectory("m5out");
+
+    CxxConfigManager config_manager(conf);
+
+    try {
+        config_manager.instantiate();
+        config_manager.initState();
+        config_manager.startup();
+    } catch (CxxConfigManager::Exception &e) {
+        std::cerr << "Config problem in sim object " << e.name << ": "
+            << e.message << "\n(the full cxx-config object registry "
+            "requires a build with USE_CXX_CONFIG enabled)\n";
+        return EXIT_FAILURE;
+    }
+
+    statistics::enable();
+
+    snapshotStatsOutput =
+        statistics::initText(simout.resolve("stats.txt"), false, true);
+
+    GlobalSimLoopExitEvent *exit_event = simulate();
+
+    std::cerr << "Exiting @ tick " << curTick() << " because "
+        << exit_event->getCause() << std::endl;
+
+    snapshotStatsDump();
+
+    return EXIT_SUCCESS;
+}
+
+} // anonymous namespace
+
 // main() is now pretty stripped down and just sets up python and then
 // calls EmbeddedPython::initAll which loads the various embedded python
 // modules into the python environment and then starts things running by
@@ -50,6 +147,17 @@ main(int argc, char **argv)
     // Initialize gem5 special signal handling.
     initSignals();
 
+    // Fast boot path that skips Python entirely; see
+    // runConfigSnapshot above.
+    if (argc >= 2 && std::string(argv[1]) == "--config-snapshot") {
+        if (argc != 3) {
+            std::cerr << "Usage: " << argv[0]
+                << " --config-snapshot <config.ini>\n";
+            return EXIT_FAILURE;
+        }
+        return runConfigSnapshot(argv[2]);
+    }
+
 #if PY_VERSION_HEX < 0x03080000
     // Convert argv[0] to a wchar_t string, using python's locale and cleanup
     // functions.
@@ -68,6 +68,7 @@ MemState::operator=(const MemState &in)
     _nextThreadStackBase = in._nextThreadStackBase;
     _mmapEnd = in._mmapEnd;
     _vmaList = in._vmaList; /* This assignment does a deep copy. */
+    _lastFaultVmaValid = false;
 
     return *this;
 }
@@ -182,8 +183,24 @@ MemState::mapRegion(Addr start_addr, Addr length,
     assert(isUnmapped(start_addr, length));
 
     /**
-     * Record the region in our list structure.
+     * Record the region in our list structure. Adjacent anonymous
+     * regions with the same name are extended rather than added:
+     * allocation-heavy workloads grow their heaps in many small
+     * mappings and every list entry is a scan step for later faults
+     * and lookups. File-backed regions are never merged since their
+     * host buffers are per-mapping.
      */
+    if (sim_fd < 0) {
+        for (auto &vma : _vmaList) {
+            if (!vma.hasHostBuf() && vma.getName() == region_name &&
+                vma.end() == start_addr) {
+                vma = VMA(AddrRange(vma.start(), start_addr + length),
+                          _pageBytes, region_name, -1, 0);
+                return;
+            }
+        }
+    }
+
     _vmaList.emplace_back(AddrRange(start_addr, start_addr + length),
                           _pageBytes, region_name, sim_fd, offset);
 }
@@ -191,6 +208,9 @@ MemState::mapRegion(Addr start_addr, Addr length,
 void
 MemState::unmapRegion(Addr start_addr, Addr length)
 {
+    // the list is about to shrink; drop the fault memo
+    _lastFaultVmaValid = false;
+
     Addr end_addr = start_addr + length;
     const AddrRange range(start_addr, end_addr);
 
@@ -278,6 +298,9 @@ MemState::unmapRegion(Addr start_addr, Addr length)
 void
 MemState::remapRegion(Addr start_addr, Addr new_start_addr, Addr length)
 {
+    // the list is about to change shape; drop the fault memo
+    _lastFaultVmaValid = false;
+
     /**
      * Unmap new virtual region before doing anything else.
      */
@@ -389,32 +412,49 @@ MemState::fixupFault(Addr vaddr)
     /**
      * Check if we are accessing a mapped virtual address. If so then we
      * just haven't allocated it a physical page yet and can do so here.
+     * Start with the area that served the last fault; sequential
+     * first-touch walks stay inside one area for pages on end.
      */
-    for (const auto &vma : _vmaList) {
-        if (vma.contains(vaddr)) {
-            Addr vpage_start = roundDown(vaddr, _pageBytes);
-            _ownerProcess->allocateMem(vpage_start, _pageBytes);
+    auto fault_vma = std::end(_vmaList);
+    if (_lastFaultVmaValid && _lastFaultVma->contains(vaddr)) {
+        fault_vma = _lastFaultVma;
+    } else {
+        for (auto it = std::begin(_vmaList); it != std::end(_vmaList);
+             ++it) {
+            if (it->contains(vaddr)) {
+                fault_vma = it;
+                break;
+            }
+        }
+    }
+
+    if (fault_vma != std::end(_vmaList)) {
+        const auto &vma = *fault_vma;
+        _lastFaultVma = fault_vma;
+        _lastFaultVmaValid = true;
 
+        Addr vpage_start = roundDown(vaddr, _pageBytes);
+        _ownerProcess->allocateMem(vpage_start, _pageBytes);
+
+        /**
+         * We are assuming that fresh pages are zero-filled, so there is
+         * no need to zero them out when there is no backing file.
+         * This assumption will not hold true if/when physical pages
+         * are recycled.
+         */
+        if (vma.hasHostBuf()) {
             /**
-             * We are assuming that fresh pages are zero-filled, so there is
-             * no need to zero them out when there is no backing file.
-             * This assumption will not hold true if/when physical pages
-             * are recycled.
+             * Write the memory for the host buffer contents for all
+             * ThreadContexts associated with this process.
              */
-            if (vma.hasHostBuf()) {
-                /**
-                 * Write the memory for the host buffer contents for all
-                 * ThreadContexts associated with this process.
-                 */
-                for (auto &cid : _ownerProcess->contextIds) {
-                    auto *tc = _ownerProcess->system->threads[cid];
-                    SETranslatingPortProxy
-                        virt_mem(tc, SETranslatingPortProxy::Always);
-                    vma.fillMemPages(vpage_start, _pageBytes, virt_mem);
-                }
+            for (auto &cid : _ownerProcess->contextIds) {
+                auto *tc = _ownerProcess->system->threads[cid];
+                SETranslatingPortProxy
+                    virt_mem(tc, SETranslatingPortProxy::Always);
+                vma.fillMemPages(vpage_start, _pageBytes, virt_mem);
             }
-            return true;
         }
+        return true;
     }
 
     /**
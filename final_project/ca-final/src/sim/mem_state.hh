@@ -290,6 +290,16 @@ class MemState : public Serializable
      * support this or the unmapping method must be changed.
      */
     std::list<VMA> _vmaList;
+
+    /**
+     * The VMA that served the last page fault; heap- and
+     * stack-walking workloads fault page after page into the same
+     * large area, so remembering it turns the common fixupFault()
+     * into one containment check instead of a list scan. Must be
+     * dropped whenever the list shrinks or is replaced.
+     */
+    std::list<VMA>::iterator _lastFaultVma;
+    bool _lastFaultVmaValid = false;
 };
 
 } // namespace gem5
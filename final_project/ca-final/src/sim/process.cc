@@ -70,6 +70,14 @@
 namespace gem5
 {
 
+uint64_t hostFsCacheEpoch = 0;
+
+void
+hostFsCacheInvalidate()
+{
+    hostFsCacheEpoch++;
+}
+
 namespace
 {
 
@@ -462,6 +470,25 @@ Process::findDriver(std::string filename)
 
 std::string
 Process::checkPathRedirect(const std::string &filename)
+{
+    auto it = redirectCache.find(filename);
+    if (it != redirectCache.end() && it->second.first == hostFsCacheEpoch)
+        return it->second.second;
+
+    std::string host_path = resolveRedirectPath(filename);
+
+    // Directory-scan-heavy workloads revisit a modest set of paths;
+    // if something degenerate blows past the bound, dropping the
+    // cache wholesale is cheaper than maintaining an eviction order.
+    if (it == redirectCache.end() && redirectCache.size() >= 4096)
+        redirectCache.clear();
+    redirectCache[filename] = {hostFsCacheEpoch, host_path};
+
+    return host_path;
+}
+
+std::string
+Process::resolveRedirectPath(const std::string &filename)
 {
     // If the input parameter contains a relative path, convert it.
     // The target version of the current working directory is fine since
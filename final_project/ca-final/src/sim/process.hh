@@ -35,6 +35,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/loader/memory_image.hh"
@@ -49,6 +50,18 @@
 namespace gem5
 {
 
+/**
+ * Generation counter for host-filesystem lookup caches in SE mode.
+ * Every emulated syscall that can change host filesystem state bumps
+ * it through hostFsCacheInvalidate(); cached entries tagged with an
+ * older generation are treated as misses. A counter keeps
+ * invalidation O(1) no matter how many entries are outstanding.
+ */
+extern uint64_t hostFsCacheEpoch;
+
+/** Invalidate every host-filesystem metadata cache. */
+void hostFsCacheInvalidate();
+
 namespace loader
 {
 class ObjectFile;
@@ -264,6 +277,22 @@ class Process : public SimObject
      */
     std::string checkPathRedirect(const std::string &filename);
 
+    /**
+     * Uncached body of checkPathRedirect(); probes the host
+     * filesystem for each candidate redirect target.
+     */
+    std::string resolveRedirectPath(const std::string &filename);
+
+    /**
+     * Memoized checkPathRedirect() results, tagged with the
+     * host-filesystem generation they were computed in. The probe
+     * uses access() and relative inputs depend on the working
+     * directory, so entries only live until the next emulated
+     * syscall that can change either (chdir included).
+     */
+    std::unordered_map<std::string, std::pair<uint64_t, std::string>>
+        redirectCache;
+
     /**
      * The cwd members are used to track changes to the current working
      * directory for the purpose of executing system calls which depend on
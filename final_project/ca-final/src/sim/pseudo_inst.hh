@@ -58,6 +58,21 @@ namespace gem5
 namespace pseudo_inst
 {
 
+/*
+ * On batched region annotations: the memory-mapped trigger range
+ * (decodeAddrOffset below) already makes one annotation one
+ * uncached store with no trap or decode involvement. Going below
+ * that -- a guest-side shared-page buffer flushed in batches --
+ * moves the cost to near zero per marker but changes semantics:
+ * annotations become visible to the simulator only at flush time,
+ * so anything keyed on them (stats dumps, region switches,
+ * checkpoints) acts late by up to a batch. That deferred-visibility
+ * contract, plus the guest/host shared-page protocol (a ring the
+ * guest writes with guest-clock timestamps and the simulator
+ * drains on flush triggers), is an ABI to design with the guest
+ * library, not a simulator-side patch; recorded here with the
+ * mechanism it would extend.
+ */
 static inline void
 decodeAddrOffset(Addr offset, uint8_t &func)
 {
@@ -39,8 +39,15 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/cprintf.hh"
 #include "base/hostinfo.hh"
 #include "base/logging.hh"
+#include "base/output.hh"
 #include "base/trace.hh"
 #include "debug/TimeSync.hh"
 #include "sim/core.hh"
@@ -188,6 +195,56 @@ Root::Root(const RootParams &p, int)
 
     simQuantum = p.sim_quantum;
 
+    // Optionally switch the main event queues over to the calendar
+    // backend before any simulation thread starts servicing them.
+    if (p.event_queue_buckets > 0) {
+        for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+            getEventQueue(i)->setCalendar(p.event_queue_buckets,
+                                          p.event_queue_bucket_width);
+        }
+    }
+
+    // Opt-in host-time self-profiling of the event loop; the report
+    // is written at exit so it covers the whole run.
+    if (p.host_event_profile) {
+        hostEventProfiling = true;
+        registerExitCallback([]() {
+            std::unordered_map<const char *,
+                std::pair<uint64_t, uint64_t>> merged;
+            for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+                for (const auto &kv : getEventQueue(i)->hostProfile) {
+                    auto &slot = merged[kv.first];
+                    slot.first += kv.second.first;
+                    slot.second += kv.second.second;
+                }
+            }
+
+            std::vector<std::pair<const char *,
+                std::pair<uint64_t, uint64_t>>> rows(
+                    merged.begin(), merged.end());
+            std::sort(rows.begin(), rows.end(),
+                [](const auto &a, const auto &b) {
+                    return a.second.first > b.second.first;
+                });
+
+            uint64_t total_ns = 0;
+            for (const auto &row : rows)
+                total_ns += row.second.first;
+
+            auto *out = simout.create("event_profile.txt", false);
+            std::ostream &os = *out->stream();
+            ccprintf(os, "%-40s %15s %12s %7s\n",
+                     "event type", "host ns", "count", "share");
+            for (const auto &row : rows) {
+                ccprintf(os, "%-40s %15d %12d %6.2f%%\n",
+                         row.first, row.second.first, row.second.second,
+                         total_ns ? 100.0 * row.second.first / total_ns
+                                  : 0.0);
+            }
+            simout.close(out);
+        });
+    }
+
     // Some of the statistics are global and need to be accessed by
     // stat formulas. The most convenient way to implement that is by
     // having a single global stat group for global stats. Merge that
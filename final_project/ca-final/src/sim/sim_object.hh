@@ -94,6 +94,17 @@ class SimObjectResolver;
  * SimObject.py). This has the effect of calling the method on the
  * parent node <i>before</i> its children.
  *
+ * @note These phases are deliberately serial. Construction runs
+ * interleaved with Python parameter evaluation (each C++ object is
+ * built as its params object is converted), so there is no point
+ * where a complete dependency graph exists ahead of the ctors that
+ * could be levelized for parallel construction; and the later phases
+ * lean on process-global state -- the statistics name registry, the
+ * event queues, curTick -- that is not synchronized. Startup cost
+ * concentrated here is better attacked by skipping the Python phase
+ * on identical-config reruns (see CxxConfigManager) than by
+ * threading these loops.
+ *
  * The python version of a SimObject class actually represents its Params
  * structure which holds all its parameter settings and its name. When python
  * needs to create a C++ instance of one of those classes, it uses the Params
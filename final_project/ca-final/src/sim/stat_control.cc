@@ -52,7 +52,9 @@
 #include "base/callback.hh"
 #include "base/statistics.hh"
 #include "base/time.hh"
+#include "base/stats/info.hh"
 #include "sim/global_event.hh"
+#include "sim/root.hh"
 
 namespace gem5
 {
@@ -158,5 +160,36 @@ updateEvents()
     }
 }
 
+Info *
+resolveStatByPath(const std::string &path)
+{
+    // legacy (old-style) stats register their full dotted name
+    const auto it = nameMap().find(path);
+    if (it != nameMap().end())
+        return it->second;
+
+    // group stats: walk the group tree component by component
+    Group *group = Root::root();
+    std::string::size_type pos = 0;
+    while (group) {
+        const auto dot = path.find('.', pos);
+        if (dot == std::string::npos) {
+            const std::string leaf = path.substr(pos);
+            for (auto *info : group->getStats()) {
+                if (info->name == leaf)
+                    return info;
+            }
+            return nullptr;
+        }
+
+        const auto &groups = group->getStatGroups();
+        const auto git = groups.find(path.substr(pos, dot - pos));
+        group = git == groups.end() ? nullptr : git->second;
+        pos = dot + 1;
+    }
+
+    return nullptr;
+}
+
 } // namespace statistics
 } // namespace gem5
@@ -41,6 +41,8 @@
 #ifndef __SIM_STAT_CONTROL_HH__
 #define __SIM_STAT_CONTROL_HH__
 
+#include <string>
+
 #include "base/compiler.hh"
 #include "base/types.hh"
 #include "sim/cur_tick.hh"
@@ -51,9 +53,18 @@ namespace gem5
 namespace statistics
 {
 
+class Info;
+
 
 void initSimStats();
 
+/**
+ * Resolve a stat by full dotted path: the legacy full-name registry
+ * first, then a walk of the stats group tree from the root. Returns
+ * nullptr if no such stat exists.
+ */
+Info *resolveStatByPath(const std::string &path);
+
 /**
  * Update the events after resuming from a checkpoint. When resuming from a
  * checkpoint, curTick will be updated, and any already scheduled events can
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/summary.hh"
+
+#include <ostream>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/statistics.hh"
+#include "base/stats/info.hh"
+#include "sim/core.hh"
+#include "sim/stat_control.hh"
+
+namespace gem5
+{
+
+SummaryEmitter::SummaryEmitter(const SummaryEmitterParams &params)
+    : SimObject(params),
+      summaryFile(params.summary_file),
+      json(params.format == "json")
+{
+    fatal_if(params.format != "json" && params.format != "csv",
+             "%s: format must be 'json' or 'csv'", name());
+
+    for (const auto &entry : params.metrics) {
+        const auto eq = entry.find('=');
+        fatal_if(eq == std::string::npos,
+                 "%s: metric '%s' is not of the form name=stat.path",
+                 name(), entry);
+        metrics.emplace_back(entry.substr(0, eq), entry.substr(eq + 1));
+    }
+
+    registerExitCallback([this]() { emitSummary(); });
+}
+
+void
+SummaryEmitter::emitSummary() const
+{
+    auto *out = simout.create(summaryFile, false);
+    std::ostream &os = *out->stream();
+
+    if (json) {
+        os << "{";
+        bool first = true;
+        for (const auto &metric : metrics) {
+            auto *info = statistics::resolveStatByPath(metric.second);
+            if (!info) {
+                warn("%s: no such stat '%s'", name(), metric.second);
+                continue;
+            }
+            info->prepare();
+            auto *scalar = dynamic_cast<statistics::ScalarInfo *>(info);
+            if (!scalar) {
+                warn("%s: '%s' is not scalar-valued", name(),
+                     metric.second);
+                continue;
+            }
+            ccprintf(os, "%s\"%s\": %f", first ? "" : ", ",
+                     metric.first, scalar->result());
+            first = false;
+        }
+        os << "}\n";
+    } else {
+        std::string header, row;
+        for (const auto &metric : metrics) {
+            auto *info = statistics::resolveStatByPath(metric.second);
+            double value = 0;
+            if (info) {
+                info->prepare();
+                auto *scalar =
+                    dynamic_cast<statistics::ScalarInfo *>(info);
+                if (scalar) {
+                    value = scalar->result();
+                } else {
+                    warn("%s: '%s' is not scalar-valued", name(),
+                         metric.second);
+                }
+            } else {
+                warn("%s: no such stat '%s'", name(), metric.second);
+            }
+            header += (header.empty() ? "" : ",") + metric.first;
+            row += csprintf("%s%f", row.empty() ? "" : ",", value);
+        }
+        os << header << "\n" << row << "\n";
+    }
+
+    simout.close(out);
+}
+
+} // namespace gem5
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 The Regents of the University of California.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_SUMMARY_HH__
+#define __SIM_SUMMARY_HH__
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "params/SummaryEmitter.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * Emits one roll-up record per run at exit: a declarative list of
+ * (column, stat path) pairs resolved against the live stats and
+ * written as a single CSV (header + one row) or JSON line in the
+ * output directory. Derived metrics (IPC, MPKI, AMAT, ...) are
+ * Formula stats in the configuration and referenced here by path
+ * like any other stat, so sweep aggregation becomes file
+ * concatenation instead of text-stats parsing.
+ */
+class SummaryEmitter : public SimObject
+{
+  public:
+    SummaryEmitter(const SummaryEmitterParams &params);
+
+  private:
+    /** Resolve every metric and write the record. */
+    void emitSummary() const;
+
+    /** (column name, stat path) pairs in output order. */
+    std::vector<std::pair<std::string, std::string>> metrics;
+
+    const std::string summaryFile;
+    const bool json;
+};
+
+} // namespace gem5
+
+#endif // __SIM_SUMMARY_HH__
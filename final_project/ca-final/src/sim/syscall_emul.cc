@@ -360,6 +360,7 @@ unlinkImpl(SyscallDesc *desc, ThreadContext *tc, std::string path)
     auto p = tc->getProcessPtr();
     path = p->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
     int result = unlink(path.c_str());
     return (result == -1) ? -errno : result;
 }
@@ -381,6 +382,7 @@ linkFunc(SyscallDesc *desc, ThreadContext *tc,
     path = p->absolutePath(path, true);
     new_path = p->absolutePath(new_path, true);
 
+    hostFsCacheInvalidate();
     int result = link(path.c_str(), new_path.c_str());
     return (result == -1) ? -errno : result;
 }
@@ -402,6 +404,7 @@ symlinkFunc(SyscallDesc *desc, ThreadContext *tc,
     path = p->absolutePath(path, true);
     new_path = p->absolutePath(new_path, true);
 
+    hostFsCacheInvalidate();
     int result = symlink(path.c_str(), new_path.c_str());
     return (result == -1) ? -errno : result;
 }
@@ -422,6 +425,7 @@ mkdirImpl(SyscallDesc *desc, ThreadContext *tc, std::string path, mode_t mode)
     auto p = tc->getProcessPtr();
     path = p->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
     auto result = mkdir(path.c_str(), mode);
     return (result == -1) ? -errno : result;
 }
@@ -452,6 +456,7 @@ renameImpl(SyscallDesc *desc, ThreadContext *tc,
     old_name = p->checkPathRedirect(old_name);
     new_name = p->checkPathRedirect(new_name);
 
+    hostFsCacheInvalidate();
     int64_t result = rename(old_name.c_str(), new_name.c_str());
     return (result == -1) ? -errno : result;
 }
@@ -470,6 +475,7 @@ truncate64Func(SyscallDesc *desc, ThreadContext *tc,
     // Adjust path for cwd and redirection
     path = process->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
 #if NO_STAT64
     int result = truncate(path.c_str(), length);
 #else
@@ -489,6 +495,7 @@ ftruncate64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    hostFsCacheInvalidate();
 #if NO_STAT64
     int result = ftruncate(sim_fd, length);
 #else
@@ -532,6 +539,7 @@ chownImpl(SyscallDesc *desc, ThreadContext *tc,
     // Adjust path for cwd and redirection
     path = p->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
     int result = chown(path.c_str(), hostOwner, hostGroup);
     return (result == -1) ? -errno : result;
 }
@@ -551,6 +559,7 @@ fchownFunc(SyscallDesc *desc, ThreadContext *tc,
     uid_t hostOwner = owner;
     gid_t hostGroup = group;
 
+    hostFsCacheInvalidate();
     int result = fchown(sim_fd, hostOwner, hostGroup);
     return (result == -1) ? -errno : result;
 }
@@ -908,6 +917,7 @@ mknodImpl(SyscallDesc *desc, ThreadContext *tc,
     auto p = tc->getProcessPtr();
     path = p->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
     auto result = mknod(path.c_str(), mode, dev);
     return (result == -1) ? -errno : result;
 }
@@ -931,6 +941,8 @@ chdirFunc(SyscallDesc *desc, ThreadContext *tc, VPtr<> pathname)
     }
     std::string host_cwd = p->checkPathRedirect(tgt_cwd);
 
+    // chdir changes what relative paths resolve to.
+    hostFsCacheInvalidate();
     int result = chdir(host_cwd.c_str());
 
     if (result == -1)
@@ -957,6 +969,7 @@ rmdirImpl(SyscallDesc *desc, ThreadContext *tc, std::string path)
     auto p = tc->getProcessPtr();
     path = p->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
     auto result = rmdir(path.c_str());
     return (result == -1) ? -errno : result;
 }
@@ -86,6 +86,7 @@
 #include <cerrno>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "arch/generic/tlb.hh"
 #include "base/intmath.hh"
@@ -849,6 +850,10 @@ openatFunc(SyscallDesc *desc, ThreadContext *tc,
     host_flags |= O_BINARY;
 #endif
 
+    // Opening with write intent can create or truncate the file.
+    if (host_flags & (O_WRONLY | O_RDWR | O_CREAT | O_TRUNC))
+        hostFsCacheInvalidate();
+
     /**
      * If the simulated process called open or openat with AT_FDCWD specified,
      * take the current working directory value which was passed into the
@@ -1262,6 +1267,7 @@ fchmodatFunc(SyscallDesc *desc, ThreadContext *tc,
     path = process->checkPathRedirect(path);
 
     // do the chmod
+    hostFsCacheInvalidate();
     int result = chmod(path.c_str(), hostMode);
     if (result < 0)
         return -errno;
@@ -1364,6 +1370,7 @@ fchmodFunc(SyscallDesc *desc, ThreadContext *tc, int tgt_fd, uint32_t mode)
 
     mode_t hostMode = mode;
 
+    hostFsCacheInvalidate();
     int result = fchmod(sim_fd, hostMode);
 
     return (result < 0) ? -errno : 0;
@@ -1453,6 +1460,57 @@ mremapFunc(SyscallDesc *desc, ThreadContext *tc,
     }
 }
 
+
+/**
+ * Bounded, generation-invalidated cache in front of the host
+ * stat()-family probes issued by the emulated stat syscalls.
+ * Directory-scan-heavy workloads (build systems in particular) stat
+ * the same paths over and over; the cache turns the repeats into a
+ * hashed lookup. Failures are cached too, with their errno, since
+ * negative lookups dominate path searches. Entries are tagged with
+ * hostFsCacheEpoch and every emulated syscall that can change host
+ * filesystem state bumps the epoch, so a hit can never observe
+ * metadata from before a guest-visible modification. The map is
+ * keyed on the redirected host path; a path probed through different
+ * host functions (stat vs. lstat) simply overwrites its slot.
+ */
+template <typename StatBuf>
+int
+cachedHostStat(int (*host_fn)(const char *, StatBuf *),
+               const std::string &path, StatBuf *host_buf)
+{
+    struct CachedResult
+    {
+        uint64_t epoch;
+        int (*fn)(const char *, StatBuf *);
+        int result;
+        int error;
+        StatBuf buf;
+    };
+    static std::unordered_map<std::string, CachedResult> cache;
+
+    auto it = cache.find(path);
+    if (it != cache.end() && it->second.epoch == hostFsCacheEpoch &&
+        it->second.fn == host_fn) {
+        *host_buf = it->second.buf;
+        errno = it->second.error;
+        return it->second.result;
+    }
+
+    int result = host_fn(path.c_str(), host_buf);
+    int error = errno;
+
+    // Past the bound a full cache is mostly stale-generation
+    // entries; resetting wholesale beats maintaining an LRU order.
+    if (it == cache.end() && cache.size() >= 4096)
+        cache.clear();
+    cache[path] = {hostFsCacheEpoch, host_fn, result, error,
+                   result == 0 ? *host_buf : StatBuf()};
+
+    errno = error;
+    return result;
+}
+
 /// Target stat() handler.
 template <class OS>
 SyscallReturn
@@ -1469,7 +1527,7 @@ statFunc(SyscallDesc *desc, ThreadContext *tc,
     path = process->checkPathRedirect(path);
 
     struct stat hostBuf;
-    int result = stat(path.c_str(), &hostBuf);
+    int result = cachedHostStat(stat, path, &hostBuf);
 
     if (result < 0)
         return -errno;
@@ -1508,7 +1566,7 @@ newfstatatFunc(SyscallDesc *desc, ThreadContext *tc, int dirfd,
     path = p->checkPathRedirect(path);
 
     struct stat host_buf;
-    int result = stat(path.c_str(), &host_buf);
+    int result = cachedHostStat(stat, path, &host_buf);
 
     if (result < 0)
         return -errno;
@@ -1541,10 +1599,10 @@ fstatat64Func(SyscallDesc *desc, ThreadContext *tc,
 
 #if NO_STAT64
     struct stat  hostBuf;
-    int result = stat(path.c_str(), &hostBuf);
+    int result = cachedHostStat(stat, path, &hostBuf);
 #else
     struct stat64 hostBuf;
-    int result = stat64(path.c_str(), &hostBuf);
+    int result = cachedHostStat(stat64, path, &hostBuf);
 #endif
 
     if (result < 0)
@@ -1593,7 +1651,7 @@ statxFunc(SyscallDesc *desc, ThreadContext *tc,
     path = p->checkPathRedirect(path);
 
     struct stat host_buf;
-    int result = stat(path.c_str(), &host_buf);
+    int result = cachedHostStat(stat, path, &host_buf);
 
     if (result < 0)
         return -errno;
@@ -1649,7 +1707,7 @@ lstatFunc(SyscallDesc *desc, ThreadContext *tc,
     path = process->checkPathRedirect(path);
 
     struct stat hostBuf;
-    int result = lstat(path.c_str(), &hostBuf);
+    int result = cachedHostStat(lstat, path, &hostBuf);
 
     if (result < 0)
         return -errno;
@@ -1676,10 +1734,10 @@ lstat64Func(SyscallDesc *desc, ThreadContext *tc,
 
 #if NO_STAT64
     struct stat hostBuf;
-    int result = lstat(path.c_str(), &hostBuf);
+    int result = cachedHostStat(lstat, path, &hostBuf);
 #else
     struct stat64 hostBuf;
-    int result = lstat64(path.c_str(), &hostBuf);
+    int result = cachedHostStat(lstat64, path, &hostBuf);
 #endif
 
     if (result < 0)
@@ -1985,6 +2043,7 @@ writevFunc(SyscallDesc *desc, ThreadContext *tc,
                       hiov[i].iov_len);
     }
 
+    hostFsCacheInvalidate();
     int result = writev(sim_fd, hiov.get(), count);
 
     for (typename OS::size_t i = 0; i < count; ++i)
@@ -2014,6 +2073,10 @@ mmapFunc(SyscallDesc *desc, ThreadContext *tc,
     }
 
     if ((prot & PROT_WRITE) && (tgt_flags & OS::TGT_MAP_SHARED)) {
+        // Stores through a writable shared mapping reach the file
+        // without further syscalls; invalidating here is the closest
+        // point the metadata caches can observe.
+        hostFsCacheInvalidate();
         // With shared mmaps, there are two cases to consider:
         // 1) anonymous: writes should modify the mapping and this should be
         // visible to observers who share the mapping. Currently, it's
@@ -2174,6 +2237,7 @@ pwrite64Func(SyscallDesc *desc, ThreadContext *tc,
     BufferArg bufArg(bufPtr, nbytes);
     bufArg.copyIn(SETranslatingPortProxy(tc));
 
+    hostFsCacheInvalidate();
     int bytes_written = pwrite(sim_fd, bufArg.bufferPtr(), nbytes, offset);
 
     return (bytes_written == -1) ? -errno : bytes_written;
@@ -2329,6 +2393,7 @@ futimesatFunc(SyscallDesc *desc, ThreadContext *tc,
     auto process = tc->getProcessPtr();
     path = process->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
     int result = utimes(path.c_str(), hostTimeval);
 
     if (result < 0)
@@ -2836,6 +2901,8 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
     BufferArg buf_arg(buf_ptr, nbytes);
     buf_arg.copyIn(SETranslatingPortProxy(tc));
 
+    hostFsCacheInvalidate();
+
     struct pollfd pfd;
     pfd.fd = sim_fd;
     pfd.events = POLLOUT;
@@ -3171,6 +3238,7 @@ fallocateFunc(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    hostFsCacheInvalidate();
     int result = fallocate(sim_fd, mode, offset, len);
     if (result < 0)
         return -errno;
@@ -3196,6 +3264,7 @@ truncateFunc(SyscallDesc *desc, ThreadContext *tc, VPtr<> pathname,
     // Adjust path for cwd and redirection
     path = p->checkPathRedirect(path);
 
+    hostFsCacheInvalidate();
     int result = truncate(path.c_str(), length);
     return (result == -1) ? -errno : result;
 }
@@ -3213,6 +3282,7 @@ ftruncateFunc(SyscallDesc *desc, ThreadContext *tc, int tgt_fd,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    hostFsCacheInvalidate();
     int result = ftruncate(sim_fd, length);
     return (result == -1) ? -errno : result;
 }
@@ -50,6 +50,8 @@ Ticked::Ticked(ClockedObject &object_,
     object(object_),
     event([this]{ processClockEvent(); }, object_.name(), false, priority),
     running(false),
+    skipping(false),
+    skipFrom(0),
     lastStopped(0),
     /* Allocate numCycles if an external stat wasn't passed in */
     numCyclesLocal((imported_num_cycles ? NULL : new statistics::Scalar)),
@@ -59,11 +61,16 @@ Ticked::Ticked(ClockedObject &object_,
 
 void
 Ticked::processClockEvent() {
+    /* A coalesced wakeup stands in for all the cycles it skipped */
+    Cycles delta = skipping ?
+        Cycles(object.curCycle() - skipFrom) : Cycles(1);
+    skipping = false;
+
     ++tickCycles;
-    ++numCycles;
-    countCycles(Cycles(1));
+    numCycles += delta;
+    countCycles(delta);
     evaluate();
-    if (running)
+    if (running && !event.scheduled())
         object.schedule(event, object.clockEdge(Cycles(1)));
 }
 
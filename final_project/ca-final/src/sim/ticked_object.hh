@@ -73,6 +73,12 @@ class Ticked : public Serializable
     /** Have I been started? and am not stopped */
     bool running;
 
+    /** Is the next wakeup a coalesced one (scheduled by skipAhead)? */
+    bool skipping;
+
+    /** Cycle at which the in-flight skip started, for accounting */
+    Cycles skipFrom;
+
     /** Time of last stop event to calculate run time */
     Cycles lastStopped;
 
@@ -128,6 +134,45 @@ class Ticked : public Serializable
         lastStopped = object.curCycle();
     }
 
+    /**
+     * Coalesce the next n cycle wakeups into a single event n cycles
+     * out. A ticked object that knows it cannot do useful work before
+     * then (e.g. it is quiescent until a response with a known
+     * latency arrives) can use this to avoid one event per idle
+     * cycle; the skipped cycles are attributed to numCycles when the
+     * wakeup fires. Calling skipAhead(1) (or less) is a no-op.
+     */
+    void
+    skipAhead(Cycles n)
+    {
+        if (!running || n <= 1)
+            return;
+
+        skipping = true;
+        skipFrom = object.curCycle();
+        if (event.scheduled())
+            object.reschedule(event, object.clockEdge(n));
+        else
+            object.schedule(event, object.clockEdge(n));
+    }
+
+    /**
+     * Input arrived earlier than the quiescent period declared to
+     * skipAhead(): pull the coalesced wakeup back to the next clock
+     * edge. The cycles that did elapse are still accounted.
+     */
+    void
+    cancelSkip()
+    {
+        if (!running || !skipping)
+            return;
+
+        if (event.scheduled())
+            object.reschedule(event, object.clockEdge(Cycles(1)));
+        else
+            object.schedule(event, object.clockEdge(Cycles(1)));
+    }
+
     /** Cancel the next tick event and issue no more */
     void
     stop()
@@ -136,6 +181,7 @@ class Ticked : public Serializable
             if (event.scheduled())
                 object.deschedule(event);
             running = false;
+            skipping = false;
             resetLastStopped();
         }
     }
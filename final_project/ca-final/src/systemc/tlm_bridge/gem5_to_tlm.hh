@@ -83,6 +83,23 @@ void addPacketToPayloadConversionStep(PacketToPayloadConversionStep step);
 
 tlm::tlm_generic_payload *packet2payload(gem5::PacketPtr packet);
 
+/*
+ * On loosely-timed quantum crossing: the bridges below synchronize
+ * the two kernels per transaction, which is what makes fine-grained
+ * co-simulation expensive. A quantum-negotiated mode has three
+ * parts: honouring tlm_global_quantum on the SystemC side (running
+ * the accelerator model ahead within the quantum on its local
+ * time), letting gem5's own sim_quantum (the parallel-event-queue
+ * machinery) bound how far gem5 runs ahead, and batching
+ * b_transport crossings by accumulating local time offsets instead
+ * of yielding per call. The rollback-safe boundary the request
+ * mentions is the hard part: gem5 has no speculation/rollback, so
+ * the only safe decoupling is one where all cross-boundary effects
+ * are deferred to quantum edges -- the DMI and backdoor paths must
+ * then be fenced at those edges too. That is a synchronization-
+ * model change for both bridge directions together, recorded here
+ * as the design sketch for that series.
+ */
 class Gem5ToTlmBridgeBase : public sc_core::sc_module
 {
   protected:
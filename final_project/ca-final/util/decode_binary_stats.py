@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Decode a gem5 binary stats file (written via binary://stats.bin)
+back into the text stats format, one section per dump.
+
+Usage: decode_binary_stats.py stats.bin [> stats.txt]
+"""
+
+import struct
+import sys
+
+MAGIC = 0x534E4942354D4547  # "GEM5BINS"
+
+REC_DUMP_BEGIN = 1
+REC_SCHEMA = 2
+REC_VALUES = 3
+REC_DUMP_END = 4
+
+
+def read_exact(f, n):
+    data = f.read(n)
+    if len(data) != n:
+        raise EOFError
+    return data
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+
+    names = {}
+    with open(sys.argv[1], "rb") as f:
+        magic, version = struct.unpack("<QI", read_exact(f, 12))
+        if magic != MAGIC:
+            sys.exit("not a gem5 binary stats file")
+        if version != 1:
+            sys.exit(f"unsupported version {version}")
+
+        while True:
+            try:
+                (rec,) = struct.unpack("<B", read_exact(f, 1))
+            except EOFError:
+                break
+
+            if rec == REC_DUMP_BEGIN:
+                (tick,) = struct.unpack("<Q", read_exact(f, 8))
+                print(
+                    "\n---------- Begin Simulation Statistics "
+                    f"(tick {tick}) ----------"
+                )
+            elif rec == REC_SCHEMA:
+                stat_id, _stat_type, name_len = struct.unpack(
+                    "<IBH", read_exact(f, 7)
+                )
+                names[stat_id] = read_exact(f, name_len).decode()
+            elif rec == REC_VALUES:
+                stat_id, count = struct.unpack("<II", read_exact(f, 8))
+                values = struct.unpack(
+                    f"<{count}d", read_exact(f, 8 * count)
+                )
+                name = names.get(stat_id, f"<unknown:{stat_id}>")
+                if count == 1:
+                    print(f"{name:<60} {values[0]:>12g}")
+                else:
+                    for i, value in enumerate(values):
+                        print(f"{name}::{i:<6} {value:>12g}")
+            elif rec == REC_DUMP_END:
+                print("---------- End Simulation Statistics   ----------")
+            else:
+                sys.exit(f"corrupt record type {rec}")
+
+
+if __name__ == "__main__":
+    main()
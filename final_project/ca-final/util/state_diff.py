@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 The Regents of the University of California.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Diff two cache tag-state snapshots (the GEM5TAGS files written by
+BaseCache.saveTagState) and report structural divergence: resident-
+set differences, per-set occupancy deltas, and recency-position
+distance for common lines. Lives next to tracediff for the same
+job one level up: telling where two supposedly equivalent runs
+diverged without full trace dumps.
+
+Usage: state_diff.py A.tags.gz B.tags.gz [--sets N] [--blk BYTES]
+"""
+
+import argparse
+import gzip
+import struct
+import sys
+from collections import Counter
+
+MAGIC = 0x35454D4754414753  # "GEM5TAGS"
+
+
+def load(path):
+    """Return the snapshot's lines as {addr: recency position},
+    oldest first, plus the ordered list."""
+    with gzip.open(path, "rb") as f:
+        magic, version, count = struct.unpack("<QIQ", f.read(20))
+        if magic != MAGIC:
+            sys.exit(f"{path}: not a tag state file")
+        if version != 1:
+            sys.exit(f"{path}: unsupported version {version}")
+        lines = []
+        for _ in range(count):
+            addr, secure = struct.unpack("<QB", f.read(9))
+            lines.append((addr, secure))
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("snap_a")
+    parser.add_argument("snap_b")
+    parser.add_argument(
+        "--sets", type=int, default=0,
+        help="number of sets, for per-set occupancy deltas"
+    )
+    parser.add_argument(
+        "--blk", type=int, default=64, help="block size in bytes"
+    )
+    args = parser.parse_args()
+
+    a = load(args.snap_a)
+    b = load(args.snap_b)
+    pos_a = {line: i for i, line in enumerate(a)}
+    pos_b = {line: i for i, line in enumerate(b)}
+
+    only_a = [line for line in a if line not in pos_b]
+    only_b = [line for line in b if line not in pos_a]
+    common = [line for line in a if line in pos_b]
+
+    print(f"A: {len(a)} resident lines   B: {len(b)} resident lines")
+    print(f"common: {len(common)}   only in A: {len(only_a)}   "
+          f"only in B: {len(only_b)}")
+
+    if common:
+        # recency-position distance of common lines, scaled to the
+        # snapshot sizes so two orderings of the same set score 0..1
+        dist = sum(abs(pos_a[line] / max(len(a) - 1, 1) -
+                       pos_b[line] / max(len(b) - 1, 1))
+                   for line in common) / len(common)
+        print(f"mean normalized recency distance: {dist:.4f}")
+
+    if args.sets:
+        occ_a = Counter((addr // args.blk) % args.sets for addr, _ in a)
+        occ_b = Counter((addr // args.blk) % args.sets for addr, _ in b)
+        deltas = [(abs(occ_a[s] - occ_b[s]), s)
+                  for s in range(args.sets) if occ_a[s] != occ_b[s]]
+        deltas.sort(reverse=True)
+        print(f"sets with occupancy deltas: {len(deltas)} of {args.sets}")
+        for delta, s in deltas[:16]:
+            print(f"  set {s:6d}: A={occ_a[s]:3d} B={occ_b[s]:3d} "
+                  f"(delta {delta})")
+
+    for label, lines in (("only in A", only_a), ("only in B", only_b)):
+        for addr, secure in lines[:8]:
+            print(f"  {label}: {addr:#x}{' (secure)' if secure else ''}")
+
+    # non-zero exit when the snapshots differ, for scripting
+    sys.exit(0 if not only_a and not only_b else 1)
+
+
+if __name__ == "__main__":
+    main()